@@ -14,13 +14,16 @@ public class Lair : ModuleRules
 			"Core",
 			"CoreUObject",
 			"Engine",
-			"InputCore"
+			"InputCore",
+			"NetCore"
 		});
 
 		PrivateDependencyModuleNames.AddRange(new string[]
 		{
 			"Slate",
-			"SlateCore"
+			"SlateCore",
+			"AssetRegistry",
+			"Json"
 		});
 
 		// Uncomment if using enhanced input
@@ -2,18 +2,67 @@
 // LAIR Game Module Implementation
 
 #include "Lair.h"
+#include "LairLog.h"
+#include "LairTrace.h"
+#include "LairStats.h"
+#include "LairMemory.h"
 #include "Modules/ModuleManager.h"
+#include "Trace/Trace.inl"
 
 IMPLEMENT_PRIMARY_GAME_MODULE(FLairModule, Lair, "Lair");
 
+DEFINE_LOG_CATEGORY(LogLair);
+DEFINE_LOG_CATEGORY(LogLairBoard);
+DEFINE_LOG_CATEGORY(LogLairTurn);
+DEFINE_LOG_CATEGORY(LogLairRules);
+DEFINE_LOG_CATEGORY(LogLairEconomy);
+DEFINE_LOG_CATEGORY(LogLairInput);
+
+UE_TRACE_CHANNEL_DEFINE(LairChannel);
+
+UE_TRACE_EVENT_BEGIN(Lair, GameEvent)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Label)
+UE_TRACE_EVENT_END()
+
+void FLairTrace::OutputGameEvent(const FString& Label)
+{
+	UE_TRACE_LOG(Lair, GameEvent, LairChannel)
+		<< GameEvent.Cycle(FPlatformTime::Cycles64())
+		<< GameEvent.Label(*Label, Label.Len());
+}
+
+DEFINE_STAT(STAT_LairGetTileAt);
+DEFINE_STAT(STAT_LairGetNeighborTiles);
+DEFINE_STAT(STAT_LairGetMovementCost);
+DEFINE_STAT(STAT_LairRulesCheck);
+DEFINE_STAT(STAT_LairRulesValidateBatch);
+DEFINE_STAT(STAT_LairPurchase);
+DEFINE_STAT(STAT_LairTileVisuals);
+DEFINE_STAT(STAT_LairUnitVisuals);
+DEFINE_STAT(STAT_LairLiveTiles);
+DEFINE_STAT(STAT_LairLiveUnits);
+DEFINE_STAT(STAT_LairTileMemory);
+DEFINE_STAT(STAT_LairUnitMemory);
+DEFINE_STAT(STAT_LairBoardMemory);
+DEFINE_STAT(STAT_LairRulesMemory);
+
+LLM_DEFINE_TAG(Lair);
+LLM_DEFINE_TAG(Lair_Board, TEXT("Board"), TEXT("Lair"));
+LLM_DEFINE_TAG(Lair_Tiles, TEXT("Tiles"), TEXT("Lair"));
+LLM_DEFINE_TAG(Lair_Units, TEXT("Units"), TEXT("Lair"));
+LLM_DEFINE_TAG(Lair_Rules, TEXT("Rules"), TEXT("Lair"));
+LLM_DEFINE_TAG(Lair_AI, TEXT("AI"), TEXT("Lair"));
+LLM_DEFINE_TAG(Lair_Replay, TEXT("Replay"), TEXT("Lair"));
+
 void FLairModule::StartupModule()
 {
 	// Module startup logic
-	UE_LOG(LogTemp, Log, TEXT("LAIR Module Started"));
+	UE_LOG(LogLair, Log, TEXT("LAIR Module Started"));
 }
 
 void FLairModule::ShutdownModule()
 {
 	// Module shutdown logic
-	UE_LOG(LogTemp, Log, TEXT("LAIR Module Shutdown"));
+	UE_LOG(LogLair, Log, TEXT("LAIR Module Shutdown"));
 }
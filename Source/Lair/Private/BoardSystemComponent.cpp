@@ -2,8 +2,13 @@
 // Step 6: Board System Component (Grid Management)
 
 #include "BoardSystemComponent.h"
+#include "LairLog.h"
+#include "LairMemory.h"
+#include "LairTrace.h"
+#include "LairStats.h"
 #include "Tile.h"
 #include "Unit.h"
+#include "RulesEngineComponent.h"
 #include "Engine/DataTable.h"
 #include "Engine/World.h"
 
@@ -12,6 +17,7 @@ UBoardSystemComponent::UBoardSystemComponent()
 	PrimaryComponentTick.bCanEverTick = false;
 
 	BoardSize = FIntPoint(LairConstants::DEFAULT_BOARD_SIZE_X, LairConstants::DEFAULT_BOARD_SIZE_Y);
+	DefaultBoardSize = BoardSize;
 
 	// Initialize player base coordinates for 2-player game
 	PlayerBaseCoords.Add(FIntPoint(0, 0));      // Player 1 at (0, 0)
@@ -25,7 +31,10 @@ void UBoardSystemComponent::BeginPlay()
 
 void UBoardSystemComponent::InitializeBoard(const FString& LayoutTablePath)
 {
-	UE_LOG(LogTemp, Log, TEXT("UBoardSystemComponent::InitializeBoard - Starting board initialization"));
+	TRACE_CPUPROFILER_EVENT_SCOPE(UBoardSystemComponent::InitializeBoard);
+	LLM_SCOPE_BYTAG(Lair_Board);
+
+	UE_LOG(LogLairBoard, Log, TEXT("UBoardSystemComponent::InitializeBoard - Starting board initialization"));
 
 	// Clear existing tiles
 	for (auto& Pair : TileGrid)
@@ -36,6 +45,7 @@ void UBoardSystemComponent::InitializeBoard(const FString& LayoutTablePath)
 		}
 	}
 	TileGrid.Empty();
+	TileFlags.Reset();
 
 	// If a path is provided, try to load the data table from that path
 	UDataTable* TableToUse = BoardLayoutDataTable;
@@ -45,11 +55,11 @@ void UBoardSystemComponent::InitializeBoard(const FString& LayoutTablePath)
 		if (LoadedTable)
 		{
 			TableToUse = LoadedTable;
-			UE_LOG(LogTemp, Log, TEXT("UBoardSystemComponent::InitializeBoard - Loaded data table from path: %s"), *LayoutTablePath);
+			UE_LOG(LogLairBoard, Log, TEXT("UBoardSystemComponent::InitializeBoard - Loaded data table from path: %s"), *LayoutTablePath);
 		}
 		else
 		{
-			UE_LOG(LogTemp, Warning, TEXT("UBoardSystemComponent::InitializeBoard - Failed to load data table from path: %s, using default"), *LayoutTablePath);
+			UE_LOG(LogLairBoard, Warning, TEXT("UBoardSystemComponent::InitializeBoard - Failed to load data table from path: %s, using default"), *LayoutTablePath);
 		}
 	}
 
@@ -68,13 +78,15 @@ void UBoardSystemComponent::InitializeBoard(const FString& LayoutTablePath)
 		GenerateDefaultBoard();
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("UBoardSystemComponent::InitializeBoard - Board created with %d tiles"),
+	SET_MEMORY_STAT(STAT_LairBoardMemory, TileGrid.GetAllocatedSize() + TileFlags.GetAllocatedSize());
+
+	UE_LOG(LogLairBoard, Log, TEXT("UBoardSystemComponent::InitializeBoard - Board created with %d tiles"),
 		TileGrid.Num());
 }
 
 void UBoardSystemComponent::GenerateDefaultBoard()
 {
-	BoardSize = FIntPoint(LairConstants::DEFAULT_BOARD_SIZE_X, LairConstants::DEFAULT_BOARD_SIZE_Y);
+	BoardSize = DefaultBoardSize;
 
 	// Update player base coordinates to match actual board dimensions
 	if (PlayerBaseCoords.Num() >= 2)
@@ -83,6 +95,8 @@ void UBoardSystemComponent::GenerateDefaultBoard()
 		PlayerBaseCoords[1] = FIntPoint(BoardSize.X - 1, BoardSize.Y - 1);
 	}
 
+	TileFlags.Init(ELairTileFlags::None, BoardSize.X * BoardSize.Y);
+
 	for (int32 X = 0; X < BoardSize.X; ++X)
 	{
 		for (int32 Y = 0; Y < BoardSize.Y; ++Y)
@@ -107,7 +121,7 @@ void UBoardSystemComponent::GenerateDefaultBoard()
 		}
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("UBoardSystemComponent::GenerateDefaultBoard - Generated %dx%d board"),
+	UE_LOG(LogLairBoard, Log, TEXT("UBoardSystemComponent::GenerateDefaultBoard - Generated %dx%d board"),
 		BoardSize.X, BoardSize.Y);
 }
 
@@ -115,7 +129,7 @@ void UBoardSystemComponent::LoadBoardFromDataTable()
 {
 	if (!BoardLayoutDataTable)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UBoardSystemComponent::LoadBoardFromDataTable - No data table set"));
+		UE_LOG(LogLairBoard, Warning, TEXT("UBoardSystemComponent::LoadBoardFromDataTable - No data table set"));
 		GenerateDefaultBoard();
 		return;
 	}
@@ -125,7 +139,7 @@ void UBoardSystemComponent::LoadBoardFromDataTable()
 
 	if (AllRows.Num() == 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UBoardSystemComponent::LoadBoardFromDataTable - Data table is empty"));
+		UE_LOG(LogLairBoard, Warning, TEXT("UBoardSystemComponent::LoadBoardFromDataTable - Data table is empty"));
 		GenerateDefaultBoard();
 		return;
 	}
@@ -138,6 +152,7 @@ void UBoardSystemComponent::LoadBoardFromDataTable()
 		MaxY = FMath::Max(MaxY, Row->GridCoord.Y);
 	}
 	BoardSize = FIntPoint(MaxX + 1, MaxY + 1);
+	TileFlags.Init(ELairTileFlags::None, BoardSize.X * BoardSize.Y);
 
 	// Spawn tiles from data table
 	for (const FBoardLayoutRow* Row : AllRows)
@@ -157,7 +172,7 @@ void UBoardSystemComponent::LoadBoardFromDataTable()
 		FIntPoint BaseCoord = PlayerBaseCoords[i];
 		if (!TileGrid.Contains(BaseCoord))
 		{
-			UE_LOG(LogTemp, Warning, TEXT("UBoardSystemComponent::LoadBoardFromDataTable - Player %d base at (%d, %d) has no tile, searching for fallback"),
+			UE_LOG(LogLairBoard, Warning, TEXT("UBoardSystemComponent::LoadBoardFromDataTable - Player %d base at (%d, %d) has no tile, searching for fallback"),
 				i, BaseCoord.X, BaseCoord.Y);
 
 			// Try to find any tile with matching PlayerBaseIndex
@@ -168,7 +183,7 @@ void UBoardSystemComponent::LoadBoardFromDataTable()
 				{
 					PlayerBaseCoords[i] = Pair.Key;
 					bFoundFallback = true;
-					UE_LOG(LogTemp, Log, TEXT("UBoardSystemComponent::LoadBoardFromDataTable - Found fallback base for Player %d at (%d, %d)"),
+					UE_LOG(LogLairBoard, Log, TEXT("UBoardSystemComponent::LoadBoardFromDataTable - Found fallback base for Player %d at (%d, %d)"),
 						i, Pair.Key.X, Pair.Key.Y);
 					break;
 				}
@@ -176,27 +191,30 @@ void UBoardSystemComponent::LoadBoardFromDataTable()
 
 			if (!bFoundFallback)
 			{
-				UE_LOG(LogTemp, Error, TEXT("UBoardSystemComponent::LoadBoardFromDataTable - No valid base found for Player %d!"), i);
+				UE_LOG(LogLairBoard, Error, TEXT("UBoardSystemComponent::LoadBoardFromDataTable - No valid base found for Player %d!"), i);
 			}
 		}
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("UBoardSystemComponent::LoadBoardFromDataTable - Loaded %d tiles from data table"),
+	UE_LOG(LogLairBoard, Log, TEXT("UBoardSystemComponent::LoadBoardFromDataTable - Loaded %d tiles from data table"),
 		AllRows.Num());
 }
 
 ATile* UBoardSystemComponent::SpawnTile(FIntPoint Coord, FName TileTypeID, int32 PlayerBaseIndex)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(UBoardSystemComponent::SpawnTile);
+	LLM_SCOPE_BYTAG(Lair_Tiles);
+
 	if (!TileClass)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UBoardSystemComponent::SpawnTile - TileClass not set, using default ATile"));
+		UE_LOG(LogLairBoard, Warning, TEXT("UBoardSystemComponent::SpawnTile - TileClass not set, using default ATile"));
 		TileClass = ATile::StaticClass();
 	}
 
 	UWorld* World = GetWorld();
 	if (!World)
 	{
-		UE_LOG(LogTemp, Error, TEXT("UBoardSystemComponent::SpawnTile - World is null"));
+		UE_LOG(LogLairBoard, Error, TEXT("UBoardSystemComponent::SpawnTile - World is null"));
 		return nullptr;
 	}
 
@@ -221,19 +239,12 @@ ATile* UBoardSystemComponent::SpawnTile(FIntPoint Coord, FName TileTypeID, int32
 		// Now finish spawning (calls BeginPlay)
 		NewTile->FinishSpawning(FTransform(FRotator::ZeroRotator, WorldPosition));
 
-		// Pass tile type data for DebugColor support (after BeginPlay so DynamicMaterial exists)
-		if (TileTypesDataTable)
-		{
-			FTileTypeData* TileData = TileTypesDataTable->FindRow<FTileTypeData>(TileTypeID, TEXT("SpawnTile"));
-			if (TileData)
-			{
-				NewTile->SetTileTypeData(*TileData);
-			}
-		}
+		// Resolve the tile's type once (after BeginPlay so DynamicMaterial exists for DebugColor)
+		ApplyTileType(NewTile);
 
 		TileGrid.Add(Coord, NewTile);
 
-		UE_LOG(LogTemp, Verbose, TEXT("UBoardSystemComponent::SpawnTile - Spawned tile at (%d, %d) type: %s base: %d"),
+		UE_LOG(LogLairBoard, Verbose, TEXT("UBoardSystemComponent::SpawnTile - Spawned tile at (%d, %d) type: %s base: %d"),
 			Coord.X, Coord.Y, *TileTypeID.ToString(), PlayerBaseIndex);
 	}
 
@@ -242,6 +253,8 @@ ATile* UBoardSystemComponent::SpawnTile(FIntPoint Coord, FName TileTypeID, int32
 
 ATile* UBoardSystemComponent::GetTileAt(FIntPoint Coord) const
 {
+	SCOPE_CYCLE_COUNTER(STAT_LairGetTileAt);
+
 	ATile* const* TilePtr = TileGrid.Find(Coord);
 	if (TilePtr)
 	{
@@ -252,6 +265,8 @@ ATile* UBoardSystemComponent::GetTileAt(FIntPoint Coord) const
 
 TArray<ATile*> UBoardSystemComponent::GetNeighborTiles(ATile* Tile) const
 {
+	SCOPE_CYCLE_COUNTER(STAT_LairGetNeighborTiles);
+
 	TArray<ATile*> Neighbors;
 
 	if (!Tile)
@@ -288,6 +303,8 @@ TArray<ATile*> UBoardSystemComponent::GetNeighborTiles(ATile* Tile) const
 
 int32 UBoardSystemComponent::GetMovementCost(FIntPoint From, FIntPoint To) const
 {
+	SCOPE_CYCLE_COUNTER(STAT_LairGetMovementCost);
+
 	// Check if both coordinates are valid
 	if (!IsValidGridCoord(From) || !IsValidGridCoord(To))
 	{
@@ -320,6 +337,59 @@ int32 UBoardSystemComponent::GetMovementCost(FIntPoint From, FIntPoint To) const
 	return -1;
 }
 
+void UBoardSystemComponent::SetTileType(ATile* Tile, FName TileTypeID)
+{
+	LLM_SCOPE_BYTAG(Lair_Tiles);
+
+	if (!Tile)
+	{
+		return;
+	}
+
+	Tile->TileTypeID = TileTypeID;
+	ApplyTileType(Tile);
+}
+
+void UBoardSystemComponent::RefreshTileTypes(const TArray<FName>& TileTypeIDs)
+{
+	LLM_SCOPE_BYTAG(Lair_Tiles);
+
+	int32 NumRefreshed = 0;
+	for (const auto& Pair : TileGrid)
+	{
+		if (Pair.Value && TileTypeIDs.Contains(Pair.Value->TileTypeID))
+		{
+			ApplyTileType(Pair.Value);
+			++NumRefreshed;
+		}
+	}
+
+	UE_LOG(LogLairBoard, Log, TEXT("UBoardSystemComponent::RefreshTileTypes - Refreshed %d tiles"), NumRefreshed);
+}
+
+const FTileTypeData* UBoardSystemComponent::FindTileTypeData(FName TileTypeID) const
+{
+	// Prefer the rules engine's rows: they survive data table reimports
+	if (RulesEngine)
+	{
+		return RulesEngine->FindTileTypeRow(RulesEngine->FindTileTypeId(TileTypeID));
+	}
+
+	return TileTypesDataTable ? TileTypesDataTable->FindRow<FTileTypeData>(TileTypeID, TEXT("FindTileTypeData")) : nullptr;
+}
+
+void UBoardSystemComponent::ApplyTileType(ATile* Tile)
+{
+	Tile->SetTileTypeData(FindTileTypeData(Tile->TileTypeID));
+
+	// Rule and pathing queries read this byte
+	const int32 TileIndex = GetTileIndex(Tile->GridCoord);
+	if (TileFlags.IsValidIndex(TileIndex))
+	{
+		TileFlags[TileIndex] = ELairTileFlags::Pack(ELairTileFlags::FromTileTypeData(Tile->GetTileTypeData()), Tile->PlayerBaseIndex);
+	}
+}
+
 FIntPoint UBoardSystemComponent::GetPlayerBaseCoord(int32 PlayerIndex) const
 {
 	if (PlayerIndex >= 0 && PlayerIndex < PlayerBaseCoords.Num())
@@ -327,7 +397,7 @@ FIntPoint UBoardSystemComponent::GetPlayerBaseCoord(int32 PlayerIndex) const
 		return PlayerBaseCoords[PlayerIndex];
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("UBoardSystemComponent::GetPlayerBaseCoord - Invalid player index %d"),
+	UE_LOG(LogLairBoard, Warning, TEXT("UBoardSystemComponent::GetPlayerBaseCoord - Invalid player index %d"),
 		PlayerIndex);
 	return FIntPoint::ZeroValue;
 }
@@ -0,0 +1,394 @@
+// CombatOddsComponent.cpp
+// Combat Odds Service (Exact Outcome Distributions)
+
+#include "CombatOddsComponent.h"
+#include "LairLog.h"
+#include "Unit.h"
+#include "Algo/Sort.h"
+
+namespace
+{
+	constexpr int32 DIE_FACES = 6;
+
+	int32 UnpackHP(uint32 Packed) { return static_cast<int32>(Packed & 0xFF); }
+	int32 UnpackDice(uint32 Packed) { return static_cast<int32>((Packed >> 8) & 0xFF); }
+	uint8 UnpackMask(uint32 Packed) { return static_cast<uint8>((Packed >> 16) & 0x3F); }
+
+	/** Expected hits per round, scaled by DIE_FACES to stay integral */
+	int32 ScaledStrength(uint32 Packed)
+	{
+		return UnpackDice(Packed) * static_cast<int32>(FMath::CountBits(UnpackMask(Packed)));
+	}
+
+	/** Per-round hit distributions of one stack for every remaining HP total */
+	struct FStackHitTable
+	{
+		/** Sum of HP across the stack */
+		int32 TotalHP = 0;
+
+		/** [RemainingHP][Hits] = probability of scoring that many hits this round */
+		TArray<TArray<double>> HitsByRemainingHP;
+
+		/** [RemainingHP] = number of units still alive */
+		TArray<int32> AliveByRemainingHP;
+	};
+
+	void BuildHitTable(TConstArrayView<uint32> Stack, FStackHitTable& OutTable)
+	{
+		OutTable.TotalHP = 0;
+		for (uint32 Packed : Stack)
+		{
+			OutTable.TotalHP += UnpackHP(Packed);
+		}
+
+		OutTable.HitsByRemainingHP.SetNum(OutTable.TotalHP + 1);
+		OutTable.AliveByRemainingHP.SetNum(OutTable.TotalHP + 1);
+
+		for (int32 RemainingHP = 0; RemainingHP <= OutTable.TotalHP; ++RemainingHP)
+		{
+			// Casualties are absorbed front to back, so the first units lose HP first
+			const int32 LostHP = OutTable.TotalHP - RemainingHP;
+			int32 AbsorbedHP = 0;
+			int32 Alive = 0;
+
+			TArray<double>& Distribution = OutTable.HitsByRemainingHP[RemainingHP];
+			Distribution.Reset();
+			Distribution.Add(1.0);
+
+			for (uint32 Packed : Stack)
+			{
+				AbsorbedHP += UnpackHP(Packed);
+				if (AbsorbedHP <= LostHP)
+				{
+					continue;
+				}
+
+				++Alive;
+
+				const double HitChance = static_cast<double>(FMath::CountBits(UnpackMask(Packed))) / DIE_FACES;
+				const int32 NumDice = UnpackDice(Packed);
+
+				// Convolve one Bernoulli trial per die
+				for (int32 Die = 0; Die < NumDice; ++Die)
+				{
+					Distribution.Add(0.0);
+					for (int32 Hits = Distribution.Num() - 1; Hits > 0; --Hits)
+					{
+						Distribution[Hits] = Distribution[Hits] * (1.0 - HitChance) + Distribution[Hits - 1] * HitChance;
+					}
+					Distribution[0] *= (1.0 - HitChance);
+				}
+			}
+
+			OutTable.AliveByRemainingHP[RemainingHP] = Alive;
+		}
+	}
+}
+
+// ============================================================================
+// FCombatantProfile
+// ============================================================================
+
+FCombatantProfile FCombatantProfile::FromUnitData(const FUnitData& Data, int32 CurrentHP)
+{
+	FCombatantProfile Profile;
+	Profile.HitPoints = CurrentHP;
+	Profile.NumberOfDice = Data.NumberOfDice;
+	Profile.HitFaceMask = MakeHitFaceMask(Data.AttackDiceValues);
+	return Profile;
+}
+
+FCombatantProfile FCombatantProfile::FromUnit(const AUnit* Unit)
+{
+	if (!Unit)
+	{
+		FCombatantProfile Empty;
+		Empty.HitPoints = 0;
+		return Empty;
+	}
+
+	return FromUnitData(Unit->GetUnitTypeData(), Unit->CurrentHP);
+}
+
+uint8 FCombatantProfile::MakeHitFaceMask(const TArray<int32>& AttackDiceValues)
+{
+	uint8 Mask = 0;
+	for (int32 Face : AttackDiceValues)
+	{
+		if (Face >= 1 && Face <= DIE_FACES)
+		{
+			Mask |= static_cast<uint8>(1 << (Face - 1));
+		}
+	}
+	return Mask;
+}
+
+float FCombatantProfile::GetHitProbability() const
+{
+	return static_cast<float>(FMath::CountBits(HitFaceMask)) / DIE_FACES;
+}
+
+// ============================================================================
+// UCombatOddsComponent
+// ============================================================================
+
+UCombatOddsComponent::UCombatOddsComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+FCombatOdds UCombatOddsComponent::CalculateCombatOdds(const TArray<AUnit*>& Attackers, const TArray<AUnit*>& Defenders) const
+{
+	TArray<FCombatantProfile, TInlineAllocator<8>> AttackerProfiles;
+	for (const AUnit* Unit : Attackers)
+	{
+		if (Unit)
+		{
+			AttackerProfiles.Add(FCombatantProfile::FromUnit(Unit));
+		}
+	}
+
+	TArray<FCombatantProfile, TInlineAllocator<8>> DefenderProfiles;
+	for (const AUnit* Unit : Defenders)
+	{
+		if (Unit)
+		{
+			DefenderProfiles.Add(FCombatantProfile::FromUnit(Unit));
+		}
+	}
+
+	return CalculateOddsForProfiles(AttackerProfiles, DefenderProfiles);
+}
+
+FCombatOdds UCombatOddsComponent::CalculateOddsForProfiles(TConstArrayView<FCombatantProfile> Attackers, TConstArrayView<FCombatantProfile> Defenders) const
+{
+	FStackSignature Signature;
+
+	for (const FCombatantProfile& Profile : Attackers)
+	{
+		if (Profile.HitPoints > 0)
+		{
+			Signature.Packed.Add(PackProfile(Profile));
+		}
+	}
+	Signature.NumAttackers = Signature.Packed.Num();
+
+	for (const FCombatantProfile& Profile : Defenders)
+	{
+		if (Profile.HitPoints > 0)
+		{
+			Signature.Packed.Add(PackProfile(Profile));
+		}
+	}
+
+	const int32 NumDefenders = Signature.Packed.Num() - Signature.NumAttackers;
+	if (Signature.NumAttackers == 0 || NumDefenders == 0)
+	{
+		return FCombatOdds();
+	}
+
+	// Canonical order makes the signature independent of selection order
+	TArrayView<uint32> AttackerView(Signature.Packed.GetData(), Signature.NumAttackers);
+	TArrayView<uint32> DefenderView(Signature.Packed.GetData() + Signature.NumAttackers, NumDefenders);
+	SortCasualtyOrder(AttackerView);
+	SortCasualtyOrder(DefenderView);
+
+	{
+		FReadScopeLock ReadLock(OddsCacheLock);
+		if (const FCombatOdds* Cached = OddsCache.Find(Signature))
+		{
+			return *Cached;
+		}
+	}
+
+	FCombatOdds Odds = SolveOdds(AttackerView, DefenderView);
+
+	{
+		FWriteScopeLock WriteLock(OddsCacheLock);
+		if (OddsCache.Num() >= MaxCachedMatchups)
+		{
+			OddsCache.Reset();
+		}
+		OddsCache.Add(MoveTemp(Signature), Odds);
+	}
+
+	return Odds;
+}
+
+void UCombatOddsComponent::ClearCache()
+{
+	FWriteScopeLock WriteLock(OddsCacheLock);
+	OddsCache.Empty();
+}
+
+int32 UCombatOddsComponent::GetCachedMatchupCount() const
+{
+	FReadScopeLock ReadLock(OddsCacheLock);
+	return OddsCache.Num();
+}
+
+uint32 UCombatOddsComponent::PackProfile(const FCombatantProfile& Profile)
+{
+	const uint32 HP = static_cast<uint32>(FMath::Clamp(Profile.HitPoints, 0, 255));
+	const uint32 Dice = static_cast<uint32>(FMath::Clamp(Profile.NumberOfDice, 0, 255));
+	const uint32 Mask = static_cast<uint32>(Profile.HitFaceMask & 0x3F);
+	return HP | (Dice << 8) | (Mask << 16);
+}
+
+void UCombatOddsComponent::SortCasualtyOrder(TArrayView<uint32> PackedProfiles)
+{
+	Algo::Sort(PackedProfiles, [](uint32 A, uint32 B)
+	{
+		const int32 StrengthA = ScaledStrength(A);
+		const int32 StrengthB = ScaledStrength(B);
+		if (StrengthA != StrengthB)
+		{
+			return StrengthA < StrengthB;
+		}
+		if (UnpackHP(A) != UnpackHP(B))
+		{
+			return UnpackHP(A) < UnpackHP(B);
+		}
+		return A < B;
+	});
+}
+
+FCombatOdds UCombatOddsComponent::SolveOdds(TConstArrayView<uint32> Attackers, TConstArrayView<uint32> Defenders)
+{
+	FStackHitTable AttackerTable;
+	FStackHitTable DefenderTable;
+	BuildHitTable(Attackers, AttackerTable);
+	BuildHitTable(Defenders, DefenderTable);
+
+	const int32 AttackerHP = AttackerTable.TotalHP;
+	const int32 DefenderHP = DefenderTable.TotalHP;
+	const int32 Stride = DefenderHP + 1;
+
+	// Probability mass over (attacker HP, defender HP); every round strictly reduces
+	// at least one side, so processing both axes in descending order visits each
+	// state only after all of its predecessors
+	TArray<double> Mass;
+	Mass.SetNumZeroed((AttackerHP + 1) * Stride);
+	Mass[AttackerHP * Stride + DefenderHP] = 1.0;
+
+	double AttackerWin = 0.0;
+	double DefenderWin = 0.0;
+	double Mutual = 0.0;
+	double Stalemate = 0.0;
+	double AttackerSurvivors = 0.0;
+	double DefenderSurvivors = 0.0;
+	TArray<double> AttackerRemaining;
+	TArray<double> DefenderRemaining;
+	AttackerRemaining.SetNumZeroed(AttackerHP + 1);
+	DefenderRemaining.SetNumZeroed(DefenderHP + 1);
+
+	auto RecordOutcome = [&](int32 A, int32 D, double P)
+	{
+		AttackerRemaining[A] += P;
+		DefenderRemaining[D] += P;
+		AttackerSurvivors += P * AttackerTable.AliveByRemainingHP[A];
+		DefenderSurvivors += P * DefenderTable.AliveByRemainingHP[D];
+	};
+
+	for (int32 A = AttackerHP; A > 0; --A)
+	{
+		const TArray<double>& AttackerHits = AttackerTable.HitsByRemainingHP[A];
+
+		for (int32 D = DefenderHP; D > 0; --D)
+		{
+			const double P = Mass[A * Stride + D];
+			if (P <= 0.0)
+			{
+				continue;
+			}
+
+			const TArray<double>& DefenderHits = DefenderTable.HitsByRemainingHP[D];
+
+			// Rounds where nobody hits just repeat; condition them away
+			const double NoHits = AttackerHits[0] * DefenderHits[0];
+			if (NoHits >= 1.0 - UE_DOUBLE_KINDA_SMALL_NUMBER)
+			{
+				Stalemate += P;
+				RecordOutcome(A, D, P);
+				continue;
+			}
+
+			const double Scale = P / (1.0 - NoHits);
+
+			for (int32 Dealt = 0; Dealt < AttackerHits.Num(); ++Dealt)
+			{
+				const double PDealt = AttackerHits[Dealt] * Scale;
+				if (PDealt <= 0.0)
+				{
+					continue;
+				}
+
+				const int32 NextD = FMath::Max(0, D - Dealt);
+
+				for (int32 Taken = (Dealt == 0) ? 1 : 0; Taken < DefenderHits.Num(); ++Taken)
+				{
+					const int32 NextA = FMath::Max(0, A - Taken);
+					Mass[NextA * Stride + NextD] += PDealt * DefenderHits[Taken];
+				}
+			}
+		}
+	}
+
+	// Collect terminal states (either stack eliminated)
+	for (int32 A = 0; A <= AttackerHP; ++A)
+	{
+		for (int32 D = 0; D <= DefenderHP; ++D)
+		{
+			if (A > 0 && D > 0)
+			{
+				continue;
+			}
+
+			const double P = Mass[A * Stride + D];
+			if (P <= 0.0)
+			{
+				continue;
+			}
+
+			RecordOutcome(A, D, P);
+
+			if (A > 0)
+			{
+				AttackerWin += P;
+			}
+			else if (D > 0)
+			{
+				DefenderWin += P;
+			}
+			else
+			{
+				Mutual += P;
+			}
+		}
+	}
+
+	FCombatOdds Odds;
+	Odds.AttackerWinProbability = static_cast<float>(AttackerWin);
+	Odds.DefenderWinProbability = static_cast<float>(DefenderWin);
+	Odds.MutualDestructionProbability = static_cast<float>(Mutual);
+	Odds.StalemateProbability = static_cast<float>(Stalemate);
+	Odds.ExpectedAttackerSurvivors = static_cast<float>(AttackerSurvivors);
+	Odds.ExpectedDefenderSurvivors = static_cast<float>(DefenderSurvivors);
+
+	Odds.AttackerRemainingHP.SetNumUninitialized(AttackerHP + 1);
+	for (int32 A = 0; A <= AttackerHP; ++A)
+	{
+		Odds.AttackerRemainingHP[A] = static_cast<float>(AttackerRemaining[A]);
+	}
+
+	Odds.DefenderRemainingHP.SetNumUninitialized(DefenderHP + 1);
+	for (int32 D = 0; D <= DefenderHP; ++D)
+	{
+		Odds.DefenderRemainingHP[D] = static_cast<float>(DefenderRemaining[D]);
+	}
+
+	UE_LOG(LogLairRules, Verbose, TEXT("UCombatOddsComponent::SolveOdds - %d HP vs %d HP: attacker %.3f, defender %.3f"),
+		AttackerHP, DefenderHP, Odds.AttackerWinProbability, Odds.DefenderWinProbability);
+
+	return Odds;
+}
@@ -0,0 +1,198 @@
+// LairAIComponent.cpp
+// AI Component (Background Turn Planning)
+
+#include "LairAIComponent.h"
+#include "LairLog.h"
+#include "LairMemory.h"
+#include "LairAIPolicy.h"
+#include "LairTranspositionTable.h"
+#include "Async/Async.h"
+
+namespace
+{
+	/** Safety cap on commands planned for a single turn */
+	constexpr int32 MAX_COMMANDS_PER_TURN = 1024;
+}
+
+ULairAIComponent::ULairAIComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+
+	// Phase 1 hotseat: every player is human unless config or ?AI= assigns a policy
+	PlayerPolicies = { NAME_None, NAME_None };
+}
+
+void ULairAIComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	CancelThinking();
+
+	// Cancellation is cooperative, so this returns as soon as the policy's current step does
+	ActiveTask.Wait();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+bool ULairAIComponent::IsAIPlayer(int32 PlayerIndex) const
+{
+	return PlayerPolicies.IsValidIndex(PlayerIndex) && !PlayerPolicies[PlayerIndex].IsNone();
+}
+
+void ULairAIComponent::SetPlayerPolicy(int32 PlayerIndex, FName PolicyName)
+{
+	if (PlayerIndex < 0)
+	{
+		return;
+	}
+
+	if (!PolicyName.IsNone() && !FLairAIPolicyRegistry::Get().CreatePolicy(PolicyName))
+	{
+		UE_LOG(LogLair, Warning, TEXT("ULairAIComponent::SetPlayerPolicy - Unknown policy %s, player %d stays human"),
+			*PolicyName.ToString(), PlayerIndex);
+		PolicyName = NAME_None;
+	}
+
+	if (PlayerPolicies.Num() <= PlayerIndex)
+	{
+		PlayerPolicies.SetNum(PlayerIndex + 1);
+	}
+	PlayerPolicies[PlayerIndex] = PolicyName;
+
+	UE_LOG(LogLair, Log, TEXT("ULairAIComponent::SetPlayerPolicy - Player %d: %s"),
+		PlayerIndex, PolicyName.IsNone() ? TEXT("human") : *PolicyName.ToString());
+}
+
+bool ULairAIComponent::StartThinking(const FLairMatchState& Snapshot, uint64 PolicySeed)
+{
+	LLM_SCOPE_BYTAG(Lair_AI);
+
+	check(IsInGameThread());
+
+	const int32 PlayerIndex = Snapshot.CurrentPlayerIndex;
+	if (!IsAIPlayer(PlayerIndex) || Snapshot.bGameOver)
+	{
+		return false;
+	}
+
+	CancelThinking();
+
+	if (!TranspositionTable.IsValid())
+	{
+		TranspositionTable = MakeShared<FLairTranspositionTable, ESPMode::ThreadSafe>();
+		TranspositionTable->Resize(TranspositionTableSizeMB);
+	}
+
+	TSharedPtr<FThinkJob, ESPMode::ThreadSafe> Job = MakeShared<FThinkJob, ESPMode::ThreadSafe>();
+	Job->Snapshot = Snapshot;
+	Job->PolicyName = PlayerPolicies[PlayerIndex];
+	Job->PolicySeed = PolicySeed;
+	Job->BudgetSeconds = FMath::Max(ThinkBudgetSeconds, 0.01f);
+	Job->bFixedIterations = bDeterministicSearch;
+	Job->TranspositionTable = TranspositionTable;
+	ActiveJob = Job;
+
+	UE_LOG(LogLair, Log, TEXT("ULairAIComponent::StartThinking - Player %d (%s), budget %.2fs"),
+		PlayerIndex, *Job->PolicyName.ToString(), Job->BudgetSeconds);
+
+	TWeakObjectPtr<ULairAIComponent> WeakThis(this);
+	ActiveTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis, Job]()
+	{
+		PlanTurn(*Job);
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Job]()
+		{
+			if (ULairAIComponent* StrongThis = WeakThis.Get())
+			{
+				StrongThis->HandleJobFinished(Job);
+			}
+		});
+	});
+
+	return true;
+}
+
+void ULairAIComponent::CancelThinking()
+{
+	if (ActiveJob.IsValid())
+	{
+		ActiveJob->bCancelled.store(true, std::memory_order_relaxed);
+		ActiveJob.Reset();
+
+		UE_LOG(LogLair, Log, TEXT("ULairAIComponent::CancelThinking - Discarded turn in progress"));
+	}
+}
+
+float ULairAIComponent::GetTranspositionHitRate() const
+{
+	return TranspositionTable.IsValid() ? static_cast<float>(TranspositionTable->GetHitRate()) : 0.0f;
+}
+
+void ULairAIComponent::PlanTurn(FThinkJob& Job)
+{
+	LLM_SCOPE_BYTAG(Lair_AI);
+
+	TUniquePtr<ILairAIPolicy> Policy = FLairAIPolicyRegistry::Get().CreatePolicy(Job.PolicyName);
+	if (!Policy)
+	{
+		UE_LOG(LogLair, Warning, TEXT("ULairAIComponent::PlanTurn - Unknown policy %s, ending turn"), *Job.PolicyName.ToString());
+		Job.Commands.Add(FLairCommand::MakeSimple(ELairCommandType::EndTurn, Job.Snapshot.CurrentPlayerIndex));
+		return;
+	}
+
+	FLairMatchState& State = Job.Snapshot;
+	const int32 PlayerIndex = State.CurrentPlayerIndex;
+
+	FLairRandomStream PolicyStream;
+	PolicyStream.Seed(Job.PolicySeed);
+
+	FLairAIContext Context;
+	Context.PlayerIndex = PlayerIndex;
+	Context.Random = &PolicyStream;
+	Context.DeadlineSeconds = FPlatformTime::Seconds() + Job.BudgetSeconds;
+	Context.bFixedIterations = Job.bFixedIterations;
+	Context.CancelFlag = &Job.bCancelled;
+	Context.TranspositionTable = Job.TranspositionTable.Get();
+
+	// Play the turn forward on the snapshot until control passes to the next player
+	while (!State.bGameOver && State.CurrentPlayerIndex == PlayerIndex && Job.Commands.Num() < MAX_COMMANDS_PER_TURN)
+	{
+		if (Context.ShouldStop())
+		{
+			// Cancelled (or out of time): keep what was planned and end the turn
+			Job.Commands.Add(FLairCommand::MakeSimple(ELairCommandType::EndTurn, PlayerIndex));
+			return;
+		}
+
+		const FLairCommand Command = Policy->ChooseCommand(State, Context);
+		if (!State.ApplyCommand(Command))
+		{
+			Job.Commands.Add(FLairCommand::MakeSimple(ELairCommandType::EndTurn, PlayerIndex));
+			return;
+		}
+
+		Job.Commands.Add(Command);
+	}
+
+	if (!State.bGameOver && State.CurrentPlayerIndex == PlayerIndex)
+	{
+		Job.Commands.Add(FLairCommand::MakeSimple(ELairCommandType::EndTurn, PlayerIndex));
+	}
+}
+
+void ULairAIComponent::HandleJobFinished(const TSharedPtr<FThinkJob, ESPMode::ThreadSafe>& Job)
+{
+	// Superseded or cancelled jobs are dropped
+	if (Job != ActiveJob || Job->bCancelled.load(std::memory_order_relaxed))
+	{
+		return;
+	}
+
+	ActiveJob.Reset();
+
+	// The snapshot has been played forward; report the player who was planning
+	const int32 PlayerIndex = Job->Commands.Num() > 0 ? Job->Commands[0].PlayerIndex : INDEX_NONE;
+
+	UE_LOG(LogLair, Log, TEXT("ULairAIComponent::HandleJobFinished - Player %d planned %d commands (TT hit rate %.1f%%)"),
+		PlayerIndex, Job->Commands.Num(), GetTranspositionHitRate() * 100.0f);
+
+	OnTurnPlannedNative.Broadcast(PlayerIndex, Job->Commands);
+}
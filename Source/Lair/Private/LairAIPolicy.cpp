@@ -0,0 +1,371 @@
+// LairAIPolicy.cpp
+// AI Policies (Headless Decision Making)
+
+#include "LairAIPolicy.h"
+#include "LairTranspositionTable.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	/**
+	 * Uniform random choice among legal commands.
+	 */
+	class FRandomPolicy : public ILairAIPolicy
+	{
+	public:
+		virtual FLairCommand ChooseCommand(const FLairMatchState& State, FLairAIContext& Context) override
+		{
+			Commands.Reset();
+			State.GetLegalCommands(Commands);
+			check(Commands.Num() > 0);
+
+			return Context.Random ? Commands[Context.Random->NextBounded(Commands.Num())] : Commands[0];
+		}
+
+		virtual FName GetPolicyName() const override { return FName("Random"); }
+
+	private:
+		TArray<FLairCommand> Commands;
+	};
+
+	/**
+	 * Economy heuristic: buy the cheapest miner, mine every turn, walk toward the nearest mine.
+	 */
+	class FGreedyPolicy : public ILairAIPolicy
+	{
+	public:
+		virtual FLairCommand ChooseCommand(const FLairMatchState& State, FLairAIContext& Context) override
+		{
+			Commands.Reset();
+			State.GetLegalCommands(Commands);
+			check(Commands.Num() > 0);
+
+			const FLairMatchRules& Rules = *State.Rules;
+
+			const FLairCommand* Best = nullptr;
+			int32 BestScore = 0;
+
+			for (const FLairCommand& Command : Commands)
+			{
+				int32 Score = 0;
+				switch (Command.Type)
+				{
+				case ELairCommandType::Purchase:
+				{
+					// Prefer miners; keep enough gold to buy another next turn
+					const FLairUnitTypeStats& Stats = Rules.UnitTypes[Command.UnitType];
+					Score = Stats.bCanMine ? 100 - Stats.Cost / 10 : 0;
+					break;
+				}
+
+				case ELairCommandType::Mine:
+					Score = 1000;
+					break;
+
+				case ELairCommandType::Move:
+				{
+					// Score by progress toward the nearest mine; miners already on a mine stay put
+					const FLairSimUnit& Unit = State.Units[Command.UnitIndex];
+					const int32 Before = Rules.MineDistance[Unit.TileIndex];
+					const int32 After = Rules.MineDistance[Command.TargetTile];
+					if (Rules.UnitTypes[Unit.TypeIndex].bCanMine && Before > 0 && After < Before)
+					{
+						Score = 50 + (Before - After) * 10;
+					}
+					break;
+				}
+
+				default:
+					break;
+				}
+
+				// Small random tiebreak so mirrored games do not replay identically
+				if (Score > 0 && Context.Random)
+				{
+					Score = Score * 4 + static_cast<int32>(Context.Random->NextBounded(4));
+				}
+
+				if (Score > BestScore)
+				{
+					BestScore = Score;
+					Best = &Command;
+				}
+			}
+
+			if (Best)
+			{
+				return *Best;
+			}
+
+			// Nothing useful in this phase: move on
+			return FLairCommand::MakeSimple(ELairCommandType::AdvancePhase, Context.PlayerIndex);
+		}
+
+		virtual FName GetPolicyName() const override { return FName("Greedy"); }
+
+	private:
+		TArray<FLairCommand> Commands;
+	};
+
+	/**
+	 * Flat Monte Carlo search: a fixed number of search slices run in parallel, each
+	 * picking legal commands by UCB1 and playing them out with a noisy greedy policy.
+	 * Slices start from the statistics cached in the transposition table and keep their
+	 * own counts, which are merged in slice order after the join, so a seeded search
+	 * picks the same command however the slices were scheduled.
+	 */
+	class FRolloutPolicy : public ILairAIPolicy
+	{
+	public:
+		/** Commands played per rollout */
+		static constexpr int32 ROLLOUT_DEPTH = 48;
+
+		/** Iterations per decision (an unseeded caller's deadline may stop it sooner) */
+		static constexpr int32 MAX_ITERATIONS = 512;
+
+		/** Independent search slices (fixed, so results do not depend on the machine's core count) */
+		static constexpr int32 NUM_SLICES = 8;
+
+		/** UCB1 exploration constant */
+		static constexpr float EXPLORATION = 1.2f;
+
+		/** Chance of a uniformly random command during a rollout */
+		static constexpr uint32 RANDOM_MOVE_PERCENT = 20;
+
+		virtual FLairCommand ChooseCommand(const FLairMatchState& State, FLairAIContext& Context) override
+		{
+			TArray<FLairCommand> Commands;
+			State.GetLegalCommands(Commands);
+			check(Commands.Num() > 0);
+
+			if (Commands.Num() == 1)
+			{
+				return Commands[0];
+			}
+
+			FLairTranspositionTable* Table = Context.TranspositionTable;
+			if (!Table)
+			{
+				if (!LocalTable)
+				{
+					LocalTable = MakeUnique<FLairTranspositionTable>();
+					LocalTable->Resize(4);
+				}
+				Table = LocalTable.Get();
+			}
+			Table->NewSearch();
+
+			// Keys are salted with the searching player, since values are from their point of view
+			const int32 RootPlayer = Context.PlayerIndex;
+			const uint64 PlayerSalt = static_cast<uint64>(RootPlayer + 1) * 0x9E3779B97F4A7C15ull;
+
+			TArray<FLairMatchState> Children;
+			TArray<uint64> ChildKeys;
+			TArray<FChildStats> Totals;
+			Children.SetNum(Commands.Num());
+			ChildKeys.SetNum(Commands.Num());
+			Totals.SetNum(Commands.Num());
+			for (int32 i = 0; i < Commands.Num(); ++i)
+			{
+				Children[i] = State;
+				Children[i].ApplyCommand(Commands[i]);
+				ChildKeys[i] = Children[i].ComputeHash() ^ PlayerSalt;
+
+				// Earlier searches of the same position seed every slice alike
+				FLairTTEntry Entry;
+				if (Table->Probe(ChildKeys[i], Entry))
+				{
+					Totals[i].Visits = Entry.Visits;
+					Totals[i].ValueSum = static_cast<double>(Entry.Value) * Entry.Visits;
+				}
+			}
+			const TArray<FChildStats> Priors = Totals;
+
+			const int32 IterationsPerSlice = FMath::DivideAndRoundUp(MAX_ITERATIONS, NUM_SLICES);
+
+			uint64 SliceSeeds[NUM_SLICES];
+			for (int32 Slice = 0; Slice < NUM_SLICES; ++Slice)
+			{
+				SliceSeeds[Slice] = Context.Random ? Context.Random->Next() : static_cast<uint64>(Slice + 1);
+			}
+
+			TArray<TArray<FChildStats>> SliceStats;
+			SliceStats.SetNum(NUM_SLICES);
+
+			ParallelFor(NUM_SLICES, [&](int32 Slice)
+			{
+				FLairRandomStream Stream;
+				Stream.Seed(SliceSeeds[Slice]);
+				FGreedyPolicy RolloutPolicy;
+
+				TArray<FChildStats>& Stats = SliceStats[Slice];
+				Stats.SetNum(Priors.Num());
+
+				for (int32 Iteration = 0; Iteration < IterationsPerSlice && !Context.ShouldStop(); ++Iteration)
+				{
+					const int32 ChildIndex = SelectChild(Priors, Stats);
+					Stats[ChildIndex].ValueSum += Rollout(Children[ChildIndex], RootPlayer, Stream, RolloutPolicy);
+					Stats[ChildIndex].Visits++;
+				}
+			});
+
+			// Merge in slice order, then cache the totals for later decisions
+			for (const TArray<FChildStats>& Stats : SliceStats)
+			{
+				for (int32 i = 0; i < Totals.Num(); ++i)
+				{
+					Totals[i].ValueSum += Stats[i].ValueSum;
+					Totals[i].Visits += Stats[i].Visits;
+				}
+			}
+
+			// Most visited command wins (lowest index on ties)
+			int32 BestIndex = 0;
+			for (int32 i = 0; i < Totals.Num(); ++i)
+			{
+				if (Totals[i].Visits > 0)
+				{
+					FLairTTEntry Entry;
+					Entry.Value = static_cast<float>(Totals[i].ValueSum / Totals[i].Visits);
+					Entry.Visits = static_cast<uint16>(FMath::Min(Totals[i].Visits, static_cast<int32>(MAX_uint16)));
+					Entry.Depth = ROLLOUT_DEPTH;
+					Table->Store(ChildKeys[i], Entry);
+				}
+
+				if (Totals[i].Visits > Totals[BestIndex].Visits)
+				{
+					BestIndex = i;
+				}
+			}
+
+			return Commands[BestIndex];
+		}
+
+		virtual FName GetPolicyName() const override { return FName("Rollout"); }
+
+	private:
+		/** Sample count and value sum of one child */
+		struct FChildStats
+		{
+			double ValueSum = 0.0;
+			int32 Visits = 0;
+		};
+
+		/** Table used when the caller does not share one */
+		TUniquePtr<FLairTranspositionTable> LocalTable;
+
+		/** Pick the child with the best UCB1 score over cached plus this slice's samples (unvisited children first) */
+		static int32 SelectChild(const TArray<FChildStats>& Priors, const TArray<FChildStats>& Stats)
+		{
+			double TotalVisits = 1.0;
+			for (int32 i = 0; i < Stats.Num(); ++i)
+			{
+				const int32 Visits = Priors[i].Visits + Stats[i].Visits;
+				if (Visits == 0)
+				{
+					return i;
+				}
+				TotalVisits += Visits;
+			}
+
+			const double LogTotal = FMath::Loge(TotalVisits);
+			int32 BestIndex = 0;
+			double BestScore = -MAX_dbl;
+			for (int32 i = 0; i < Stats.Num(); ++i)
+			{
+				const double Visits = Priors[i].Visits + Stats[i].Visits;
+				const double Value = (Priors[i].ValueSum + Stats[i].ValueSum) / Visits;
+				const double Score = Value + EXPLORATION * FMath::Sqrt(LogTotal / Visits);
+				if (Score > BestScore)
+				{
+					BestScore = Score;
+					BestIndex = i;
+				}
+			}
+			return BestIndex;
+		}
+
+		/** Play a copy of the state forward and score it for the root player in [-1, 1] */
+		static float Rollout(const FLairMatchState& Start, int32 RootPlayer, FLairRandomStream& Stream, FGreedyPolicy& RolloutPolicy)
+		{
+			FLairMatchState State = Start;
+			TArray<FLairCommand> Commands;
+
+			for (int32 Step = 0; Step < ROLLOUT_DEPTH && !State.bGameOver; ++Step)
+			{
+				FLairAIContext RolloutContext;
+				RolloutContext.PlayerIndex = State.CurrentPlayerIndex;
+				RolloutContext.Random = &Stream;
+
+				FLairCommand Command;
+				if (Stream.NextBounded(100) < RANDOM_MOVE_PERCENT)
+				{
+					Commands.Reset();
+					State.GetLegalCommands(Commands);
+					Command = Commands[Stream.NextBounded(Commands.Num())];
+				}
+				else
+				{
+					Command = RolloutPolicy.ChooseCommand(State, RolloutContext);
+				}
+
+				State.ApplyCommand(Command);
+			}
+
+			if (State.WinnerIndex != INDEX_NONE)
+			{
+				return State.WinnerIndex == RootPlayer ? 1.0f : -1.0f;
+			}
+
+			// Material: gold plus what the units cost
+			int32 Material = 0;
+			for (int32 PlayerIndex = 0; PlayerIndex < State.Gold.Num(); ++PlayerIndex)
+			{
+				Material += (PlayerIndex == RootPlayer ? 1 : -1) * State.Gold[PlayerIndex];
+			}
+			for (const FLairSimUnit& Unit : State.Units)
+			{
+				if (Unit.OwnerIndex != INDEX_NONE)
+				{
+					Material += (Unit.OwnerIndex == RootPlayer ? 1 : -1) * State.Rules->UnitTypes[Unit.TypeIndex].Cost;
+				}
+			}
+
+			return FMath::Clamp(static_cast<float>(Material) / 500.0f, -1.0f, 1.0f);
+		}
+	};
+}
+
+FLairAIPolicyRegistry& FLairAIPolicyRegistry::Get()
+{
+	static FLairAIPolicyRegistry Registry;
+	return Registry;
+}
+
+FLairAIPolicyRegistry::FLairAIPolicyRegistry()
+{
+	RegisterPolicy(FName("Random"), []() -> TUniquePtr<ILairAIPolicy> { return MakeUnique<FRandomPolicy>(); });
+	RegisterPolicy(FName("Greedy"), []() -> TUniquePtr<ILairAIPolicy> { return MakeUnique<FGreedyPolicy>(); });
+	RegisterPolicy(FName("Rollout"), []() -> TUniquePtr<ILairAIPolicy> { return MakeUnique<FRolloutPolicy>(); });
+}
+
+void FLairAIPolicyRegistry::RegisterPolicy(FName PolicyName, FFactory Factory)
+{
+	FWriteScopeLock WriteLock(FactoriesLock);
+	Factories.Add(PolicyName, MoveTemp(Factory));
+}
+
+TUniquePtr<ILairAIPolicy> FLairAIPolicyRegistry::CreatePolicy(FName PolicyName) const
+{
+	FReadScopeLock ReadLock(FactoriesLock);
+	const FFactory* Factory = Factories.Find(PolicyName);
+	return Factory ? (*Factory)() : nullptr;
+}
+
+TArray<FName> FLairAIPolicyRegistry::GetPolicyNames() const
+{
+	FReadScopeLock ReadLock(FactoriesLock);
+	TArray<FName> Names;
+	Factories.GetKeys(Names);
+	return Names;
+}
@@ -0,0 +1,348 @@
+// LairBenchmark.cpp
+// Benchmark Cases (Performance Regression Checks)
+
+#include "LairBenchmark.h"
+#include "LairLog.h"
+#include "LairGameMode.h"
+#include "LairPlayerState.h"
+#include "BoardSystemComponent.h"
+#include "RulesEngineComponent.h"
+#include "TurnManagerComponent.h"
+#include "Tile.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+#include "Dom/JsonObject.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Misc/FileHelper.h"
+
+namespace
+{
+	/** Purchases per sample of the purchase case */
+	const int32 PURCHASES_PER_SAMPLE = 100;
+
+	/** Milliseconds since a FPlatformTime::Cycles64 stamp */
+	double MillisecondsSince(uint64 StartCycles)
+	{
+		return FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+	}
+
+	/** Create and register a standalone component on a host actor */
+	template <typename T>
+	T* AddHostComponent(AActor* Host)
+	{
+		T* Component = NewObject<T>(Host);
+		Component->RegisterComponent();
+		return Component;
+	}
+}
+
+FLairBenchmark::FLairBenchmark(const FLairBenchmarkSettings& InSettings)
+	: Settings(InSettings)
+	, QueryStream(1)
+{
+	// Hot-path logging would dominate the timings; keep what Test builds compile in
+	FLogCategoryBase* HotCategories[] = { &LogLairBoard, &LogLairTurn, &LogLairRules, &LogLairEconomy, &LogLairInput };
+	for (FLogCategoryBase* Category : HotCategories)
+	{
+		SavedVerbosities.Emplace(Category, Category->GetVerbosity());
+		Category->SetVerbosity(ELogVerbosity::Warning);
+	}
+
+	// Throwaway game world; actors spawned once it has begun play run BeginPlay as in a match
+	World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("LairBenchmark"));
+	World->AddToRoot();
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+	World->InitializeActorsForPlay(FURL());
+	World->GetWorldSettings()->NotifyBeginPlay();
+
+	// Standalone board, rules and turn components on one host actor
+	Host = World->SpawnActor<AActor>();
+	RulesEngine = AddHostComponent<URulesEngineComponent>(Host);
+	Board = AddHostComponent<UBoardSystemComponent>(Host);
+	TurnManager = AddHostComponent<UTurnManagerComponent>(Host);
+	RulesEngine->Initialize(nullptr, nullptr);
+	RulesEngine->SetBoardSystem(Board);
+	Board->SetRulesEngine(RulesEngine);
+}
+
+FLairBenchmark::~FLairBenchmark()
+{
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+	World->RemoveFromRoot();
+
+	for (const TPair<FLogCategoryBase*, ELogVerbosity::Type>& Saved : SavedVerbosities)
+	{
+		Saved.Key->SetVerbosity(Saved.Value);
+	}
+}
+
+// ============================================================================
+// Cases
+// ============================================================================
+
+void FLairBenchmark::RunBoardCases(int32 BoardSize)
+{
+	const FString Suffix = FString::Printf(TEXT("/%dx%d"), BoardSize, BoardSize);
+	Board->SetDefaultBoardSize(FIntPoint(BoardSize, BoardSize));
+
+	UBoardSystemComponent* const BoardSystem = Board;
+	RunCase(TEXT("Board.InitializeBoard") + Suffix, [BoardSystem]()
+	{
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		BoardSystem->InitializeBoard(FString());
+		return MillisecondsSince(StartCycles);
+	});
+
+	// Every sample runs the same queries
+	TArray<FIntPoint> Coords;
+	TArray<ATile*> Tiles;
+	Coords.Reserve(Settings.NumQueries);
+	Tiles.Reserve(Settings.NumQueries);
+	for (int32 Query = 0; Query < Settings.NumQueries; ++Query)
+	{
+		const FIntPoint Coord(QueryStream.RandRange(0, BoardSize - 1), QueryStream.RandRange(0, BoardSize - 1));
+		Coords.Add(Coord);
+		Tiles.Add(Board->GetTileAt(Coord));
+	}
+
+	RunCase(TEXT("Board.GetTileAt") + Suffix, [BoardSystem, &Coords]()
+	{
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		for (const FIntPoint& Coord : Coords)
+		{
+			BoardSystem->GetTileAt(Coord);
+		}
+		return MillisecondsSince(StartCycles);
+	});
+
+	RunCase(TEXT("Board.GetNeighborTiles") + Suffix, [BoardSystem, &Tiles]()
+	{
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		for (ATile* Tile : Tiles)
+		{
+			BoardSystem->GetNeighborTiles(Tile);
+		}
+		return MillisecondsSince(StartCycles);
+	});
+
+	URulesEngineComponent* const Rules = RulesEngine;
+	RunCase(TEXT("Rules.TileChecks") + Suffix, [Rules, &Tiles]()
+	{
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		for (ATile* Tile : Tiles)
+		{
+			Rules->IsTileWalkable(Tile);
+			Rules->CanSpawnUnitAt(Tile, 1);
+		}
+		return MillisecondsSince(StartCycles);
+	});
+
+	// Reclaim the destroyed tiles before the next size
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+}
+
+void FLairBenchmark::RunTurnCases()
+{
+	UTurnManagerComponent* const Turns = TurnManager;
+	const int32 NumCycles = Settings.NumCycles;
+	RunCase(TEXT("TurnManager.PhaseCycles"), [Turns, NumCycles]()
+	{
+		Turns->SetTotalPlayers(2);
+		Turns->StartFirstTurn();
+
+		// One cycle is every player through every phase; the cap guards against a stuck phase
+		const int32 EndTurn = Turns->GetTurnNumber() + NumCycles;
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		for (int32 Step = 0; Step < NumCycles * 64 && Turns->GetTurnNumber() < EndTurn; ++Step)
+		{
+			Turns->AdvancePhase();
+		}
+		return MillisecondsSince(StartCycles);
+	});
+}
+
+bool FLairBenchmark::RunPurchaseCases()
+{
+	// Full match through the game mode (default board, default rules)
+	if (!GameMode)
+	{
+		GameMode = World->SpawnActor<ALairGameMode>();
+	}
+
+	const TArray<FName> UnitTypes = GameMode && GameMode->GetRulesEngine() ? GameMode->GetRulesEngine()->GetAllUnitTypes() : TArray<FName>();
+	if (UnitTypes.Num() == 0)
+	{
+		UE_LOG(LogLair, Error, TEXT("FLairBenchmark::RunPurchaseCases - Game mode has no unit types, purchase case skipped"));
+		return false;
+	}
+
+	ALairGameMode* const Mode = GameMode;
+	RunCase(FString::Printf(TEXT("GameMode.PurchaseUnit x%d"), PURCHASES_PER_SAMPLE), [Mode, &UnitTypes]()
+	{
+		Mode->StartGame();
+		const int32 Player = Mode->GetTurnManager()->GetCurrentPlayerIndex();
+		ALairPlayerState* PlayerState = Mode->GetPlayerState(Player);
+
+		double TotalMs = 0.0;
+		for (int32 Purchase = 0; Purchase < PURCHASES_PER_SAMPLE; ++Purchase)
+		{
+			if (PlayerState)
+			{
+				PlayerState->SetGold(LairConstants::STARTING_GOLD * 100);
+			}
+
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			const bool bPurchased = Mode->PurchaseUnit(Player, UnitTypes[Purchase % UnitTypes.Num()]);
+			TotalMs += MillisecondsSince(StartCycles);
+
+			// Undo (untimed) frees the base so every purchase takes the full path
+			if (bPurchased)
+			{
+				Mode->Undo();
+			}
+		}
+		return TotalMs;
+	});
+
+	return true;
+}
+
+void FLairBenchmark::RunCase(const FString& Name, TFunctionRef<double()> TakeSample)
+{
+	TArray<double> SamplesMs;
+	SamplesMs.Reserve(Settings.NumSamples);
+	for (int32 Sample = 0; Sample < Settings.NumSamples; ++Sample)
+	{
+		SamplesMs.Add(TakeSample());
+	}
+
+	const FLairBenchmarkResult& Result = Results.Add_GetRef(Summarize(Name, MoveTemp(SamplesMs)));
+	UE_LOG(LogLair, Display, TEXT("  %-32s median %10.3f ms  p95 %10.3f ms  min %10.3f ms"),
+		*Result.Name, Result.MedianMs, Result.P95Ms, Result.MinMs);
+}
+
+// ============================================================================
+// Results
+// ============================================================================
+
+int32 FLairBenchmark::CompareToBaseline(const TMap<FString, double>& BaselineMedians)
+{
+	int32 NumRegressed = 0;
+	for (FLairBenchmarkResult& Result : Results)
+	{
+		if (const double* BaselineMs = BaselineMedians.Find(Result.Name))
+		{
+			Result.BaselineMedianMs = *BaselineMs;
+			Result.bRegressed = Result.MedianMs > *BaselineMs * (1.0 + Settings.Margin);
+			if (Result.bRegressed)
+			{
+				NumRegressed++;
+				UE_LOG(LogLair, Error, TEXT("FLairBenchmark::CompareToBaseline - %s regressed: median %.3f ms, baseline %.3f ms (+%.0f%% allowed)"),
+					*Result.Name, Result.MedianMs, *BaselineMs, Settings.Margin * 100.0);
+			}
+		}
+	}
+	return NumRegressed;
+}
+
+bool FLairBenchmark::WriteReport(const FString& FilePath, const FString& BaselinePath) const
+{
+	int32 NumRegressed = 0;
+	for (const FLairBenchmarkResult& Result : Results)
+	{
+		NumRegressed += Result.bRegressed ? 1 : 0;
+	}
+
+	FString Report;
+	const TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> Writer =
+		TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&Report);
+
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("samples"), Settings.NumSamples);
+	Writer->WriteValue(TEXT("queries"), Settings.NumQueries);
+	Writer->WriteValue(TEXT("cycles"), Settings.NumCycles);
+	Writer->WriteValue(TEXT("margin"), Settings.Margin);
+	Writer->WriteValue(TEXT("baseline"), BaselinePath);
+	Writer->WriteValue(TEXT("regressions"), NumRegressed);
+
+	Writer->WriteArrayStart(TEXT("cases"));
+	for (const FLairBenchmarkResult& Result : Results)
+	{
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("name"), Result.Name);
+		Writer->WriteValue(TEXT("samples"), Result.NumSamples);
+		Writer->WriteValue(TEXT("medianMs"), Result.MedianMs);
+		Writer->WriteValue(TEXT("p95Ms"), Result.P95Ms);
+		Writer->WriteValue(TEXT("minMs"), Result.MinMs);
+		if (Result.BaselineMedianMs >= 0.0)
+		{
+			Writer->WriteValue(TEXT("baselineMedianMs"), Result.BaselineMedianMs);
+		}
+		else
+		{
+			Writer->WriteNull(TEXT("baselineMedianMs"));
+		}
+		Writer->WriteValue(TEXT("regressed"), Result.bRegressed);
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+
+	Writer->WriteObjectEnd();
+	Writer->Close();
+
+	return FFileHelper::SaveStringToFile(Report, *FilePath);
+}
+
+FLairBenchmarkResult FLairBenchmark::Summarize(const FString& Name, TArray<double> SamplesMs)
+{
+	FLairBenchmarkResult Result;
+	Result.Name = Name;
+	Result.NumSamples = SamplesMs.Num();
+	if (SamplesMs.Num() == 0)
+	{
+		return Result;
+	}
+
+	SamplesMs.Sort();
+	const int32 Num = SamplesMs.Num();
+	Result.MedianMs = (Num % 2 == 1) ? SamplesMs[Num / 2] : 0.5 * (SamplesMs[Num / 2 - 1] + SamplesMs[Num / 2]);
+	Result.P95Ms = SamplesMs[FMath::Clamp(static_cast<int32>(FMath::CeilToDouble(0.95 * Num)) - 1, 0, Num - 1)];
+	Result.MinMs = SamplesMs[0];
+	return Result;
+}
+
+bool FLairBenchmark::LoadBaseline(const FString& FilePath, TMap<FString, double>& OutMedians)
+{
+	FString Json;
+	if (!FFileHelper::LoadFileToString(Json, *FilePath))
+	{
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> Root;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+	const TArray<TSharedPtr<FJsonValue>>* Cases = nullptr;
+	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid() || !Root->TryGetArrayField(TEXT("cases"), Cases))
+	{
+		return false;
+	}
+
+	for (const TSharedPtr<FJsonValue>& Value : *Cases)
+	{
+		const TSharedPtr<FJsonObject>* Case = nullptr;
+		FString Name;
+		double MedianMs = 0.0;
+		if (Value.IsValid() && Value->TryGetObject(Case)
+			&& (*Case)->TryGetStringField(TEXT("name"), Name) && (*Case)->TryGetNumberField(TEXT("medianMs"), MedianMs))
+		{
+			OutMedians.Add(Name, MedianMs);
+		}
+	}
+
+	return true;
+}
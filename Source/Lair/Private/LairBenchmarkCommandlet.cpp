@@ -0,0 +1,88 @@
+// LairBenchmarkCommandlet.cpp
+// Benchmark Commandlet (Performance Regression Checks)
+
+#include "LairBenchmarkCommandlet.h"
+#include "LairBenchmark.h"
+#include "LairLog.h"
+#include "Misc/Paths.h"
+
+ULairBenchmarkCommandlet::ULairBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+	ShowErrorCount = true;
+}
+
+int32 ULairBenchmarkCommandlet::Main(const FString& Params)
+{
+	// Parse arguments
+	FLairBenchmarkSettings Settings;
+	FString SizesArg = TEXT("10,64,256");
+	FString ReportPath = FPaths::ProjectSavedDir() / TEXT("Benchmark.json");
+	FString BaselinePath;
+	FParse::Value(*Params, TEXT("Sizes="), SizesArg, false);
+	FParse::Value(*Params, TEXT("Samples="), Settings.NumSamples);
+	FParse::Value(*Params, TEXT("Queries="), Settings.NumQueries);
+	FParse::Value(*Params, TEXT("Cycles="), Settings.NumCycles);
+	FParse::Value(*Params, TEXT("Margin="), Settings.Margin);
+	FParse::Value(*Params, TEXT("Report="), ReportPath);
+	FParse::Value(*Params, TEXT("Baseline="), BaselinePath);
+
+	TArray<FString> SizeStrings;
+	SizesArg.ParseIntoArray(SizeStrings, TEXT(","));
+
+	Settings.BoardSizes.Reset();
+	for (const FString& SizeString : SizeStrings)
+	{
+		const int32 Size = FCString::Atoi(*SizeString.TrimStartAndEnd());
+		if (Size < 2)
+		{
+			UE_LOG(LogLair, Error, TEXT("ULairBenchmarkCommandlet::Main - Invalid board size %s"), *SizeString);
+			return 1;
+		}
+		Settings.BoardSizes.AddUnique(Size);
+	}
+
+	if (Settings.BoardSizes.Num() == 0 || Settings.NumSamples <= 0 || Settings.NumQueries <= 0 || Settings.NumCycles <= 0 || Settings.Margin < 0.0)
+	{
+		UE_LOG(LogLair, Error, TEXT("ULairBenchmarkCommandlet::Main - Need at least one size, sample, query and cycle, and a non-negative margin"));
+		return 1;
+	}
+
+	TMap<FString, double> BaselineMedians;
+	if (!BaselinePath.IsEmpty() && !FLairBenchmark::LoadBaseline(BaselinePath, BaselineMedians))
+	{
+		UE_LOG(LogLair, Error, TEXT("ULairBenchmarkCommandlet::Main - Could not read baseline %s"), *BaselinePath);
+		return 1;
+	}
+
+	UE_LOG(LogLair, Display, TEXT("ULairBenchmarkCommandlet::Main - %d board sizes, %d samples per case, %d queries, %d cycles"),
+		Settings.BoardSizes.Num(), Settings.NumSamples, Settings.NumQueries, Settings.NumCycles);
+
+	int32 NumRegressed = 0;
+	int32 NumCases = 0;
+	{
+		FLairBenchmark Benchmark(Settings);
+		for (const int32 Size : Settings.BoardSizes)
+		{
+			Benchmark.RunBoardCases(Size);
+		}
+		Benchmark.RunTurnCases();
+		Benchmark.RunPurchaseCases();
+
+		NumRegressed = Benchmark.CompareToBaseline(BaselineMedians);
+		NumCases = Benchmark.GetResults().Num();
+
+		if (!Benchmark.WriteReport(ReportPath, BaselinePath))
+		{
+			UE_LOG(LogLair, Error, TEXT("ULairBenchmarkCommandlet::Main - Failed to write report to %s"), *ReportPath);
+			return 1;
+		}
+	}
+
+	UE_LOG(LogLair, Display, TEXT("ULairBenchmarkCommandlet::Main - %d cases, %d regressions, report written to %s"),
+		NumCases, NumRegressed, *ReportPath);
+	return NumRegressed > 0 ? 1 : 0;
+}
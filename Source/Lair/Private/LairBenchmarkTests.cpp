@@ -0,0 +1,119 @@
+// LairBenchmarkTests.cpp
+// Benchmark Automation Tests (Lair.Perf)
+//
+// Headless run:
+//   UnrealEditor-Cmd Lair.uproject -nullrhi -unattended -ExecCmds="Automation RunTests Lair.Perf; Quit"
+//     [-LairPerfSamples=9] [-LairPerfBaseline=Benchmark.json] [-LairPerfMargin=0.2]
+//
+// Each case's timings are reported as test info; with a baseline, a case whose median exceeds
+// it by more than the margin fails its test. ULairBenchmarkCommandlet runs the same cases and
+// writes the report used as the baseline.
+
+#include "LairBenchmark.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	/** Board sizes the Lair.Perf.Board test runs (one sub-test each) */
+	const int32 PERF_BOARD_SIZES[] = { 10, 64, 256 };
+
+	/** Settings overridden from the command line */
+	FLairBenchmarkSettings GetPerfSettings()
+	{
+		FLairBenchmarkSettings Settings;
+		FParse::Value(FCommandLine::Get(), TEXT("LairPerfSamples="), Settings.NumSamples);
+		FParse::Value(FCommandLine::Get(), TEXT("LairPerfMargin="), Settings.Margin);
+		Settings.NumSamples = FMath::Max(Settings.NumSamples, 1);
+		Settings.Margin = FMath::Max(Settings.Margin, 0.0);
+		return Settings;
+	}
+
+	/**
+	 * Report a benchmark's results on a test and fail it on regressions.
+	 * @return True if no case regressed
+	 */
+	bool ReportPerfResults(FAutomationTestBase& Test, FLairBenchmark& Benchmark)
+	{
+		FString BaselinePath;
+		if (FParse::Value(FCommandLine::Get(), TEXT("LairPerfBaseline="), BaselinePath))
+		{
+			TMap<FString, double> BaselineMedians;
+			if (!FLairBenchmark::LoadBaseline(BaselinePath, BaselineMedians))
+			{
+				Test.AddError(FString::Printf(TEXT("Could not read baseline %s"), *BaselinePath));
+				return false;
+			}
+			Benchmark.CompareToBaseline(BaselineMedians);
+		}
+
+		if (Benchmark.GetResults().Num() == 0)
+		{
+			Test.AddError(TEXT("No benchmark case ran"));
+			return false;
+		}
+
+		for (const FLairBenchmarkResult& Result : Benchmark.GetResults())
+		{
+			const FString Summary = FString::Printf(TEXT("%s: median %.3f ms, p95 %.3f ms, min %.3f ms"),
+				*Result.Name, Result.MedianMs, Result.P95Ms, Result.MinMs);
+			if (Result.bRegressed)
+			{
+				Test.AddError(FString::Printf(TEXT("%s regressed (baseline %.3f ms)"), *Summary, Result.BaselineMedianMs));
+			}
+			else
+			{
+				Test.AddInfo(Summary);
+			}
+		}
+
+		return !Test.HasAnyErrors();
+	}
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FLairPerfBoardTest, "Lair.Perf.Board",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+void FLairPerfBoardTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const int32 Size : PERF_BOARD_SIZES)
+	{
+		OutBeautifiedNames.Add(FString::Printf(TEXT("%dx%d"), Size, Size));
+		OutTestCommands.Add(FString::FromInt(Size));
+	}
+}
+
+bool FLairPerfBoardTest::RunTest(const FString& Parameters)
+{
+	FLairBenchmark Benchmark(GetPerfSettings());
+	Benchmark.RunBoardCases(FCString::Atoi(*Parameters));
+	return ReportPerfResults(*this, Benchmark);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLairPerfTurnTest, "Lair.Perf.TurnManager",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FLairPerfTurnTest::RunTest(const FString& Parameters)
+{
+	FLairBenchmark Benchmark(GetPerfSettings());
+	Benchmark.RunTurnCases();
+	return ReportPerfResults(*this, Benchmark);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLairPerfPurchaseTest, "Lair.Perf.Purchase",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FLairPerfPurchaseTest::RunTest(const FString& Parameters)
+{
+	FLairBenchmark Benchmark(GetPerfSettings());
+	if (!Benchmark.RunPurchaseCases())
+	{
+		AddError(TEXT("Game mode has no unit types"));
+		return false;
+	}
+	return ReportPerfResults(*this, Benchmark);
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
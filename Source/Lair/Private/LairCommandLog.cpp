@@ -0,0 +1,193 @@
+// LairCommandLog.cpp
+// Command Log (Match Action Record)
+
+#include "LairCommandLog.h"
+#include "LairLog.h"
+#include "LairMemory.h"
+
+namespace
+{
+	/** Initial buffer size; a long match fits without regrowing */
+	constexpr int32 INITIAL_CAPACITY = 16 * 1024;
+
+	/** Highest value of ELairCommandType */
+	constexpr uint8 MAX_COMMAND_TYPE = static_cast<uint8>(ELairCommandType::EndTurn);
+}
+
+void FLairCommandLog::Reset(uint64 InMatchSeed)
+{
+	LLM_SCOPE_BYTAG(Lair_Replay);
+
+	Data.Reset(INITIAL_CAPACITY);
+	MatchSeed = InMatchSeed;
+	NumCommands = 0;
+}
+
+void FLairCommandLog::Append(const FLairCommand& Command)
+{
+	LLM_SCOPE_BYTAG(Lair_Replay);
+
+	checkSlow(Command.PlayerIndex >= 0 && Command.PlayerIndex < 16);
+
+	Data.Add(static_cast<uint8>(Command.Type) | static_cast<uint8>(Command.PlayerIndex << 4));
+
+	switch (Command.Type)
+	{
+	case ELairCommandType::Purchase:
+		WriteVarint(Data, Command.UnitType);
+		break;
+
+	case ELairCommandType::Mine:
+		WriteVarint(Data, Command.UnitIndex);
+		break;
+
+	case ELairCommandType::Move:
+		WriteVarint(Data, Command.UnitIndex);
+		WriteVarint(Data, Command.TargetTile);
+		break;
+
+	default:
+		break;
+	}
+
+	++NumCommands;
+}
+
+bool FLairCommandLog::AppendEncoded(TConstArrayView<uint8> Bytes)
+{
+	LLM_SCOPE_BYTAG(Lair_Replay);
+
+	const int32 OldNumBytes = Data.Num();
+	Data.Append(Bytes.GetData(), Bytes.Num());
+
+	int32 Offset = OldNumBytes;
+	int32 NumAppended = 0;
+	FLairCommand Command;
+	while (Offset < Data.Num())
+	{
+		if (!Read(Offset, Command))
+		{
+			UE_LOG(LogLair, Warning, TEXT("FLairCommandLog::AppendEncoded - Corrupt record at byte %d"), Offset);
+			Data.SetNum(OldNumBytes, false);
+			return false;
+		}
+		++NumAppended;
+	}
+
+	NumCommands += NumAppended;
+	return true;
+}
+
+void FLairCommandLog::RemoveLast(int32 RecordOffset)
+{
+	check(NumCommands > 0 && RecordOffset >= 0 && RecordOffset < Data.Num());
+
+	Data.SetNum(RecordOffset, false);
+	--NumCommands;
+}
+
+bool FLairCommandLog::Read(int32& InOutOffset, FLairCommand& OutCommand) const
+{
+	if (InOutOffset < 0 || InOutOffset >= Data.Num())
+	{
+		return false;
+	}
+
+	int32 Offset = InOutOffset;
+	const uint8 Header = Data[Offset++];
+	const uint8 Type = Header & 0x0F;
+	if (Type == 0 || Type > MAX_COMMAND_TYPE)
+	{
+		return false;
+	}
+
+	FLairCommand Command = FLairCommand::MakeSimple(static_cast<ELairCommandType>(Type), Header >> 4);
+
+	uint32 First = 0;
+	uint32 Second = 0;
+	switch (Command.Type)
+	{
+	case ELairCommandType::Purchase:
+		if (!ReadVarint(Data.GetData(), Data.Num(), Offset, First) || First > MAX_uint8)
+		{
+			return false;
+		}
+		Command.UnitType = static_cast<uint8>(First);
+		break;
+
+	case ELairCommandType::Mine:
+		if (!ReadVarint(Data.GetData(), Data.Num(), Offset, First) || First > MAX_uint16)
+		{
+			return false;
+		}
+		Command.UnitIndex = static_cast<uint16>(First);
+		break;
+
+	case ELairCommandType::Move:
+		if (!ReadVarint(Data.GetData(), Data.Num(), Offset, First) || First > MAX_uint16
+			|| !ReadVarint(Data.GetData(), Data.Num(), Offset, Second) || Second >= static_cast<uint32>(FLairMatchRules::MAX_TILES))
+		{
+			return false;
+		}
+		Command.UnitIndex = static_cast<uint16>(First);
+		Command.TargetTile = Second;
+		break;
+
+	default:
+		break;
+	}
+
+	OutCommand = Command;
+	InOutOffset = Offset;
+	return true;
+}
+
+bool FLairCommandLog::SetData(uint64 InMatchSeed, TArray<uint8> InData)
+{
+	Data = MoveTemp(InData);
+	MatchSeed = InMatchSeed;
+	NumCommands = 0;
+
+	// Count records, rejecting truncated or corrupt data outright
+	int32 Offset = 0;
+	FLairCommand Command;
+	while (Offset < Data.Num())
+	{
+		if (!Read(Offset, Command))
+		{
+			UE_LOG(LogLair, Warning, TEXT("FLairCommandLog::SetData - Corrupt record at byte %d"), Offset);
+			Reset(InMatchSeed);
+			return false;
+		}
+		++NumCommands;
+	}
+
+	return true;
+}
+
+void FLairCommandLog::WriteVarint(TArray<uint8>& Out, uint32 Value)
+{
+	while (Value >= 0x80)
+	{
+		Out.Add(static_cast<uint8>(Value | 0x80));
+		Value >>= 7;
+	}
+	Out.Add(static_cast<uint8>(Value));
+}
+
+bool FLairCommandLog::ReadVarint(const uint8* Bytes, int32 NumBytes, int32& InOutOffset, uint32& OutValue)
+{
+	uint32 Value = 0;
+	for (int32 Shift = 0, Offset = InOutOffset; Shift < 35 && Offset < NumBytes; Shift += 7)
+	{
+		const uint8 Byte = Bytes[Offset++];
+		Value |= static_cast<uint32>(Byte & 0x7F) << Shift;
+		if ((Byte & 0x80) == 0)
+		{
+			OutValue = Value;
+			InOutOffset = Offset;
+			return true;
+		}
+	}
+	return false;
+}
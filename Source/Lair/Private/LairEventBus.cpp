@@ -0,0 +1,80 @@
+// LairEventBus.cpp
+// Event Bus (Coalesced Native Events)
+
+#include "LairEventBus.h"
+#include "LairLog.h"
+
+namespace
+{
+	/** Flush passes before events posted by listeners are assumed to be a feedback loop */
+	constexpr int32 MAX_FLUSH_PASSES = 8;
+}
+
+void FLairEventBus::Post(const FLairEvent& Event)
+{
+	check(IsInGameThread());
+
+	const int32 TypeIndex = static_cast<int32>(Event.Type);
+
+	// Nothing would be delivered: skip queueing entirely
+	if (!Listeners[0][TypeIndex].IsBound() && (bSimulationMode || !Listeners[1][TypeIndex].IsBound()))
+	{
+		return;
+	}
+
+	for (FLairEvent& Existing : Pending)
+	{
+		if (Existing.Type == Event.Type && Existing.PlayerIndex == Event.PlayerIndex)
+		{
+			Existing.NewValue = Event.NewValue;
+			return;
+		}
+	}
+
+	Pending.Add(Event);
+}
+
+void FLairEventBus::Flush()
+{
+	check(IsInGameThread());
+
+	if (bFlushing)
+	{
+		// Re-entrant flush from a listener: the outer flush picks up new events
+		return;
+	}
+
+	TGuardValue<bool> FlushGuard(bFlushing, true);
+
+	TArray<FLairEvent, TInlineAllocator<16>> Delivering;
+	for (int32 Pass = 0; Pass < MAX_FLUSH_PASSES && Pending.Num() > 0; ++Pass)
+	{
+		Delivering = MoveTemp(Pending);
+		Pending.Reset();
+
+		for (const FLairEvent& Event : Delivering)
+		{
+			// Counter changes that cancelled out within the flush window are not news. Turn flow
+			// events always are (StartFirstTurn announces player 0 and Purchase without a change).
+			const bool bIsCounter = Event.Type == ELairEventType::GoldChanged || Event.Type == ELairEventType::OwnedUnitsChanged;
+			if (bIsCounter && Event.OldValue == Event.NewValue)
+			{
+				continue;
+			}
+
+			const int32 TypeIndex = static_cast<int32>(Event.Type);
+			Listeners[static_cast<int32>(ELairEventListener::Gameplay)][TypeIndex].Broadcast(Event);
+
+			if (!bSimulationMode)
+			{
+				Listeners[static_cast<int32>(ELairEventListener::Presentation)][TypeIndex].Broadcast(Event);
+			}
+		}
+	}
+
+	if (Pending.Num() > 0)
+	{
+		UE_LOG(LogLair, Warning, TEXT("FLairEventBus::Flush - %d events still pending after %d passes, deferring"),
+			Pending.Num(), MAX_FLUSH_PASSES);
+	}
+}
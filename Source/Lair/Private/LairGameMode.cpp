@@ -2,15 +2,31 @@
 // Step 2: Game Mode (Central Authority)
 
 #include "LairGameMode.h"
+#include "LairLog.h"
+#include "LairMemory.h"
+#include "LairTrace.h"
+#include "LairStats.h"
 #include "BoardSystemComponent.h"
 #include "TurnManagerComponent.h"
 #include "RulesEngineComponent.h"
+#include "CombatOddsComponent.h"
+#include "MiningSystemComponent.h"
+#include "VictoryManagerComponent.h"
+#include "LairAIComponent.h"
+#include "LairGameState.h"
+#include "LairLockstepComponent.h"
+#include "LairPlayerController.h"
 #include "LairPlayerState.h"
+#include "LairReplay.h"
+#include "LairSaveGame.h"
 #include "Tile.h"
 #include "Unit.h"
 #include "GameFramework/PlayerState.h"
 #include "GameFramework/GameStateBase.h"
 #include "Kismet/GameplayStatics.h"
+#include "TimerManager.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
 
 ALairGameMode::ALairGameMode()
 {
@@ -18,53 +34,198 @@ ALairGameMode::ALairGameMode()
 	BoardSystem = CreateDefaultSubobject<UBoardSystemComponent>(TEXT("BoardSystem"));
 	TurnManager = CreateDefaultSubobject<UTurnManagerComponent>(TEXT("TurnManager"));
 	RulesEngine = CreateDefaultSubobject<URulesEngineComponent>(TEXT("RulesEngine"));
+	CombatOdds = CreateDefaultSubobject<UCombatOddsComponent>(TEXT("CombatOdds"));
+	MiningSystem = CreateDefaultSubobject<UMiningSystemComponent>(TEXT("MiningSystem"));
+	VictoryManager = CreateDefaultSubobject<UVictoryManagerComponent>(TEXT("VictoryManager"));
+	AIPlanner = CreateDefaultSubobject<ULairAIComponent>(TEXT("AIPlanner"));
 
-	// Default player state class
+	// Default player state and game state classes
 	PlayerStateClass = ALairPlayerState::StaticClass();
+	GameStateClass = ALairGameState::StaticClass();
 
 	// Phase 1: 2 players
 	NumberOfPlayers = 2;
+
+	// Ticks only to flush the event bus once per frame
+	PrimaryActorTick.bCanEverTick = true;
 }
 
 void ALairGameMode::InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage)
 {
 	Super::InitGame(MapName, Options, ErrorMessage);
 
-	UE_LOG(LogTemp, Log, TEXT("ALairGameMode::InitGame - Initializing LAIR game"));
+	// Allow headless runs to pin the match seed from the URL (e.g. ?Seed=1234)
+	const FString SeedOption = UGameplayStatics::ParseOption(Options, TEXT("Seed"));
+	if (!SeedOption.IsEmpty())
+	{
+		MatchSeed = FCString::Atoi64(*SeedOption);
+	}
+
+	if (UGameplayStatics::HasOption(Options, TEXT("Simulate")))
+	{
+		bSimulationMode = UGameplayStatics::GetIntOption(Options, TEXT("Simulate"), 1) != 0;
+	}
+
+	if (UGameplayStatics::HasOption(Options, TEXT("Lockstep")))
+	{
+		bLockstepMode = UGameplayStatics::GetIntOption(Options, TEXT("Lockstep"), 1) != 0;
+	}
+	EventBus.SetSimulationMode(bSimulationMode);
+
+	// Computer players, one policy per player index (e.g. ?AI=None,Greedy); humans otherwise
+	const FString AIOption = UGameplayStatics::ParseOption(Options, TEXT("AI"));
+	if (!AIOption.IsEmpty() && AIPlanner)
+	{
+		TArray<FString> PolicyNames;
+		AIOption.ParseIntoArray(PolicyNames, TEXT(","), false);
+		for (int32 PlayerIndex = 0; PlayerIndex < PolicyNames.Num(); ++PlayerIndex)
+		{
+			AIPlanner->SetPlayerPolicy(PlayerIndex, FName(*PolicyNames[PlayerIndex].TrimStartAndEnd()));
+		}
+	}
+
+	UE_LOG(LogLair, Log, TEXT("ALairGameMode::InitGame - Initializing LAIR game"));
 }
 
 void ALairGameMode::BeginPlay()
 {
 	Super::BeginPlay();
 
-	UE_LOG(LogTemp, Log, TEXT("ALairGameMode::BeginPlay - Starting game setup"));
+	UE_LOG(LogLair, Log, TEXT("ALairGameMode::BeginPlay - Starting game setup"));
 
 	// Initialize the rules engine - it will use defaults for any null tables
 	if (RulesEngine)
 	{
 		RulesEngine->Initialize(UnitsDataTable, TileTypesDataTable);
+		RulesEngine->SetBoardSystem(BoardSystem);
+		RulesEngine->OnRulesDataChangedNative.AddUObject(this, &ALairGameMode::HandleRulesDataChanged);
 
 		if (!UnitsDataTable)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("ALairGameMode::BeginPlay - UnitsDataTable not set, using defaults"));
+			UE_LOG(LogLair, Warning, TEXT("ALairGameMode::BeginPlay - UnitsDataTable not set, using defaults"));
 		}
 		if (!TileTypesDataTable)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("ALairGameMode::BeginPlay - TileTypesDataTable not set, using defaults"));
+			UE_LOG(LogLair, Warning, TEXT("ALairGameMode::BeginPlay - TileTypesDataTable not set, using defaults"));
 		}
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("ALairGameMode::BeginPlay - RulesEngine is null"));
+		UE_LOG(LogLair, Error, TEXT("ALairGameMode::BeginPlay - RulesEngine is null"));
+	}
+
+	// Turn flow goes through the event bus; hand turns to the AI planner from there
+	if (TurnManager)
+	{
+		TurnManager->SetEventBus(&EventBus);
+	}
+	EventBus.On(ELairEventType::PlayerChanged).AddUObject(this, &ALairGameMode::HandlePlayerChanged);
+	EventBus.On(ELairEventType::TurnChanged).AddUObject(this, &ALairGameMode::HandleTurnChanged);
+
+	UndoStack.SetCapacity(MaxUndoLevels);
+
+	// Take AI results back on the game thread
+	if (AIPlanner)
+	{
+		AIPlanner->OnTurnPlannedNative.AddUObject(this, &ALairGameMode::HandleAITurnPlanned);
 	}
 
 	// Start the game
 	StartGame();
 }
 
+void ALairGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Never quit with a save half written
+	if (PendingSaveTask.IsValid())
+	{
+		PendingSaveTask.Wait();
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ALairGameMode::PostLogin(APlayerController* NewPlayer)
+{
+	Super::PostLogin(NewPlayer);
+
+	// The host's own controller plays through the game mode directly
+	ULairLockstepComponent* Peer = NewPlayer ? NewPlayer->FindComponentByClass<ULairLockstepComponent>() : nullptr;
+	if (!bLockstepMode || !Peer || NewPlayer->IsLocalController())
+	{
+		return;
+	}
+
+	// Seats go in join order after the host's (a dedicated server has no local seat); the rest spectate
+	int32 Seat = GetNetMode() == NM_ListenServer ? 1 : 0;
+	while (Seat < NumberOfPlayers && LockstepPeers.ContainsByPredicate(
+		[Seat](const TWeakObjectPtr<ULairLockstepComponent>& Other) { return Other.IsValid() && Other->GetPlayerIndex() == Seat; }))
+	{
+		++Seat;
+	}
+	Peer->SetPlayerIndex(Seat < NumberOfPlayers ? Seat : INDEX_NONE);
+	LockstepPeers.Add(Peer);
+
+	// Joined after the match started: send rules and a keyframe of the current state now
+	FLairMatchState Keyframe;
+	if (CaptureMatchState(Keyframe))
+	{
+		Peer->StartPeer(Keyframe, CommandLog.Num(), CommandLog.GetMatchSeed());
+	}
+}
+
+void ALairGameMode::Logout(AController* Exiting)
+{
+	if (ULairLockstepComponent* Peer = Exiting ? Exiting->FindComponentByClass<ULairLockstepComponent>() : nullptr)
+	{
+		LockstepPeers.Remove(Peer);
+	}
+
+	Super::Logout(Exiting);
+}
+
+void ALairGameMode::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	// Deliver anything changed outside an action (e.g. direct component calls)
+	EventBus.Flush();
+}
+
 void ALairGameMode::StartGame()
 {
-	UE_LOG(LogTemp, Log, TEXT("ALairGameMode::StartGame - Initializing game"));
+	LLM_SCOPE_BYTAG(Lair);
+
+	UE_LOG(LogLair, Log, TEXT("ALairGameMode::StartGame - Initializing game"));
+
+	// A turn planned against the previous match must never reach this one
+	if (AIPlanner)
+	{
+		AIPlanner->CancelThinking();
+	}
+	MatchUnits.Reset();
+	ActiveReplay.Reset();
+	UndoStack.Reset();
+	EventBus.Reset();
+	MatchRules.Reset();
+
+	// Edits held back during a replay apply now, before anything is built from them
+	if (RulesEngine)
+	{
+		RulesEngine->SetDeferTableEdits(false);
+	}
+
+	// Seed the match RNG first so every system draws from a reproducible sequence
+	const uint64 ActiveSeed = (MatchSeed != 0) ? static_cast<uint64>(MatchSeed) : FLairRandomService::MakeRandomSeed();
+	Random.Initialize(ActiveSeed);
+	CommandLog.Reset(ActiveSeed);
+	UE_LOG(LogLair, Log, TEXT("ALairGameMode::StartGame - Match seed %llu"), ActiveSeed);
+
+	// Build and shuffle the mining deck from the mining stream
+	if (MiningSystem)
+	{
+		MiningSystem->Initialize(MiningCardsDataTable, &Random.GetStream(ELairRandomStream::Mining));
+	}
 
 	// Initialize the board
 	if (BoardSystem)
@@ -73,6 +234,7 @@ void ALairGameMode::StartGame()
 		BoardSystem->SetTileClass(TileClass);
 		BoardSystem->SetBoardLayoutDataTable(BoardLayoutDataTable);
 		BoardSystem->SetTileTypesDataTable(TileTypesDataTable);
+		BoardSystem->SetRulesEngine(RulesEngine);
 
 		// Initialize board from data table path (or generate default 10x10)
 		BoardSystem->InitializeBoard(TEXT(""));
@@ -103,6 +265,7 @@ void ALairGameMode::StartGame()
 		if (NewPlayerState)
 		{
 			NewPlayerState->InitializePlayer(i, LairConstants::STARTING_GOLD);
+			NewPlayerState->SetEventBus(&EventBus);
 			PlayerStates.Add(NewPlayerState);
 
 			// Register with GameState so engine systems (replication, UI, analytics) can see these states
@@ -111,11 +274,24 @@ void ALairGameMode::StartGame()
 				GS->AddPlayerState(NewPlayerState);
 			}
 
-			UE_LOG(LogTemp, Log, TEXT("Created PlayerState for Player %d with %d gold"),
+			UE_LOG(LogLair, Log, TEXT("Created PlayerState for Player %d with %d gold"),
 				i, LairConstants::STARTING_GOLD);
 		}
 	}
 
+	// Track victory counters from the new player states
+	if (VictoryManager)
+	{
+		VictoryManager->Initialize(VictoryConditionsDataTable, NumberOfPlayers);
+		for (ALairPlayerState* PlayerState : PlayerStates)
+		{
+			VictoryManager->RegisterPlayerState(PlayerState);
+		}
+	}
+
+	// Compile the headless rules once the board, deck and victory conditions exist
+	BuildMatchRules();
+
 	// Start the first turn
 	if (TurnManager)
 	{
@@ -123,51 +299,82 @@ void ALairGameMode::StartGame()
 		TurnManager->StartFirstTurn();
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("ALairGameMode::StartGame - Game started with %d players"), NumberOfPlayers);
+	EventBus.Flush();
+	SyncNetGameState(true);
+	StartLockstepPeers();
+
+	UE_LOG(LogLair, Log, TEXT("ALairGameMode::StartGame - Game started with %d players"), NumberOfPlayers);
 }
 
 bool ALairGameMode::PurchaseUnit(int32 PlayerIndex, FName UnitTypeID)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(ALairGameMode::PurchaseUnit);
+
+	if (!MatchRules.IsValid())
+	{
+		UE_LOG(LogLairEconomy, Warning, TEXT("PurchaseUnit: No match in progress"));
+		return false;
+	}
+
+	const uint8 UnitType = RulesEngine ? RulesEngine->FindUnitTypeId(UnitTypeID) : FLairRulesTable::INVALID_ID;
+	if (UnitType == FLairRulesTable::INVALID_ID)
+	{
+		UE_LOG(LogLairEconomy, Warning, TEXT("PurchaseUnit: Unknown unit type %s"), *UnitTypeID.ToString());
+		return false;
+	}
+
+	return ExecuteCommand(FLairCommand::MakePurchase(PlayerIndex, UnitType));
+}
+
+bool ALairGameMode::ExecutePurchase(int32 PlayerIndex, uint8 UnitTypeId)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(ALairGameMode::ExecutePurchase);
+	SCOPE_CYCLE_COUNTER(STAT_LairPurchase);
+
 	// Validate player index
 	if (PlayerIndex < 0 || PlayerIndex >= PlayerStates.Num())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("PurchaseUnit: Invalid player index %d"), PlayerIndex);
+		UE_LOG(LogLairEconomy, Warning, TEXT("PurchaseUnit: Invalid player index %d"), PlayerIndex);
 		return false;
 	}
 
 	// Check if it's the correct player's turn
 	if (TurnManager && TurnManager->GetCurrentPlayerIndex() != PlayerIndex)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("PurchaseUnit: Not player %d's turn"), PlayerIndex);
+		UE_LOG(LogLairEconomy, Warning, TEXT("PurchaseUnit: Not player %d's turn"), PlayerIndex);
 		return false;
 	}
 
 	// Check if we're in the purchase phase
 	if (TurnManager && TurnManager->GetCurrentPhase() != ETurnPhase::Purchase)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("PurchaseUnit: Not in Purchase phase"));
+		UE_LOG(LogLairEconomy, Warning, TEXT("PurchaseUnit: Not in Purchase phase"));
 		return false;
 	}
 
 	ALairPlayerState* PlayerState = PlayerStates[PlayerIndex];
 	if (!PlayerState)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("PurchaseUnit: PlayerState is null"));
+		UE_LOG(LogLairEconomy, Warning, TEXT("PurchaseUnit: PlayerState is null"));
 		return false;
 	}
 
 	// Get unit data from rules engine
-	if (!RulesEngine)
+	if (!RulesEngine || !RulesEngine->IsValidUnitTypeId(UnitTypeId))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("PurchaseUnit: RulesEngine is null"));
+		UE_LOG(LogLairEconomy, Warning, TEXT("PurchaseUnit: RulesEngine is null or unit type %d is unknown"), UnitTypeId);
 		return false;
 	}
 
+	// One lookup for the whole purchase: hot stats by dense ID
+	const FLairUnitTypeStats& Stats = RulesEngine->GetUnitStats(UnitTypeId);
+	const FName UnitTypeID = RulesEngine->GetUnitTypeName(UnitTypeId);
+
 	// Check if player can afford the unit
 	int32 PlayerGold = PlayerState->GetGold();
-	if (!RulesEngine->CanAffordUnit(PlayerGold, UnitTypeID))
+	if (!RulesEngine->CanAffordUnitType(PlayerGold, UnitTypeId))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("PurchaseUnit: Player %d cannot afford unit %s (has %d gold)"),
+		UE_LOG(LogLairEconomy, Warning, TEXT("PurchaseUnit: Player %d cannot afford unit %s (has %d gold)"),
 			PlayerIndex, *UnitTypeID.ToString(), PlayerGold);
 		return false;
 	}
@@ -175,7 +382,7 @@ bool ALairGameMode::PurchaseUnit(int32 PlayerIndex, FName UnitTypeID)
 	// Get the player's base tile
 	if (!BoardSystem)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("PurchaseUnit: BoardSystem is null"));
+		UE_LOG(LogLairEconomy, Warning, TEXT("PurchaseUnit: BoardSystem is null"));
 		return false;
 	}
 
@@ -183,50 +390,46 @@ bool ALairGameMode::PurchaseUnit(int32 PlayerIndex, FName UnitTypeID)
 	ATile* BaseTile = BoardSystem->GetTileAt(BaseCoord);
 	if (!BaseTile)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("PurchaseUnit: Could not find base tile at (%d, %d)"),
+		UE_LOG(LogLairEconomy, Warning, TEXT("PurchaseUnit: Could not find base tile at (%d, %d)"),
 			BaseCoord.X, BaseCoord.Y);
 		return false;
 	}
 
-	// Get unit data for sub-slot size check
-	FUnitData UnitData = RulesEngine->GetUnitData(UnitTypeID);
-
 	// Check if base tile has room
-	if (!RulesEngine->CanSpawnUnitAt(BaseTile, UnitData.SubSlotSize))
+	if (!RulesEngine->CanSpawnUnitAt(BaseTile, Stats.SubSlotSize))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("PurchaseUnit: Not enough space at base for unit %s"),
+		UE_LOG(LogLairEconomy, Warning, TEXT("PurchaseUnit: Not enough space at base for unit %s"),
 			*UnitTypeID.ToString());
 		return false;
 	}
 
 	// Deduct gold
-	PlayerState->DeductGold(UnitData.Cost);
+	PlayerState->DeductGold(Stats.Cost);
 
 	// Spawn the unit
-	AUnit* NewUnit = SpawnUnitAtBase(PlayerIndex, UnitTypeID);
+	AUnit* NewUnit = SpawnUnitAtBase(PlayerIndex, UnitTypeId);
 	if (!NewUnit)
 	{
 		// Refund gold if spawn failed
-		PlayerState->AddGold(UnitData.Cost);
-		UE_LOG(LogTemp, Warning, TEXT("PurchaseUnit: Failed to spawn unit, gold refunded"));
+		PlayerState->AddGold(Stats.Cost);
+		UE_LOG(LogLairEconomy, Warning, TEXT("PurchaseUnit: Failed to spawn unit, gold refunded"));
 		return false;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("PurchaseUnit: Player %d purchased %s for %d gold (remaining: %d)"),
-		PlayerIndex, *UnitTypeID.ToString(), UnitData.Cost, PlayerState->GetGold());
+	UE_LOG(LogLairEconomy, Verbose, TEXT("PurchaseUnit: Player %d purchased %s for %d gold (remaining: %d)"),
+		PlayerIndex, *UnitTypeID.ToString(), Stats.Cost, PlayerState->GetGold());
+	LAIR_TRACE_MARKER(TEXT("Lair: Player %d purchased %s"), PlayerIndex, *UnitTypeID.ToString());
+
+	CheckVictoryConditions();
 
 	return true;
 }
 
-AUnit* ALairGameMode::SpawnUnitAtBase(int32 PlayerIndex, FName UnitTypeID)
+AUnit* ALairGameMode::SpawnUnitAtBase(int32 PlayerIndex, uint8 UnitTypeId)
 {
-	if (!UnitClass)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("SpawnUnitAtBase: UnitClass is not set"));
-		return nullptr;
-	}
+	TRACE_CPUPROFILER_EVENT_SCOPE(ALairGameMode::SpawnUnitAtBase);
 
-	if (!BoardSystem)
+	if (!BoardSystem || !RulesEngine || !RulesEngine->IsValidUnitTypeId(UnitTypeId))
 	{
 		return nullptr;
 	}
@@ -238,46 +441,91 @@ AUnit* ALairGameMode::SpawnUnitAtBase(int32 PlayerIndex, FName UnitTypeID)
 		return nullptr;
 	}
 
-	// Get unit data
-	FUnitData UnitData = RulesEngine->GetUnitData(UnitTypeID);
-
 	// Find an available sub-slot using tile's helper method (eliminates duplicate logic)
-	int32 AvailableSubSlot = BaseTile->FindAvailableSubSlot(UnitData.SubSlotSize);
+	int32 AvailableSubSlot = BaseTile->FindAvailableSubSlot(RulesEngine->GetUnitStats(UnitTypeId).SubSlotSize);
 	if (AvailableSubSlot < 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("SpawnUnitAtBase: No available sub-slot"));
+		UE_LOG(LogLairEconomy, Warning, TEXT("SpawnUnitAtBase: No available sub-slot"));
+		return nullptr;
+	}
+
+	AUnit* NewUnit = SpawnUnit(PlayerIndex, UnitTypeId, BaseTile, AvailableSubSlot);
+	if (NewUnit)
+	{
+		// Spawn order is the unit's headless index
+		MatchUnits.Add(NewUnit);
+
+		UE_LOG(LogLairEconomy, Verbose, TEXT("SpawnUnitAtBase: Spawned %s at (%d, %d) sub-slot %d"),
+			*RulesEngine->GetUnitTypeName(UnitTypeId).ToString(), BaseCoord.X, BaseCoord.Y, AvailableSubSlot);
+		LAIR_TRACE_MARKER(TEXT("Lair: Player %d spawned %s at (%d, %d)"), PlayerIndex,
+			*RulesEngine->GetUnitTypeName(UnitTypeId).ToString(), BaseCoord.X, BaseCoord.Y);
+	}
+
+	return NewUnit;
+}
+
+AUnit* ALairGameMode::SpawnUnit(int32 PlayerIndex, uint8 UnitTypeId, ATile* Tile, int32 SubSlotIndex)
+{
+	LLM_SCOPE_BYTAG(Lair_Units);
+
+	if (!UnitClass)
+	{
+		UE_LOG(LogLairEconomy, Warning, TEXT("SpawnUnitAtBase: UnitClass is not set"));
+		return nullptr;
+	}
+
+	if (!RulesEngine || !RulesEngine->IsValidUnitTypeId(UnitTypeId))
+	{
 		return nullptr;
 	}
 
 	// Calculate spawn location
-	FVector SpawnLocation = BaseTile->GetActorLocation();
+	FVector SpawnLocation = Tile->GetActorLocation();
 	SpawnLocation.Z += 50.0f; // Raise unit above tile
 
-	// Spawn the unit
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	// Reuse a unit released by undo or a replay seek before spawning a new actor
+	AUnit* NewUnit = nullptr;
+	while (!NewUnit && UnitPool.Num() > 0)
+	{
+		NewUnit = UnitPool.Pop(false);
+		if (IsValid(NewUnit))
+		{
+			NewUnit->SetActorLocation(SpawnLocation);
+			NewUnit->SetActorHiddenInGame(false);
+			NewUnit->SetActorEnableCollision(true);
+			NewUnit->bHasMinedThisTurn = false;
+		}
+		else
+		{
+			NewUnit = nullptr;
+		}
+	}
+
+	if (!NewUnit)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		NewUnit = GetWorld()->SpawnActor<AUnit>(UnitClass, SpawnLocation, FRotator::ZeroRotator, SpawnParams);
+	}
 
-	AUnit* NewUnit = GetWorld()->SpawnActor<AUnit>(UnitClass, SpawnLocation, FRotator::ZeroRotator, SpawnParams);
 	if (NewUnit)
 	{
 		// Set owner BEFORE initializing from data table, so UpdateVisuals() uses correct player color
 		NewUnit->OwnerPlayerIndex = PlayerIndex;
 
 		// Initialize the unit (this calls UpdateVisuals internally)
-		NewUnit->InitializeFromDataTable(UnitTypeID, UnitData);
+		NewUnit->InitializeFromTypeData(RulesEngine->GetUnitTypeName(UnitTypeId), &RulesEngine->GetUnitDataById(UnitTypeId));
 
 		// Place on tile
-		BaseTile->PlaceUnitInSubSlot(NewUnit, AvailableSubSlot);
-		NewUnit->SetCurrentTile(BaseTile, AvailableSubSlot);
+		Tile->PlaceUnitInSubSlot(NewUnit, SubSlotIndex);
+		NewUnit->SetCurrentTile(Tile, SubSlotIndex);
 
 		// Register unit with player state for ownership tracking
 		if (PlayerIndex >= 0 && PlayerIndex < PlayerStates.Num() && PlayerStates[PlayerIndex])
 		{
 			PlayerStates[PlayerIndex]->AddOwnedUnit(NewUnit);
 		}
-
-		UE_LOG(LogTemp, Log, TEXT("SpawnUnitAtBase: Spawned %s at (%d, %d) sub-slot %d"),
-			*UnitTypeID.ToString(), BaseCoord.X, BaseCoord.Y, AvailableSubSlot);
 	}
 
 	return NewUnit;
@@ -296,6 +544,1165 @@ void ALairGameMode::EndCurrentTurn()
 {
 	if (TurnManager)
 	{
-		TurnManager->EndTurn();
+		ExecuteCommand(FLairCommand::MakeSimple(ELairCommandType::EndTurn, TurnManager->GetCurrentPlayerIndex()));
+	}
+}
+
+void ALairGameMode::AdvanceCurrentPhase()
+{
+	if (TurnManager)
+	{
+		ExecuteCommand(FLairCommand::MakeSimple(ELairCommandType::AdvancePhase, TurnManager->GetCurrentPlayerIndex()));
+	}
+}
+
+int32 ALairGameMode::CheckVictoryConditions()
+{
+	// Victory counters follow the bus, so deliver this action's changes first
+	EventBus.Flush();
+
+	return VictoryManager ? VictoryManager->CheckVictoryConditions() : INDEX_NONE;
+}
+
+// ============================================================================
+// Headless State
+// ============================================================================
+
+void ALairGameMode::BuildMatchRules()
+{
+	LLM_SCOPE_BYTAG(Lair_Rules);
+
+	if (!RulesEngine || !BoardSystem)
+	{
+		MatchRules.Reset();
+		return;
+	}
+
+	// Board-sized arrays of the headless state are capped (see FLairMatchRules::MAX_TILES)
+	const FIntPoint BoardSize = BoardSystem->GetBoardSize();
+	if (static_cast<int64>(BoardSize.X) * BoardSize.Y > FLairMatchRules::MAX_TILES)
+	{
+		UE_LOG(LogLair, Error, TEXT("ALairGameMode::BuildMatchRules - %dx%d board exceeds %d tiles"),
+			BoardSize.X, BoardSize.Y, FLairMatchRules::MAX_TILES);
+		MatchRules.Reset();
+		return;
+	}
+
+	TSharedRef<FLairMatchRules> Rules = MakeShared<FLairMatchRules>();
+
+	// Unit types share the rules table's dense IDs
+	const FLairRulesTable& RulesTable = RulesEngine->GetRulesTable();
+	Rules->UnitTypeNames = RulesTable.UnitTypeNames;
+	Rules->UnitTypes = RulesTable.UnitStats;
+
+	// Terrain flags straight from the board's packed array (same row-major indexing)
+	Rules->BoardSize = BoardSize;
+	Rules->TileFlags.Init(ELairTileFlags::None, Rules->GetNumTiles());
+	const TArray<uint8>& BoardFlags = BoardSystem->GetTileFlagsArray();
+	for (int32 TileIndex = 0; TileIndex < Rules->GetNumTiles() && TileIndex < BoardFlags.Num(); ++TileIndex)
+	{
+		Rules->TileFlags[TileIndex] = BoardFlags[TileIndex] & ELairTileFlags::TerrainMask;
+	}
+
+	for (int32 PlayerIndex = 0; PlayerIndex < NumberOfPlayers; ++PlayerIndex)
+	{
+		Rules->BaseTiles.Add(Rules->GetTileIndex(BoardSystem->GetPlayerBaseCoord(PlayerIndex)));
+	}
+
+	Rules->CardTable = MiningSystem ? MiningSystem->GetCardTable() : nullptr;
+	Rules->StartingGold = LairConstants::STARTING_GOLD;
+	Rules->GoldVictoryThreshold = VictoryManager ? VictoryManager->GetConditionThreshold(EVictoryType::GoldThreshold) : 0;
+	Rules->NumPlayers = NumberOfPlayers;
+	Rules->FinalizeBoard();
+
+	MatchRules = Rules;
+
+	UE_LOG(LogLair, Log, TEXT("ALairGameMode::BuildMatchRules - %d unit types, %dx%d board"),
+		Rules->UnitTypes.Num(), Rules->BoardSize.X, Rules->BoardSize.Y);
+}
+
+bool ALairGameMode::CaptureMatchState(FLairMatchState& OutState) const
+{
+	if (!MatchRules.IsValid() || !TurnManager || !MiningSystem)
+	{
+		return false;
+	}
+
+	const FLairMatchRules& Rules = *MatchRules;
+
+	OutState.Rules = MatchRules;
+	OutState.Tiles.Reset();
+	OutState.Tiles.SetNum(Rules.GetNumTiles());
+	OutState.Units.Reset();
+	OutState.Units.SetNum(MatchUnits.Num());
+
+	for (int32 UnitIndex = 0; UnitIndex < MatchUnits.Num(); ++UnitIndex)
+	{
+		FLairSimUnit& SimUnit = OutState.Units[UnitIndex];
+		const AUnit* Unit = MatchUnits[UnitIndex];
+		const int32 TypeIndex = Unit ? Rules.FindUnitType(Unit->UnitTypeID) : INDEX_NONE;
+		const int32 TileIndex = (Unit && Unit->CurrentTile) ? Rules.GetTileIndex(Unit->CurrentTile->GridCoord) : INDEX_NONE;
+
+		if (!IsValid(Unit) || TypeIndex == INDEX_NONE || TileIndex == INDEX_NONE)
+		{
+			// Keep the slot so indices stay aligned; an unowned unit is ignored by the rules
+			SimUnit.OwnerIndex = INDEX_NONE;
+			SimUnit.CurrentHP = 0;
+			continue;
+		}
+
+		SimUnit.TypeIndex = static_cast<uint8>(TypeIndex);
+		SimUnit.OwnerIndex = static_cast<int8>(Unit->OwnerPlayerIndex);
+		SimUnit.CurrentHP = static_cast<uint8>(FMath::Clamp(Unit->CurrentHP, 0, 255));
+		SimUnit.RemainingMovement = static_cast<uint8>(FMath::Clamp(Unit->RemainingMovement, 0, 255));
+		SimUnit.TileIndex = static_cast<uint32>(TileIndex);
+		SimUnit.SubSlotIndex = static_cast<uint8>(Unit->SubSlotIndex);
+		SimUnit.bHasMined = Unit->bHasMinedThisTurn ? 1 : 0;
+
+		FLairSimTile& SimTile = OutState.Tiles[TileIndex];
+		SimTile.OccupiedMask |= FLairMatchState::GetSubSlotBits(Unit->SubSlotIndex, Rules.UnitTypes[TypeIndex].SubSlotSize);
+		SimTile.OccupantOwner = SimUnit.OwnerIndex;
+	}
+
+	OutState.Gold.Reset();
+	for (int32 PlayerIndex = 0; PlayerIndex < Rules.NumPlayers; ++PlayerIndex)
+	{
+		const ALairPlayerState* PlayerState = GetPlayerState(PlayerIndex);
+		OutState.Gold.Add(PlayerState ? PlayerState->GetGold() : 0);
+	}
+
+	OutState.Phase = TurnManager->GetCurrentPhase();
+	OutState.CurrentPlayerIndex = TurnManager->GetCurrentPlayerIndex();
+	OutState.TurnNumber = TurnManager->GetTurnNumber();
+	OutState.WinnerIndex = VictoryManager ? VictoryManager->GetWinnerIndex() : INDEX_NONE;
+	OutState.bGameOver = OutState.WinnerIndex != INDEX_NONE;
+	OutState.Random = Random;
+	OutState.MiningDeck = MiningSystem->GetDeck();
+
+	return true;
+}
+
+AUnit* ALairGameMode::GetMatchUnit(int32 UnitIndex) const
+{
+	return MatchUnits.IsValidIndex(UnitIndex) && IsValid(MatchUnits[UnitIndex]) ? MatchUnits[UnitIndex] : nullptr;
+}
+
+bool ALairGameMode::CanApplyMatchState(const FLairMatchState& State) const
+{
+	if (!MatchRules.IsValid() || !State.Rules.IsValid() || !BoardSystem || !TurnManager || !MiningSystem
+		|| State.Rules->BoardSize != MatchRules->BoardSize || State.Rules->UnitTypeNames != MatchRules->UnitTypeNames
+		|| State.Gold.Num() != PlayerStates.Num())
+	{
+		UE_LOG(LogLair, Warning, TEXT("ALairGameMode::CanApplyMatchState - State does not fit this match"));
+		return false;
+	}
+
+	// Sub-slot sizes may differ from when the state was recorded (a save from before a rules
+	// edit), so make sure no two placed units claim the same sub-slot
+	TArray<uint8> OccupiedMasks;
+	OccupiedMasks.SetNumZeroed(MatchRules->GetNumTiles());
+	for (const FLairSimUnit& SimUnit : State.Units)
+	{
+		if (SimUnit.OwnerIndex == INDEX_NONE || SimUnit.CurrentHP == 0)
+		{
+			continue;
+		}
+
+		const int32 SubSlotSize = MatchRules->UnitTypes.IsValidIndex(SimUnit.TypeIndex) ? MatchRules->UnitTypes[SimUnit.TypeIndex].SubSlotSize : 0;
+		const uint8 SlotBits = FLairMatchState::GetSubSlotBits(SimUnit.SubSlotIndex, SubSlotSize);
+		if (SubSlotSize <= 0 || SimUnit.SubSlotIndex + SubSlotSize > LairConstants::TILE_SUB_SLOTS
+			|| !OccupiedMasks.IsValidIndex(SimUnit.TileIndex) || (OccupiedMasks[SimUnit.TileIndex] & SlotBits))
+		{
+			UE_LOG(LogLair, Warning, TEXT("ALairGameMode::CanApplyMatchState - Units overlap on tile %d under the current sub-slot sizes"),
+				SimUnit.TileIndex);
+			return false;
+		}
+		OccupiedMasks[SimUnit.TileIndex] |= SlotBits;
+	}
+
+	return true;
+}
+
+bool ALairGameMode::ApplyMatchState(const FLairMatchState& State)
+{
+	if (!CanApplyMatchState(State))
+	{
+		return false;
+	}
+
+	if (AIPlanner)
+	{
+		AIPlanner->CancelThinking();
+	}
+
+	// History does not survive a jump to another state
+	UndoStack.Reset();
+	OnUndoStackChanged.Broadcast(false, false);
+
+	// Turn first: per-turn listeners (unit refresh) run now, then units are overwritten below
+	TurnManager->SetTotalPlayers(State.Rules->NumPlayers);
+	TurnManager->RestoreTurnState(State.CurrentPlayerIndex, State.Phase, State.TurnNumber);
+	EventBus.Flush();
+
+	// Lift every unit off the board so placement below never collides with a stale slot
+	for (AUnit* Unit : MatchUnits)
+	{
+		if (IsValid(Unit) && Unit->CurrentTile)
+		{
+			Unit->CurrentTile->RemoveUnitFromSubSlot(Unit);
+			Unit->SetCurrentTile(nullptr, 0);
+		}
+	}
+
+	for (int32 UnitIndex = State.Units.Num(); UnitIndex < MatchUnits.Num(); ++UnitIndex)
+	{
+		ReleaseMatchUnit(UnitIndex);
+	}
+	MatchUnits.SetNum(State.Units.Num());
+
+	for (int32 UnitIndex = 0; UnitIndex < State.Units.Num(); ++UnitIndex)
+	{
+		const FLairSimUnit& SimUnit = State.Units[UnitIndex];
+		ATile* Tile = BoardSystem->GetTileAt(MatchRules->GetTileCoord(SimUnit.TileIndex));
+
+		if (SimUnit.OwnerIndex == INDEX_NONE || SimUnit.CurrentHP == 0 || !Tile)
+		{
+			ReleaseMatchUnit(UnitIndex);
+			continue;
+		}
+
+		const FName UnitTypeID = MatchRules->UnitTypeNames[SimUnit.TypeIndex];
+		AUnit* Unit = GetMatchUnit(UnitIndex);
+
+		// Keep the actor when it is the same unit; otherwise replace it
+		if (Unit && (Unit->UnitTypeID != UnitTypeID || Unit->OwnerPlayerIndex != SimUnit.OwnerIndex))
+		{
+			ReleaseMatchUnit(UnitIndex);
+			Unit = nullptr;
+		}
+
+		if (Unit)
+		{
+			Tile->PlaceUnitInSubSlot(Unit, SimUnit.SubSlotIndex);
+			Unit->SetCurrentTile(Tile, SimUnit.SubSlotIndex);
+		}
+		else
+		{
+			Unit = SpawnUnit(SimUnit.OwnerIndex, SimUnit.TypeIndex, Tile, SimUnit.SubSlotIndex);
+			MatchUnits[UnitIndex] = Unit;
+		}
+
+		if (Unit)
+		{
+			Unit->CurrentHP = SimUnit.CurrentHP;
+			Unit->RemainingMovement = SimUnit.RemainingMovement;
+			Unit->bHasMinedThisTurn = SimUnit.bHasMined != 0;
+		}
+	}
+
+	for (int32 PlayerIndex = 0; PlayerIndex < PlayerStates.Num(); ++PlayerIndex)
+	{
+		if (PlayerStates[PlayerIndex])
+		{
+			PlayerStates[PlayerIndex]->SetGold(State.Gold[PlayerIndex]);
+		}
+	}
+
+	// The mining system draws from Random's mining stream, so both are restored together
+	Random = State.Random;
+	MiningSystem->RestoreDeck(State.MiningDeck);
+
+	// Victory counters are reseeded from the restored player states (a seek may go back past a win)
+	EventBus.Flush();
+	if (VictoryManager)
+	{
+		VictoryManager->Initialize(VictoryConditionsDataTable, NumberOfPlayers);
+		for (ALairPlayerState* PlayerState : PlayerStates)
+		{
+			VictoryManager->RegisterPlayerState(PlayerState);
+		}
+	}
+	CheckVictoryConditions();
+	SyncNetGameState(true);
+
+	return true;
+}
+
+void ALairGameMode::ReleaseMatchUnit(int32 UnitIndex)
+{
+	AUnit* Unit = GetMatchUnit(UnitIndex);
+	if (!Unit)
+	{
+		return;
+	}
+
+	if (Unit->CurrentTile)
+	{
+		Unit->CurrentTile->RemoveUnitFromSubSlot(Unit);
 	}
+
+	if (ALairPlayerState* PlayerState = GetPlayerState(Unit->OwnerPlayerIndex))
+	{
+		PlayerState->RemoveOwnedUnit(Unit);
+	}
+
+	// Park the actor instead of destroying it; the next spawn picks it up
+	Unit->SetCurrentTile(nullptr, 0);
+	Unit->SetActorHiddenInGame(true);
+	Unit->SetActorEnableCollision(false);
+	UnitPool.Add(Unit);
+	MatchUnits[UnitIndex] = nullptr;
+}
+
+bool ALairGameMode::ExecuteCommand(const FLairCommand& Command)
+{
+	if (!TurnManager || !MatchRules.IsValid())
+	{
+		return false;
+	}
+
+	if (Command.PlayerIndex != TurnManager->GetCurrentPlayerIndex())
+	{
+		UE_LOG(LogLairTurn, Warning, TEXT("ALairGameMode::ExecuteCommand - Not player %d's turn"), Command.PlayerIndex);
+		return false;
+	}
+
+	if (VictoryManager && VictoryManager->GetWinnerIndex() != INDEX_NONE)
+	{
+		UE_LOG(LogLairTurn, Warning, TEXT("ALairGameMode::ExecuteCommand - Game is over"));
+		return false;
+	}
+
+	if (ActiveReplay.IsValid())
+	{
+		UE_LOG(LogLairTurn, Warning, TEXT("ALairGameMode::ExecuteCommand - Replay is playing"));
+		return false;
+	}
+
+	// A command issued by a listener mid-action would be logged out of order
+	if (bExecutingCommand)
+	{
+		UE_LOG(LogLairTurn, Warning, TEXT("ALairGameMode::ExecuteCommand - Nested command rejected"));
+		return false;
+	}
+	TGuardValue<bool> ExecutingGuard(bExecutingCommand, true);
+
+	FLairUndoRecord UndoRecord;
+	BeginUndoRecord(Command, UndoRecord);
+
+	bool bExecuted = false;
+	switch (Command.Type)
+	{
+	case ELairCommandType::Purchase:
+		bExecuted = ExecutePurchase(Command.PlayerIndex, Command.UnitType);
+		break;
+
+	case ELairCommandType::Mine:
+		bExecuted = ExecuteMine(Command.PlayerIndex, Command.UnitIndex);
+		break;
+
+	case ELairCommandType::Move:
+		bExecuted = ExecuteMove(Command.PlayerIndex, Command.UnitIndex, Command.TargetTile);
+		break;
+
+	case ELairCommandType::AdvancePhase:
+		TurnManager->AdvancePhase();
+		bExecuted = true;
+		break;
+
+	case ELairCommandType::EndTurn:
+		TurnManager->EndTurn();
+		CheckVictoryConditions();
+		bExecuted = true;
+		break;
+
+	default:
+		break;
+	}
+
+	if (bExecuted)
+	{
+		CommandLog.Append(Command);
+		FinishUndoRecord(UndoRecord);
+	}
+
+	// One action, one delivery
+	EventBus.Flush();
+	if (bExecuted)
+	{
+		OnUndoStackChanged.Broadcast(UndoStack.CanUndo(), UndoStack.CanRedo());
+		SyncNetGameState();
+		BroadcastLockstep(TurnManager->GetCurrentPlayerIndex() != Command.PlayerIndex);
+	}
+	return bExecuted;
+}
+
+void ALairGameMode::SyncNetGameState(bool bBoardLayoutChanged)
+{
+	// Hotseat games have no clients to feed; lockstep peers simulate the state themselves
+	ALairGameState* LairGameState = GetGameState<ALairGameState>();
+	if (!LairGameState || GetNetMode() == NM_Standalone || bLockstepMode || !MatchRules.IsValid())
+	{
+		return;
+	}
+
+	if (bBoardLayoutChanged)
+	{
+		LairGameState->SetBoardLayout(MatchRules->BoardSize, GatherTileTypes());
+	}
+
+	FLairMatchState State;
+	if (CaptureMatchState(State))
+	{
+		LairGameState->SyncMatchState(State);
+	}
+}
+
+void ALairGameMode::StartLockstepPeers()
+{
+	LockstepSentBytes = CommandLog.GetNumBytes();
+	LockstepCheckpointCommands = INDEX_NONE;
+
+	// Peers start from the current state rather than replaying the log, which may
+	// predate a loaded save or a rules change
+	FLairMatchState Keyframe;
+	if (!bLockstepMode || LockstepPeers.Num() == 0 || !CaptureMatchState(Keyframe))
+	{
+		return;
+	}
+
+	for (const TWeakObjectPtr<ULairLockstepComponent>& Peer : LockstepPeers)
+	{
+		if (Peer.IsValid())
+		{
+			Peer->StartPeer(Keyframe, CommandLog.Num(), CommandLog.GetMatchSeed());
+		}
+	}
+}
+
+void ALairGameMode::BroadcastLockstep(bool bTurnPassed)
+{
+	if (!bLockstepMode || LockstepPeers.Num() == 0)
+	{
+		LockstepSentBytes = CommandLog.GetNumBytes();
+		return;
+	}
+
+	// A few bytes per action
+	const TArray<uint8>& LogData = CommandLog.GetData();
+	const TArray<uint8> Records(LogData.GetData() + LockstepSentBytes, LogData.Num() - LockstepSentBytes);
+	LockstepSentBytes = LogData.Num();
+
+	for (const TWeakObjectPtr<ULairLockstepComponent>& Peer : LockstepPeers)
+	{
+		if (Peer.IsValid())
+		{
+			Peer->SendRecords(Records);
+		}
+	}
+
+	if (!bTurnPassed || !CaptureMatchState(LockstepCheckpoint))
+	{
+		return;
+	}
+
+	// Sent after the records on the same reliable channel, so peers check the same point
+	LockstepCheckpointCommands = CommandLog.Num();
+	const uint64 Checksum = LockstepCheckpoint.ComputeChecksum();
+	for (const TWeakObjectPtr<ULairLockstepComponent>& Peer : LockstepPeers)
+	{
+		if (Peer.IsValid())
+		{
+			Peer->SendChecksum(LockstepCheckpointCommands, LockstepCheckpoint.TurnNumber, Checksum);
+		}
+	}
+}
+
+void ALairGameMode::HandleLockstepDesync(ULairLockstepComponent* Peer, int32 NumCommands, const TArray<uint8>& StateBytes)
+{
+	if (!Peer || !MatchRules.IsValid())
+	{
+		return;
+	}
+
+	if (NumCommands != LockstepCheckpointCommands || !LockstepCheckpoint.Rules.IsValid())
+	{
+		UE_LOG(LogLair, Error, TEXT("ALairGameMode::HandleLockstepDesync - Player %d desynced after %d commands (host checkpoint at %d)"),
+			Peer->GetPlayerIndex(), NumCommands, LockstepCheckpointCommands);
+		Peer->OnDesyncNative.Broadcast(LockstepCheckpoint.TurnNumber, FString());
+		return;
+	}
+
+	FLairMatchState PeerState;
+	PeerState.Rules = LockstepCheckpoint.Rules;
+	FMemoryReader Reader(StateBytes);
+	PeerState.Serialize(Reader);
+
+	const FString Difference = Reader.IsError()
+		? FString(TEXT("unreadable peer state"))
+		: LockstepCheckpoint.DescribeFirstDifference(PeerState);
+
+	UE_LOG(LogLair, Error, TEXT("ALairGameMode::HandleLockstepDesync - Player %d desynced at turn %d, first difference (host vs peer): %s"),
+		Peer->GetPlayerIndex(), LockstepCheckpoint.TurnNumber, *Difference);
+	Peer->OnDesyncNative.Broadcast(LockstepCheckpoint.TurnNumber, Difference);
+}
+
+void ALairGameMode::BeginUndoRecord(const FLairCommand& Command, FLairUndoRecord& OutRecord) const
+{
+	OutRecord.Command = Command;
+	OutRecord.LogOffset = CommandLog.GetNumBytes();
+	OutRecord.PhaseBefore = TurnManager->GetCurrentPhase();
+	OutRecord.PlayerBefore = TurnManager->GetCurrentPlayerIndex();
+	OutRecord.TurnBefore = TurnManager->GetTurnNumber();
+
+	for (int32 PlayerIndex = 0; PlayerIndex < LairConstants::MAX_PLAYERS; ++PlayerIndex)
+	{
+		const ALairPlayerState* PlayerState = GetPlayerState(PlayerIndex);
+		OutRecord.GoldBefore[PlayerIndex] = PlayerState ? PlayerState->GetGold() : 0;
+	}
+
+	switch (Command.Type)
+	{
+	case ELairCommandType::Move:
+		if (const AUnit* Unit = GetMatchUnit(Command.UnitIndex))
+		{
+			OutRecord.UnitIndex = Command.UnitIndex;
+			OutRecord.TileIndex = Unit->CurrentTile ? MatchRules->GetTileIndex(Unit->CurrentTile->GridCoord) : INDEX_NONE;
+			OutRecord.SubSlotIndex = Unit->SubSlotIndex;
+			OutRecord.MovementBefore = Unit->RemainingMovement;
+		}
+		break;
+
+	case ELairCommandType::AdvancePhase:
+	case ELairCommandType::EndTurn:
+		// A new turn refreshes units; keep what the acting player had left
+		for (int32 UnitIndex = 0; UnitIndex < MatchUnits.Num(); ++UnitIndex)
+		{
+			const AUnit* Unit = GetMatchUnit(UnitIndex);
+			if (Unit && Unit->OwnerPlayerIndex == Command.PlayerIndex)
+			{
+				FLairUndoUnitState& UnitState = OutRecord.TurnUnits.AddDefaulted_GetRef();
+				UnitState.UnitIndex = static_cast<uint16>(UnitIndex);
+				UnitState.RemainingMovement = static_cast<uint8>(Unit->RemainingMovement);
+				UnitState.bHasMined = Unit->bHasMinedThisTurn ? 1 : 0;
+			}
+		}
+		break;
+
+	default:
+		break;
+	}
+}
+
+void ALairGameMode::FinishUndoRecord(FLairUndoRecord& Record)
+{
+	// Barriers: a mining draw reveals the deck, the AI does not take back its moves, a won game is final
+	const bool bHumanAction = !AIPlanner || !AIPlanner->IsAIPlayer(Record.Command.PlayerIndex);
+	const bool bGameOver = VictoryManager && VictoryManager->GetWinnerIndex() != INDEX_NONE;
+	if (Record.Command.Type == ELairCommandType::Mine || !bHumanAction || bGameOver)
+	{
+		UndoStack.Reset();
+		return;
+	}
+
+	for (int32 PlayerIndex = 0; PlayerIndex < LairConstants::MAX_PLAYERS; ++PlayerIndex)
+	{
+		const ALairPlayerState* PlayerState = GetPlayerState(PlayerIndex);
+		Record.GoldAfter[PlayerIndex] = PlayerState ? PlayerState->GetGold() : 0;
+	}
+
+	if (Record.Command.Type == ELairCommandType::Purchase)
+	{
+		// Purchases append to the match units
+		Record.UnitIndex = MatchUnits.Num() - 1;
+	}
+
+	UndoStack.Push(MoveTemp(Record), bRedoing);
+}
+
+bool ALairGameMode::ExecuteMove(int32 PlayerIndex, int32 UnitIndex, int32 TargetTileIndex)
+{
+	AUnit* Unit = GetMatchUnit(UnitIndex);
+	if (!Unit || Unit->OwnerPlayerIndex != PlayerIndex || !Unit->CurrentTile || !BoardSystem)
+	{
+		UE_LOG(LogLairBoard, Warning, TEXT("ALairGameMode::ExecuteMove - Invalid unit %d"), UnitIndex);
+		return false;
+	}
+
+	if (TurnManager->GetCurrentPhase() != ETurnPhase::MovementCombat)
+	{
+		UE_LOG(LogLairBoard, Warning, TEXT("ALairGameMode::ExecuteMove - Not in MovementCombat phase"));
+		return false;
+	}
+
+	const FIntPoint From = Unit->CurrentTile->GridCoord;
+	const FIntPoint To = MatchRules->GetTileCoord(TargetTileIndex);
+	ATile* TargetTile = BoardSystem->GetTileAt(To);
+	const int32 MoveCost = BoardSystem->GetMovementCost(From, To);
+
+	if (!TargetTile || MoveCost <= 0 || MoveCost > Unit->RemainingMovement || !BoardSystem->IsTileWalkable(To))
+	{
+		UE_LOG(LogLairBoard, Warning, TEXT("ALairGameMode::ExecuteMove - Illegal move (%d, %d) -> (%d, %d)"),
+			From.X, From.Y, To.X, To.Y);
+		return false;
+	}
+
+	// Combat is not implemented yet: tiles held by the enemy are blocked
+	for (const AUnit* Occupant : TargetTile->GetAllUnitsOnTile())
+	{
+		if (Occupant && Occupant->OwnerPlayerIndex != PlayerIndex)
+		{
+			UE_LOG(LogLairBoard, Warning, TEXT("ALairGameMode::ExecuteMove - Tile (%d, %d) is held by the enemy"), To.X, To.Y);
+			return false;
+		}
+	}
+
+	const int32 SubSlot = TargetTile->FindAvailableSubSlot(Unit->GetSubSlotSize());
+	if (SubSlot < 0)
+	{
+		UE_LOG(LogLairBoard, Warning, TEXT("ALairGameMode::ExecuteMove - No room at (%d, %d)"), To.X, To.Y);
+		return false;
+	}
+
+	Unit->CurrentTile->RemoveUnitFromSubSlot(Unit);
+	TargetTile->PlaceUnitInSubSlot(Unit, SubSlot);
+	Unit->SetCurrentTile(TargetTile, SubSlot);
+	Unit->RemainingMovement -= MoveCost;
+
+	UE_LOG(LogLairBoard, Verbose, TEXT("ALairGameMode::ExecuteMove - Unit %d moved (%d, %d) -> (%d, %d), %d movement left"),
+		UnitIndex, From.X, From.Y, To.X, To.Y, Unit->RemainingMovement);
+
+	return true;
+}
+
+bool ALairGameMode::ExecuteMine(int32 PlayerIndex, int32 UnitIndex)
+{
+	AUnit* Unit = GetMatchUnit(UnitIndex);
+	if (!Unit || Unit->OwnerPlayerIndex != PlayerIndex || !Unit->CurrentTile || !MiningSystem)
+	{
+		UE_LOG(LogLairEconomy, Warning, TEXT("ALairGameMode::ExecuteMine - Invalid unit %d"), UnitIndex);
+		return false;
+	}
+
+	if (TurnManager->GetCurrentPhase() != ETurnPhase::Mining || Unit->bHasMinedThisTurn
+		|| !Unit->GetUnitTypeData().bCanMine || !BoardSystem || !BoardSystem->HasTileFlag(Unit->CurrentTile->GridCoord, ELairTileFlags::CanMine))
+	{
+		UE_LOG(LogLairEconomy, Warning, TEXT("ALairGameMode::ExecuteMine - Unit %d cannot mine now"), UnitIndex);
+		return false;
+	}
+
+	Unit->bHasMinedThisTurn = true;
+
+	const FMiningResult Result = MiningSystem->DrawMiningCard(Unit, Unit->CurrentTile);
+	if (Result.GoldValue > 0 && PlayerStates.IsValidIndex(PlayerIndex) && PlayerStates[PlayerIndex])
+	{
+		PlayerStates[PlayerIndex]->AddGold(Result.GoldValue);
+	}
+
+	CheckVictoryConditions();
+	return true;
+}
+
+void ALairGameMode::HandlePlayerChanged(const FLairEvent& Event)
+{
+	const int32 NewPlayerIndex = Event.NewValue;
+
+	// Refresh the incoming player's units for their turn
+	for (AUnit* Unit : MatchUnits)
+	{
+		if (IsValid(Unit) && Unit->OwnerPlayerIndex == NewPlayerIndex)
+		{
+			Unit->ResetMovement();
+			Unit->bHasMinedThisTurn = false;
+		}
+	}
+
+	if (!AIPlanner)
+	{
+		return;
+	}
+
+	AIPlanner->CancelThinking();
+
+	// Replays only show recorded moves
+	if (ActiveReplay.IsValid())
+	{
+		return;
+	}
+
+	// Plan from a clean stack rather than inside the action that ended the previous turn
+	if (AIPlanner->IsAIPlayer(NewPlayerIndex))
+	{
+		GetWorldTimerManager().SetTimerForNextTick(this, &ALairGameMode::StartAITurn);
+	}
+}
+
+void ALairGameMode::StartAITurn()
+{
+	// The turn may have been taken back (undo) before this tick
+	FLairMatchState Snapshot;
+	if (!AIPlanner || !CaptureMatchState(Snapshot) || Snapshot.bGameOver || !AIPlanner->IsAIPlayer(Snapshot.CurrentPlayerIndex))
+	{
+		return;
+	}
+
+	// Policy randomness comes from the AI stream so seeded matches replay identically
+	const uint64 PolicySeed = Random.GetStream(ELairRandomStream::AI).Next();
+	AIPlanner->StartThinking(Snapshot, PolicySeed);
+}
+
+void ALairGameMode::HandleAITurnPlanned(int32 PlayerIndex, const TArray<FLairCommand>& Commands)
+{
+	if (!TurnManager || TurnManager->GetCurrentPlayerIndex() != PlayerIndex)
+	{
+		UE_LOG(LogLair, Warning, TEXT("ALairGameMode::HandleAITurnPlanned - Plan for player %d is stale"), PlayerIndex);
+		return;
+	}
+
+	for (const FLairCommand& Command : Commands)
+	{
+		if (!ExecuteCommand(Command))
+		{
+			// The plan diverged from the live game; hand the turn on rather than stall
+			UE_LOG(LogLair, Warning, TEXT("ALairGameMode::HandleAITurnPlanned - Command rejected, ending turn"));
+			if (TurnManager->GetCurrentPlayerIndex() == PlayerIndex)
+			{
+				EndCurrentTurn();
+			}
+			return;
+		}
+
+		// Stop once the turn has passed on (EndTurn / final AdvancePhase)
+		if (TurnManager->GetCurrentPlayerIndex() != PlayerIndex)
+		{
+			return;
+		}
+	}
+}
+
+void ALairGameMode::HandleRulesDataChanged(const TArray<uint8>& ChangedUnitTypes, const TArray<uint8>& ChangedTileTypes)
+{
+	if (!RulesEngine)
+	{
+		return;
+	}
+
+	// Rows were updated in place, so tiles and units already see the new values; re-derive what they cache
+	if (BoardSystem && ChangedTileTypes.Num() > 0)
+	{
+		TArray<FName> TileTypeIDs;
+		for (const uint8 TileTypeId : ChangedTileTypes)
+		{
+			TileTypeIDs.Add(RulesEngine->GetRulesTable().TileTypeNames[TileTypeId]);
+		}
+		BoardSystem->RefreshTileTypes(TileTypeIDs);
+	}
+
+	if (ChangedUnitTypes.Num() > 0)
+	{
+		for (AUnit* Unit : MatchUnits)
+		{
+			if (Unit && ChangedUnitTypes.Contains(RulesEngine->FindUnitTypeId(Unit->UnitTypeID)))
+			{
+				Unit->RefreshTypeData();
+			}
+		}
+	}
+
+	// The headless rules hold their own copy, and the log and undo history were recorded under
+	// the old one: recompile, then re-key the match from the current position
+	if (MatchRules.IsValid())
+	{
+		const bool bWasThinking = AIPlanner && AIPlanner->IsThinking();
+		if (AIPlanner)
+		{
+			AIPlanner->CancelThinking();
+		}
+
+		BuildMatchRules();
+		CommandLog.Reset(CommandLog.GetMatchSeed());
+		UndoStack.Reset();
+		OnUndoStackChanged.Broadcast(false, false);
+		SyncNetGameState(ChangedTileTypes.Num() > 0);
+		StartLockstepPeers();
+
+		// A turn being planned under the old rules was dropped above; plan it again
+		if (bWasThinking)
+		{
+			GetWorldTimerManager().SetTimerForNextTick(this, &ALairGameMode::StartAITurn);
+		}
+	}
+
+	UE_LOG(LogLair, Log, TEXT("ALairGameMode::HandleRulesDataChanged - Applied %d unit type and %d tile type edits"),
+		ChangedUnitTypes.Num(), ChangedTileTypes.Num());
+}
+
+// ============================================================================
+// Undo / Redo
+// ============================================================================
+
+bool ALairGameMode::Undo()
+{
+	// Peers cannot take back commands they have already applied
+	if (!UndoStack.CanUndo() || bExecutingCommand || ActiveReplay.IsValid() || bLockstepMode || !TurnManager || !MatchRules.IsValid())
+	{
+		return false;
+	}
+
+	if (AIPlanner)
+	{
+		AIPlanner->CancelThinking();
+	}
+
+	const FLairUndoRecord& Record = UndoStack.Undo();
+
+	switch (Record.Command.Type)
+	{
+	case ELairCommandType::Purchase:
+		// The purchase added the newest unit; park it for the next spawn
+		if (Record.UnitIndex == MatchUnits.Num() - 1)
+		{
+			ReleaseMatchUnit(Record.UnitIndex);
+			MatchUnits.Pop(false);
+		}
+		break;
+
+	case ELairCommandType::Move:
+		if (AUnit* Unit = GetMatchUnit(Record.UnitIndex))
+		{
+			ATile* FromTile = BoardSystem ? BoardSystem->GetTileAt(MatchRules->GetTileCoord(Record.TileIndex)) : nullptr;
+			if (FromTile)
+			{
+				if (Unit->CurrentTile)
+				{
+					Unit->CurrentTile->RemoveUnitFromSubSlot(Unit);
+				}
+				FromTile->PlaceUnitInSubSlot(Unit, Record.SubSlotIndex);
+				Unit->SetCurrentTile(FromTile, Record.SubSlotIndex);
+			}
+			Unit->RemainingMovement = Record.MovementBefore;
+		}
+		break;
+
+	case ELairCommandType::AdvancePhase:
+	case ELairCommandType::EndTurn:
+		// Restoring the turn refreshes the acting player's units; put back what they had left
+		TurnManager->RestoreTurnState(Record.PlayerBefore, Record.PhaseBefore, Record.TurnBefore);
+		EventBus.Flush();
+		for (const FLairUndoUnitState& UnitState : Record.TurnUnits)
+		{
+			if (AUnit* Unit = GetMatchUnit(UnitState.UnitIndex))
+			{
+				Unit->RemainingMovement = UnitState.RemainingMovement;
+				Unit->bHasMinedThisTurn = UnitState.bHasMined != 0;
+			}
+		}
+		break;
+
+	default:
+		break;
+	}
+
+	for (int32 PlayerIndex = 0; PlayerIndex < LairConstants::MAX_PLAYERS; ++PlayerIndex)
+	{
+		ALairPlayerState* PlayerState = GetPlayerState(PlayerIndex);
+		if (PlayerState && Record.GoldBefore[PlayerIndex] != Record.GoldAfter[PlayerIndex])
+		{
+			PlayerState->SetGold(Record.GoldBefore[PlayerIndex]);
+		}
+	}
+
+	CommandLog.RemoveLast(Record.LogOffset);
+
+	// One refresh for the whole revert
+	EventBus.Flush();
+	OnUndoStackChanged.Broadcast(UndoStack.CanUndo(), UndoStack.CanRedo());
+	SyncNetGameState();
+	return true;
+}
+
+bool ALairGameMode::Redo()
+{
+	if (!UndoStack.CanRedo() || bExecutingCommand)
+	{
+		return false;
+	}
+
+	const FLairCommand Command = UndoStack.PeekRedo().Command;
+
+	bool bRedone = false;
+	{
+		TGuardValue<bool> RedoGuard(bRedoing, true);
+		bRedone = ExecuteCommand(Command);
+	}
+
+	// The game no longer matches the redo chain
+	if (!bRedone)
+	{
+		UndoStack.ClearRedo();
+		OnUndoStackChanged.Broadcast(UndoStack.CanUndo(), UndoStack.CanRedo());
+	}
+
+	return bRedone;
+}
+
+// ============================================================================
+// Save / Load
+// ============================================================================
+
+bool ALairGameMode::SaveGameToSlot(const FString& SlotName)
+{
+	FLairMatchState State;
+	if (ActiveReplay.IsValid() || !CaptureMatchState(State))
+	{
+		UE_LOG(LogLair, Warning, TEXT("ALairGameMode::SaveGameToSlot - No match in progress"));
+		return false;
+	}
+
+	// Serializing is cheap; only the disk write leaves the game thread
+	TSharedRef<TArray<uint8>, ESPMode::ThreadSafe> Bytes = MakeShared<TArray<uint8>, ESPMode::ThreadSafe>();
+	FLairSaveGame::Save(State, GatherTileTypes(), CommandLog, *Bytes);
+
+	const FString FilePath = FLairSaveGame::GetSlotPath(SlotName);
+	auto WriteSave = [Bytes, FilePath]()
+	{
+		FLairSaveGame::WriteFile(FilePath, *Bytes);
+	};
+
+	PendingSaveTask = PendingSaveTask.IsValid()
+		? UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(WriteSave), UE::Tasks::Prerequisites(PendingSaveTask))
+		: UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(WriteSave));
+
+	UE_LOG(LogLair, Verbose, TEXT("ALairGameMode::SaveGameToSlot - Queued %d bytes for %s"), Bytes->Num(), *FilePath);
+	return true;
+}
+
+bool ALairGameMode::LoadGameFromSlot(const FString& SlotName)
+{
+	if (!MatchRules.IsValid() || !BoardSystem || !RulesEngine)
+	{
+		UE_LOG(LogLair, Warning, TEXT("ALairGameMode::LoadGameFromSlot - Start a game before loading"));
+		return false;
+	}
+
+	if (PendingSaveTask.IsValid())
+	{
+		PendingSaveTask.Wait();
+	}
+
+	const FString FilePath = FLairSaveGame::GetSlotPath(SlotName);
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *FilePath))
+	{
+		UE_LOG(LogLair, Warning, TEXT("ALairGameMode::LoadGameFromSlot - Failed to read %s"), *FilePath);
+		return false;
+	}
+
+	FLairMatchState State;
+	TArray<FName> TileTypes;
+	FLairCommandLog LoadedLog;
+	if (!FLairSaveGame::Load(Bytes, MatchRules, State, TileTypes, LoadedLog))
+	{
+		return false;
+	}
+
+	// Nothing is touched until the whole save is known to apply; terrain only changes tile
+	// flags, which the check does not depend on
+	if (!CanApplyMatchState(State))
+	{
+		UE_LOG(LogLair, Warning, TEXT("ALairGameMode::LoadGameFromSlot - %s does not fit this match"), *FilePath);
+		return false;
+	}
+
+	// Terrain only needs touching (and the rules recompiling) where it differs from the board
+	bool bTerrainChanged = false;
+	const TArray<FName> CurrentTileTypes = GatherTileTypes();
+	for (int32 TileIndex = 0; TileIndex < TileTypes.Num(); ++TileIndex)
+	{
+		ATile* Tile = BoardSystem->GetTileAt(MatchRules->GetTileCoord(TileIndex));
+		if (Tile && TileTypes[TileIndex] != CurrentTileTypes[TileIndex])
+		{
+			BoardSystem->SetTileType(Tile, TileTypes[TileIndex]);
+			bTerrainChanged = true;
+		}
+	}
+	if (bTerrainChanged)
+	{
+		BuildMatchRules();
+		State.Rules = MatchRules;
+	}
+
+	ActiveReplay.Reset();
+	if (!ApplyMatchState(State))
+	{
+		return false;
+	}
+	CommandLog = MoveTemp(LoadedLog);
+
+	// Peers restart from a keyframe of the loaded position
+	StartLockstepPeers();
+
+	// Edits held back by a replay that was showing apply to the loaded match
+	if (RulesEngine)
+	{
+		RulesEngine->SetDeferTableEdits(false);
+	}
+
+	UE_LOG(LogLair, Log, TEXT("ALairGameMode::LoadGameFromSlot - Loaded %s (turn %d, %d units)"),
+		*FilePath, State.TurnNumber, State.Units.Num());
+	return true;
+}
+
+void ALairGameMode::HandleTurnChanged(const FLairEvent& Event)
+{
+	// Save from a clean stack once the action that changed the turn has been logged
+	if (bAutosave && !ActiveReplay.IsValid())
+	{
+		GetWorldTimerManager().SetTimerForNextTick(this, &ALairGameMode::Autosave);
+	}
+}
+
+void ALairGameMode::Autosave()
+{
+	SaveGameToSlot(AutosaveSlotName);
+}
+
+TArray<FName> ALairGameMode::GatherTileTypes() const
+{
+	TArray<FName> TileTypes;
+	if (!MatchRules.IsValid() || !BoardSystem)
+	{
+		return TileTypes;
+	}
+
+	TileTypes.SetNum(MatchRules->GetNumTiles());
+	for (int32 TileIndex = 0; TileIndex < TileTypes.Num(); ++TileIndex)
+	{
+		const ATile* Tile = BoardSystem->GetTileAt(MatchRules->GetTileCoord(TileIndex));
+		TileTypes[TileIndex] = Tile ? Tile->TileTypeID : NAME_None;
+	}
+	return TileTypes;
+}
+
+// ============================================================================
+// Replay
+// ============================================================================
+
+bool ALairGameMode::SaveReplay(const FString& FilePath) const
+{
+	if (!MatchRules.IsValid())
+	{
+		UE_LOG(LogLair, Warning, TEXT("ALairGameMode::SaveReplay - No match in progress"));
+		return false;
+	}
+
+	// A rules edit mid-match re-keys the log from the edited position, so it no longer
+	// reproduces the match from its start
+	FLairReplay Recording;
+	FLairMatchState Replayed;
+	FLairMatchState Current;
+	if (!Recording.Build(MatchRules, CommandLog) || !Recording.SeekToCommand(Recording.GetNumCommands(), Replayed)
+		|| !CaptureMatchState(Current) || Replayed.ComputeChecksum() != Current.ComputeChecksum())
+	{
+		UE_LOG(LogLair, Warning, TEXT("ALairGameMode::SaveReplay - The command log does not reproduce this match (rules edited mid-match)"));
+		return false;
+	}
+
+	return FLairReplay::SaveToFile(FilePath, *MatchRules, CommandLog);
+}
+
+bool ALairGameMode::LoadReplay(const FString& FilePath)
+{
+	LLM_SCOPE_BYTAG(Lair_Replay);
+
+	if (!MatchRules.IsValid())
+	{
+		UE_LOG(LogLair, Warning, TEXT("ALairGameMode::LoadReplay - Start a game before loading a replay"));
+		return false;
+	}
+
+	TSharedPtr<FLairReplay> Replay = MakeShared<FLairReplay>();
+	if (!Replay->LoadFromFile(FilePath))
+	{
+		// A replay cut at a bad command is still built, but playing it would show a different match
+		UE_LOG(LogLair, Warning, TEXT("ALairGameMode::LoadReplay - %s could not be fully loaded"), *FilePath);
+		return false;
+	}
+
+	// The board actors come from this match's data tables, so the recording must use the same rules
+	if (Replay->GetRules()->ComputeFingerprint() != MatchRules->ComputeFingerprint())
+	{
+		UE_LOG(LogLair, Warning, TEXT("ALairGameMode::LoadReplay - %s was recorded with different rules or board"), *FilePath);
+		return false;
+	}
+
+	ActiveReplay = Replay;
+
+	// The replay plays back under the rules it was recorded with
+	if (RulesEngine)
+	{
+		RulesEngine->SetDeferTableEdits(true);
+	}
+
+	UE_LOG(LogLair, Log, TEXT("ALairGameMode::LoadReplay - Loaded %s (%d commands, %d turns)"),
+		*FilePath, Replay->GetNumCommands(), Replay->GetLastTurn());
+
+	return SeekReplayToTurn(1);
+}
+
+bool ALairGameMode::SeekReplayToTurn(int32 TurnNumber)
+{
+	return ActiveReplay.IsValid() && SeekReplayToCommand(ActiveReplay->GetTurnStartCommand(TurnNumber));
+}
+
+bool ALairGameMode::SeekReplayToCommand(int32 CommandIndex)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	FLairMatchState State;
+	if (!ActiveReplay.IsValid() || !ActiveReplay->SeekToCommand(CommandIndex, State) || !ApplyMatchState(State))
+	{
+		return false;
+	}
+
+	// The live log becomes the recording up to here, so StopReplay resumes a consistent match
+	const int32 NumCommands = FMath::Clamp(CommandIndex, 0, ActiveReplay->GetNumCommands());
+	CommandLog.Reset(ActiveReplay->GetCommandLog().GetMatchSeed());
+	for (int32 Index = 0; Index < NumCommands; ++Index)
+	{
+		CommandLog.Append(ActiveReplay->GetCommands()[Index]);
+	}
+	StartLockstepPeers();
+
+	UE_LOG(LogLair, Log, TEXT("ALairGameMode::SeekReplayToCommand - Command %d (turn %d) in %.2f ms"),
+		NumCommands, State.TurnNumber, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+	return true;
+}
+
+void ALairGameMode::StopReplay()
+{
+	if (!ActiveReplay.IsValid())
+	{
+		return;
+	}
+
+	ActiveReplay.Reset();
+
+	// Edits made while the replay played apply to the match it hands back
+	if (RulesEngine)
+	{
+		RulesEngine->SetDeferTableEdits(false);
+	}
+
+	// Hand the shown position back to the AI if it is its turn
+	if (AIPlanner && TurnManager && AIPlanner->IsAIPlayer(TurnManager->GetCurrentPlayerIndex()))
+	{
+		GetWorldTimerManager().SetTimerForNextTick(this, &ALairGameMode::StartAITurn);
+	}
+}
+
+int32 ALairGameMode::GetReplayLastTurn() const
+{
+	return ActiveReplay.IsValid() ? ActiveReplay->GetLastTurn() : 0;
 }
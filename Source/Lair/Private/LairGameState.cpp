@@ -0,0 +1,545 @@
+// LairGameState.cpp
+// Game State (Network Replication)
+
+#include "LairGameState.h"
+#include "LairLog.h"
+#include "LairMatchState.h"
+#include "Net/UnrealNetwork.h"
+#include "Serialization/BitWriter.h"
+
+namespace
+{
+	/** Owners go on the wire as Owner + 1 (0 = none) */
+	constexpr uint32 OWNER_RANGE = LairConstants::MAX_PLAYERS + 1;
+
+	/** One bit per sub-slot */
+	constexpr uint32 SUB_SLOT_MASK_RANGE = 1u << LairConstants::TILE_SUB_SLOTS;
+
+	/** Grid coordinates as two varints (one byte each on boards up to 128 tiles across) */
+	void SerializePackedCoord(FArchive& Ar, FIntPoint& Coord)
+	{
+		uint32 X = static_cast<uint32>(FMath::Max(Coord.X, 0));
+		uint32 Y = static_cast<uint32>(FMath::Max(Coord.Y, 0));
+		Ar.SerializeIntPacked(X);
+		Ar.SerializeIntPacked(Y);
+		Coord = FIntPoint(static_cast<int32>(X), static_cast<int32>(Y));
+	}
+
+	/** Owner index in the fewest bits MAX_PLAYERS allows */
+	void SerializePackedOwner(FArchive& Ar, int8& Owner)
+	{
+		uint32 Value = static_cast<uint32>(FMath::Clamp<int32>(Owner + 1, 0, OWNER_RANGE - 1));
+		Ar.SerializeInt(Value, OWNER_RANGE);
+		Owner = static_cast<int8>(static_cast<int32>(Value) - 1);
+	}
+
+	/** Packed payload size of one entry, for the per-turn wire budget */
+	template<typename ItemType>
+	int64 GetPackedBits(const ItemType& Item)
+	{
+		ItemType Copy = Item;
+		FBitWriter Writer(0, true);
+		bool bSuccess = false;
+		Copy.NetSerialize(Writer, nullptr, bSuccess);
+		return Writer.GetNumBits();
+	}
+
+	/** Fast array removals cost about one replication ID each */
+	constexpr int64 REMOVED_ENTRY_BITS = 32;
+
+	/** Run-length encode one chunk of palette indices */
+	void EncodeTerrainChunk(const TArray<uint8>& Indices, int32 ChunkIndex, FLairNetTerrainChunk& OutChunk)
+	{
+		const int32 FirstTile = ChunkIndex * FLairNetTerrainChunk::TILES_PER_CHUNK;
+		const int32 EndTile = FMath::Min(FirstTile + FLairNetTerrainChunk::TILES_PER_CHUNK, Indices.Num());
+
+		OutChunk.ChunkIndex = static_cast<uint16>(ChunkIndex);
+		OutChunk.RunLengths.Reset();
+		OutChunk.RunTypes.Reset();
+
+		for (int32 TileIndex = FirstTile; TileIndex < EndTile;)
+		{
+			const uint8 Type = Indices[TileIndex];
+			int32 RunEnd = TileIndex + 1;
+			while (RunEnd < EndTile && Indices[RunEnd] == Type)
+			{
+				++RunEnd;
+			}
+
+			OutChunk.RunLengths.Add(static_cast<uint16>(RunEnd - TileIndex));
+			OutChunk.RunTypes.Add(Type);
+			TileIndex = RunEnd;
+		}
+	}
+}
+
+// ============================================================================
+// FLairNetTerrainChunk
+// ============================================================================
+
+bool FLairNetTerrainChunk::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	uint32 Index = ChunkIndex;
+	Ar.SerializeIntPacked(Index);
+	ChunkIndex = static_cast<uint16>(Index);
+
+	uint32 NumRuns = RunLengths.Num();
+	Ar.SerializeIntPacked(NumRuns);
+
+	if (Ar.IsLoading())
+	{
+		// A chunk never has more runs than tiles
+		if (NumRuns > static_cast<uint32>(TILES_PER_CHUNK))
+		{
+			Ar.SetError();
+			bOutSuccess = false;
+			return true;
+		}
+
+		RunLengths.SetNumUninitialized(NumRuns);
+		RunTypes.SetNumUninitialized(NumRuns);
+	}
+
+	for (uint32 RunIndex = 0; RunIndex < NumRuns; ++RunIndex)
+	{
+		uint32 Length = RunLengths[RunIndex];
+		Ar.SerializeIntPacked(Length);
+		RunLengths[RunIndex] = static_cast<uint16>(Length);
+		Ar << RunTypes[RunIndex];
+	}
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
+
+void FLairNetTerrainChunk::PostReplicatedAdd(const FLairNetTerrainArray& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->ApplyTerrainChunk(*this);
+	}
+}
+
+void FLairNetTerrainChunk::PostReplicatedChange(const FLairNetTerrainArray& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->ApplyTerrainChunk(*this);
+	}
+}
+
+// ============================================================================
+// FLairNetTile
+// ============================================================================
+
+bool FLairNetTile::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	SerializePackedCoord(Ar, Coord);
+
+	uint32 Mask = OccupiedMask;
+	Ar.SerializeInt(Mask, SUB_SLOT_MASK_RANGE);
+	OccupiedMask = static_cast<uint8>(Mask);
+
+	SerializePackedOwner(Ar, OccupantOwner);
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
+
+void FLairNetTile::PostReplicatedAdd(const FLairNetTileArray& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->OnNetTileChangedNative.Broadcast(*this);
+	}
+}
+
+void FLairNetTile::PostReplicatedChange(const FLairNetTileArray& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->OnNetTileChangedNative.Broadcast(*this);
+	}
+}
+
+void FLairNetTile::PreReplicatedRemove(const FLairNetTileArray& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		// Removal means the tile emptied
+		FLairNetTile Emptied = *this;
+		Emptied.OccupiedMask = 0;
+		Emptied.OccupantOwner = INDEX_NONE;
+		InArraySerializer.Owner->OnNetTileChangedNative.Broadcast(Emptied);
+	}
+}
+
+// ============================================================================
+// FLairNetUnit
+// ============================================================================
+
+bool FLairNetUnit::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	uint32 Index = UnitIndex;
+	Ar.SerializeIntPacked(Index);
+	UnitIndex = static_cast<uint16>(Index);
+
+	SerializePackedOwner(Ar, OwnerIndex);
+
+	// Empty slots carry nothing else
+	if (OwnerIndex != INDEX_NONE)
+	{
+		Ar << TypeIndex << CurrentHP << RemainingMovement;
+		SerializePackedCoord(Ar, Coord);
+
+		uint32 SubSlot = SubSlotIndex;
+		Ar.SerializeInt(SubSlot, LairConstants::TILE_SUB_SLOTS);
+		SubSlotIndex = static_cast<uint8>(SubSlot);
+
+		uint8 Mined = bHasMined ? 1 : 0;
+		Ar.SerializeBits(&Mined, 1);
+		bHasMined = (Mined & 1) != 0;
+	}
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
+
+void FLairNetUnit::PostReplicatedAdd(const FLairNetUnitArray& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->OnNetUnitChangedNative.Broadcast(*this);
+	}
+}
+
+void FLairNetUnit::PostReplicatedChange(const FLairNetUnitArray& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->OnNetUnitChangedNative.Broadcast(*this);
+	}
+}
+
+void FLairNetUnit::PreReplicatedRemove(const FLairNetUnitArray& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->OnNetUnitRemovedNative.Broadcast(UnitIndex);
+	}
+}
+
+// ============================================================================
+// ALairGameState
+// ============================================================================
+
+ALairGameState::ALairGameState()
+{
+	TerrainChunks.Owner = this;
+	NetTiles.Owner = this;
+	NetUnits.Owner = this;
+}
+
+void ALairGameState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(ALairGameState, BoardSize);
+	DOREPLIFETIME(ALairGameState, TileTypePalette);
+	DOREPLIFETIME(ALairGameState, TerrainChunks);
+	DOREPLIFETIME(ALairGameState, NetTiles);
+	DOREPLIFETIME(ALairGameState, NetUnits);
+	DOREPLIFETIME(ALairGameState, TurnState);
+}
+
+void ALairGameState::SetBoardLayout(FIntPoint InBoardSize, const TArray<FName>& TileTypes)
+{
+	TArray<FName> Palette;
+	TArray<uint8> Indices;
+	Indices.SetNumUninitialized(TileTypes.Num());
+	for (int32 TileIndex = 0; TileIndex < TileTypes.Num(); ++TileIndex)
+	{
+		Indices[TileIndex] = static_cast<uint8>(Palette.AddUnique(TileTypes[TileIndex]));
+	}
+	check(Palette.Num() <= MAX_uint8);
+
+	// Unchanged properties are not resent, so only real terrain changes cost bandwidth
+	if (InBoardSize == BoardSize && Palette == TileTypePalette && Indices == TileTypeIndices)
+	{
+		return;
+	}
+
+	BoardSize = InBoardSize;
+	TileTypePalette = MoveTemp(Palette);
+	TileTypeIndices = MoveTemp(Indices);
+
+	// Chunk entry index == chunk index on the server (chunks are only appended or truncated)
+	const int32 NumChunks = FMath::DivideAndRoundUp(TileTypeIndices.Num(), FLairNetTerrainChunk::TILES_PER_CHUNK);
+	if (TerrainChunks.Items.Num() > NumChunks)
+	{
+		TerrainChunks.Items.SetNum(NumChunks);
+		TerrainChunks.MarkArrayDirty();
+	}
+
+	int32 NumDirtyChunks = 0;
+	int64 DirtyBits = 0;
+	for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex)
+	{
+		FLairNetTerrainChunk Chunk;
+		EncodeTerrainChunk(TileTypeIndices, ChunkIndex, Chunk);
+
+		if (!TerrainChunks.Items.IsValidIndex(ChunkIndex))
+		{
+			TerrainChunks.MarkItemDirty(TerrainChunks.Items.Add_GetRef(Chunk));
+		}
+		else if (!(TerrainChunks.Items[ChunkIndex] == Chunk))
+		{
+			FLairNetTerrainChunk& Existing = TerrainChunks.Items[ChunkIndex];
+			Existing.RunLengths = MoveTemp(Chunk.RunLengths);
+			Existing.RunTypes = MoveTemp(Chunk.RunTypes);
+			TerrainChunks.MarkItemDirty(Existing);
+		}
+		else
+		{
+			continue;
+		}
+
+		++NumDirtyChunks;
+		DirtyBits += GetPackedBits(TerrainChunks.Items[ChunkIndex]);
+	}
+
+	UE_LOG(LogLair, Log, TEXT("ALairGameState::SetBoardLayout - %dx%d board, %d tile types, %d of %d terrain chunks sent (~%lld bytes)"),
+		BoardSize.X, BoardSize.Y, TileTypePalette.Num(), NumDirtyChunks, NumChunks, (DirtyBits + 7) / 8);
+
+	// A new board invalidates every occupancy entry
+	NetTiles.Items.Reset();
+	NetTiles.MarkArrayDirty();
+	TileToEntry.Reset();
+
+	ForceNetUpdate();
+}
+
+void ALairGameState::SyncMatchState(const FLairMatchState& State)
+{
+	if (!State.Rules.IsValid())
+	{
+		return;
+	}
+
+	const FLairMatchRules& Rules = *State.Rules;
+	int32 NumDirty = 0;
+
+	if (State.TurnNumber != WireBudgetTurn)
+	{
+		WireBudgetTurn = State.TurnNumber;
+		TurnWireBits = 0;
+	}
+	const int64 PreviousWireBits = TurnWireBits;
+
+	// Tiles: entries exist only for occupied tiles
+	TileToEntry.Init(INDEX_NONE, Rules.GetNumTiles());
+	for (int32 EntryIndex = 0; EntryIndex < NetTiles.Items.Num(); ++EntryIndex)
+	{
+		const int32 TileIndex = Rules.GetTileIndex(NetTiles.Items[EntryIndex].Coord);
+		if (TileToEntry.IsValidIndex(TileIndex))
+		{
+			TileToEntry[TileIndex] = EntryIndex;
+		}
+	}
+
+	bool bTileRemoved = false;
+	for (int32 TileIndex = 0; TileIndex < State.Tiles.Num() && TileIndex < TileToEntry.Num(); ++TileIndex)
+	{
+		const FLairSimTile& SimTile = State.Tiles[TileIndex];
+		const int32 EntryIndex = TileToEntry[TileIndex];
+
+		if (SimTile.OccupiedMask == 0)
+		{
+			if (EntryIndex != INDEX_NONE)
+			{
+				// Mark for removal below
+				NetTiles.Items[EntryIndex].OccupiedMask = 0;
+				bTileRemoved = true;
+			}
+			continue;
+		}
+
+		FLairNetTile Entry;
+		Entry.Coord = Rules.GetTileCoord(TileIndex);
+		Entry.OccupiedMask = SimTile.OccupiedMask;
+		Entry.OccupantOwner = SimTile.OccupantOwner;
+
+		if (EntryIndex == INDEX_NONE)
+		{
+			NetTiles.MarkItemDirty(NetTiles.Items.Add_GetRef(Entry));
+			TurnWireBits += GetPackedBits(Entry);
+			++NumDirty;
+		}
+		else if (!(NetTiles.Items[EntryIndex] == Entry))
+		{
+			FLairNetTile& Existing = NetTiles.Items[EntryIndex];
+			Existing.OccupiedMask = Entry.OccupiedMask;
+			Existing.OccupantOwner = Entry.OccupantOwner;
+			NetTiles.MarkItemDirty(Existing);
+			TurnWireBits += GetPackedBits(Entry);
+			++NumDirty;
+		}
+	}
+
+	if (bTileRemoved)
+	{
+		const int32 NumRemoved = NetTiles.Items.RemoveAll([](const FLairNetTile& Entry) { return Entry.OccupiedMask == 0; });
+		NetTiles.MarkArrayDirty();
+		TurnWireBits += NumRemoved * REMOVED_ENTRY_BITS;
+		NumDirty += NumRemoved;
+	}
+
+	// Units: entry index == unit index on the server (units are only appended or truncated)
+	if (NetUnits.Items.Num() > State.Units.Num())
+	{
+		const int32 NumRemoved = NetUnits.Items.Num() - State.Units.Num();
+		TurnWireBits += NumRemoved * REMOVED_ENTRY_BITS;
+		NumDirty += NumRemoved;
+		NetUnits.Items.SetNum(State.Units.Num());
+		NetUnits.MarkArrayDirty();
+	}
+
+	for (int32 UnitIndex = 0; UnitIndex < State.Units.Num(); ++UnitIndex)
+	{
+		const FLairSimUnit& SimUnit = State.Units[UnitIndex];
+
+		FLairNetUnit Entry;
+		Entry.UnitIndex = static_cast<uint16>(UnitIndex);
+		Entry.OwnerIndex = SimUnit.OwnerIndex;
+		if (SimUnit.OwnerIndex != INDEX_NONE)
+		{
+			Entry.TypeIndex = SimUnit.TypeIndex;
+			Entry.CurrentHP = SimUnit.CurrentHP;
+			Entry.RemainingMovement = SimUnit.RemainingMovement;
+			Entry.Coord = Rules.GetTileCoord(SimUnit.TileIndex);
+			Entry.SubSlotIndex = SimUnit.SubSlotIndex;
+			Entry.bHasMined = SimUnit.bHasMined != 0;
+		}
+
+		if (!NetUnits.Items.IsValidIndex(UnitIndex))
+		{
+			NetUnits.MarkItemDirty(NetUnits.Items.Add_GetRef(Entry));
+			TurnWireBits += GetPackedBits(Entry);
+			++NumDirty;
+		}
+		else if (!(NetUnits.Items[UnitIndex] == Entry))
+		{
+			// Keep the entry's replication ID and key
+			FLairNetUnit& Existing = NetUnits.Items[UnitIndex];
+			static_cast<FFastArraySerializerItem&>(Entry) = Existing;
+			Existing = Entry;
+			NetUnits.MarkItemDirty(Existing);
+			TurnWireBits += GetPackedBits(Entry);
+			++NumDirty;
+		}
+	}
+
+	// Turn state is a plain property: replication sends it only when it differs
+	FLairNetTurnState NewTurnState;
+	NewTurnState.Phase = State.Phase;
+	NewTurnState.CurrentPlayerIndex = State.CurrentPlayerIndex;
+	NewTurnState.TurnNumber = State.TurnNumber;
+	NewTurnState.WinnerIndex = State.WinnerIndex;
+	NewTurnState.Gold.Append(State.Gold);
+	if (!(NewTurnState == TurnState))
+	{
+		// Plain property: phase byte plus three ints and the gold array
+		TurnWireBits += 8 + (3 + NewTurnState.Gold.Num()) * 32;
+		TurnState = MoveTemp(NewTurnState);
+		++NumDirty;
+	}
+
+	// Turn-based: push changes now instead of waiting for the next update interval
+	if (NumDirty > 0)
+	{
+		ForceNetUpdate();
+	}
+
+	// Warn once per turn, when the turn first goes over budget
+	constexpr int64 BudgetBits = static_cast<int64>(TURN_WIRE_BUDGET_BYTES) * 8;
+	if (PreviousWireBits <= BudgetBits && TurnWireBits > BudgetBits)
+	{
+		UE_LOG(LogLair, Warning, TEXT("ALairGameState::SyncMatchState - Turn %d has sent ~%lld bytes of state (budget %d)"),
+			WireBudgetTurn, (TurnWireBits + 7) / 8, TURN_WIRE_BUDGET_BYTES);
+	}
+
+	UE_LOG(LogLair, Verbose, TEXT("ALairGameState::SyncMatchState - %d dirty entries (%d tiles, %d units), ~%lld bytes this turn"),
+		NumDirty, NetTiles.Items.Num(), NetUnits.Items.Num(), (TurnWireBits + 7) / 8);
+}
+
+FName ALairGameState::GetTileType(FIntPoint Coord) const
+{
+	if (Coord.X < 0 || Coord.X >= BoardSize.X || Coord.Y < 0 || Coord.Y >= BoardSize.Y)
+	{
+		return NAME_None;
+	}
+
+	const int32 TileIndex = Coord.Y * BoardSize.X + Coord.X;
+	const int32 PaletteIndex = TileTypeIndices.IsValidIndex(TileIndex) ? TileTypeIndices[TileIndex] : INDEX_NONE;
+	return TileTypePalette.IsValidIndex(PaletteIndex) ? TileTypePalette[PaletteIndex] : NAME_None;
+}
+
+const FLairNetUnit* ALairGameState::FindNetUnit(int32 UnitIndex) const
+{
+	// Entries usually sit at their unit index; client order can differ after removals
+	if (NetUnits.Items.IsValidIndex(UnitIndex) && NetUnits.Items[UnitIndex].UnitIndex == UnitIndex)
+	{
+		return &NetUnits.Items[UnitIndex];
+	}
+
+	return NetUnits.Items.FindByPredicate([UnitIndex](const FLairNetUnit& Entry) { return Entry.UnitIndex == UnitIndex; });
+}
+
+void ALairGameState::OnRep_BoardLayout()
+{
+	// A smaller board drops its trailing chunks; trim what they had decoded
+	const int32 NumTiles = BoardSize.X * BoardSize.Y;
+	if (TileTypeIndices.Num() > NumTiles)
+	{
+		TileTypeIndices.SetNum(NumTiles);
+	}
+
+	OnNetBoardLayoutChangedNative.Broadcast();
+}
+
+void ALairGameState::ApplyTerrainChunk(const FLairNetTerrainChunk& Chunk)
+{
+	int32 NumTiles = 0;
+	bool bHasEmptyRun = false;
+	for (uint16 Length : Chunk.RunLengths)
+	{
+		NumTiles += Length;
+		bHasEmptyRun |= (Length == 0);
+	}
+
+	if (bHasEmptyRun || NumTiles > FLairNetTerrainChunk::TILES_PER_CHUNK || Chunk.RunLengths.Num() != Chunk.RunTypes.Num())
+	{
+		UE_LOG(LogLair, Warning, TEXT("ALairGameState::ApplyTerrainChunk - Chunk %d is malformed"), Chunk.ChunkIndex);
+		return;
+	}
+
+	const int32 FirstTile = Chunk.ChunkIndex * FLairNetTerrainChunk::TILES_PER_CHUNK;
+	if (TileTypeIndices.Num() < FirstTile + NumTiles)
+	{
+		TileTypeIndices.SetNumZeroed(FirstTile + NumTiles);
+	}
+
+	int32 TileIndex = FirstTile;
+	for (int32 RunIndex = 0; RunIndex < Chunk.RunLengths.Num(); ++RunIndex)
+	{
+		FMemory::Memset(&TileTypeIndices[TileIndex], Chunk.RunTypes[RunIndex], Chunk.RunLengths[RunIndex]);
+		TileIndex += Chunk.RunLengths[RunIndex];
+	}
+
+	OnNetBoardLayoutChangedNative.Broadcast();
+}
+
+void ALairGameState::OnRep_TurnState()
+{
+	OnNetTurnStateChangedNative.Broadcast(TurnState);
+}
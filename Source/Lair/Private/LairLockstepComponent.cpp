@@ -0,0 +1,248 @@
+// LairLockstepComponent.cpp
+// Lockstep Component (Command Exchange)
+
+#include "LairLockstepComponent.h"
+#include "LairLog.h"
+#include "LairGameMode.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+	/** Upper bound on a start payload (rules plus keyframe of the largest board) */
+	constexpr int32 MAX_START_PAYLOAD_BYTES = 16 * 1024 * 1024;
+}
+
+ULairLockstepComponent::ULairLockstepComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+	SetIsReplicatedByDefault(true);
+}
+
+// ============================================================================
+// Client
+// ============================================================================
+
+bool ULairLockstepComponent::SubmitCommand(const FLairCommand& Command)
+{
+	if (!IsMatchStarted() || Command.PlayerIndex != PlayerIndex || bDesynced)
+	{
+		return false;
+	}
+
+	// Reject locally what the host would reject anyway
+	if (!LocalState.IsCommandLegal(Command))
+	{
+		return false;
+	}
+
+	FLairCommandLog Encoder;
+	Encoder.Append(Command);
+	ServerSubmitCommand(Encoder.GetData());
+	return true;
+}
+
+void ULairLockstepComponent::ClientBeginMatch_Implementation(int32 InPlayerIndex, uint64 Seed, int32 InKeyframeCommands, int32 PayloadSize)
+{
+	// Nothing is submitted or applied until the new keyframe is in
+	LocalState = FLairMatchState();
+	LocalRules.Reset();
+
+	if (PayloadSize <= 0 || PayloadSize > MAX_START_PAYLOAD_BYTES || InKeyframeCommands < 0)
+	{
+		UE_LOG(LogLair, Error, TEXT("ULairLockstepComponent::ClientBeginMatch - Bad start payload size %d"), PayloadSize);
+		PendingPayloadSize = INDEX_NONE;
+		return;
+	}
+
+	PendingPlayerIndex = InPlayerIndex;
+	PendingSeed = Seed;
+	KeyframeCommands = InKeyframeCommands;
+	PendingPayloadSize = PayloadSize;
+	PendingPayload.Reset(PayloadSize);
+}
+
+void ULairLockstepComponent::ClientReceiveMatchChunk_Implementation(const TArray<uint8>& Chunk)
+{
+	if (PendingPayloadSize == INDEX_NONE || PendingPayload.Num() + Chunk.Num() > PendingPayloadSize)
+	{
+		UE_LOG(LogLair, Error, TEXT("ULairLockstepComponent::ClientReceiveMatchChunk - Unexpected start data"));
+		PendingPayloadSize = INDEX_NONE;
+		return;
+	}
+
+	PendingPayload.Append(Chunk);
+	if (PendingPayload.Num() == PendingPayloadSize)
+	{
+		FinishMatchStart();
+	}
+}
+
+void ULairLockstepComponent::FinishMatchStart()
+{
+	PendingPayloadSize = INDEX_NONE;
+
+	TSharedRef<FLairMatchRules> Rules = MakeShared<FLairMatchRules>();
+	FMemoryReader Reader(PendingPayload);
+	Rules->Serialize(Reader);
+	if (Reader.IsError() || Rules->GetNumTiles() == 0)
+	{
+		UE_LOG(LogLair, Error, TEXT("ULairLockstepComponent::FinishMatchStart - Could not read the match rules"));
+		return;
+	}
+
+	FLairMatchState Keyframe;
+	Keyframe.Initialize(Rules, PendingSeed);
+	Keyframe.Serialize(Reader);
+	if (Reader.IsError() || !Reader.AtEnd())
+	{
+		UE_LOG(LogLair, Error, TEXT("ULairLockstepComponent::FinishMatchStart - Could not read the keyframe"));
+		return;
+	}
+
+	PlayerIndex = PendingPlayerIndex;
+	LocalRules = Rules;
+	LocalState = MoveTemp(Keyframe);
+	LocalLog.Reset(PendingSeed);
+	ApplyOffset = 0;
+	bDesynced = false;
+	PendingPayload.Empty();
+
+	UE_LOG(LogLair, Log, TEXT("ULairLockstepComponent::FinishMatchStart - Player %d, seed %llu, joined at turn %d after %d commands"),
+		PlayerIndex, PendingSeed, LocalState.TurnNumber, KeyframeCommands);
+}
+
+void ULairLockstepComponent::ClientApplyRecords_Implementation(const TArray<uint8>& Records)
+{
+	if (!IsMatchStarted() || !LocalLog.AppendEncoded(Records))
+	{
+		return;
+	}
+
+	ApplyPendingRecords();
+}
+
+void ULairLockstepComponent::ClientVerifyChecksum_Implementation(int32 NumCommands, int32 TurnNumber, uint64 Checksum)
+{
+	if (!IsMatchStarted() || bDesynced)
+	{
+		return;
+	}
+
+	// Reliable RPCs arrive in order, so every record up to the checksum has been applied
+	const uint64 LocalChecksum = LocalState.ComputeChecksum();
+	const int32 LocalCommands = KeyframeCommands + LocalLog.Num();
+	if (LocalCommands == NumCommands && LocalChecksum == Checksum)
+	{
+		UE_LOG(LogLair, Verbose, TEXT("ULairLockstepComponent::ClientVerifyChecksum - Turn %d in sync (%016llx)"), TurnNumber, Checksum);
+		return;
+	}
+
+	bDesynced = true;
+	UE_LOG(LogLair, Error, TEXT("ULairLockstepComponent::ClientVerifyChecksum - Desync at turn %d: %d/%d commands, checksum %016llx, host %016llx"),
+		TurnNumber, LocalCommands, NumCommands, LocalChecksum, Checksum);
+	OnDesyncNative.Broadcast(TurnNumber, FString());
+
+	// Let the host pinpoint the difference against its own state
+	TArray<uint8> StateBytes;
+	FMemoryWriter Writer(StateBytes);
+	LocalState.Serialize(Writer);
+	ServerReportDesync(LocalCommands, StateBytes);
+}
+
+void ULairLockstepComponent::ApplyPendingRecords()
+{
+	FLairCommand Command;
+	while (LocalLog.Read(ApplyOffset, Command))
+	{
+		if (!LocalState.ApplyCommand(Command))
+		{
+			// The host executed it, so the local rules disagree: the next checksum reports the desync
+			UE_LOG(LogLair, Error, TEXT("ULairLockstepComponent::ApplyPendingRecords - Host command of type %d rejected locally"),
+				static_cast<int32>(Command.Type));
+		}
+		OnCommandAppliedNative.Broadcast(Command);
+	}
+}
+
+// ============================================================================
+// Host
+// ============================================================================
+
+void ULairLockstepComponent::StartPeer(const FLairMatchState& Keyframe, int32 InKeyframeCommands, uint64 Seed)
+{
+	check(Keyframe.Rules.IsValid());
+
+	// Rules and state only serialize from mutable objects; saving leaves the copies untouched
+	FLairMatchRules RulesCopy = *Keyframe.Rules;
+	FLairMatchState StateCopy = Keyframe;
+	TArray<uint8> Payload;
+	FMemoryWriter Writer(Payload);
+	RulesCopy.Serialize(Writer);
+	StateCopy.Serialize(Writer);
+
+	// Large boards exceed what one RPC can carry; reliable RPCs keep the pieces in order
+	ClientBeginMatch(PlayerIndex, Seed, InKeyframeCommands, Payload.Num());
+	for (int32 Offset = 0; Offset < Payload.Num(); Offset += START_CHUNK_BYTES)
+	{
+		const int32 ChunkSize = FMath::Min(START_CHUNK_BYTES, Payload.Num() - Offset);
+		ClientReceiveMatchChunk(TArray<uint8>(Payload.GetData() + Offset, ChunkSize));
+	}
+
+	UE_LOG(LogLair, Log, TEXT("ULairLockstepComponent::StartPeer - Player %d, keyframe at %d commands, %d bytes"),
+		PlayerIndex, InKeyframeCommands, Payload.Num());
+}
+
+void ULairLockstepComponent::SendRecords(const TArray<uint8>& Records)
+{
+	ClientApplyRecords(Records);
+}
+
+void ULairLockstepComponent::SendChecksum(int32 NumCommands, int32 TurnNumber, uint64 Checksum)
+{
+	ClientVerifyChecksum(NumCommands, TurnNumber, Checksum);
+}
+
+void ULairLockstepComponent::ServerSubmitCommand_Implementation(const TArray<uint8>& Record)
+{
+	ALairGameMode* GameMode = GetHostGameMode();
+	if (!GameMode)
+	{
+		return;
+	}
+
+	FLairCommandLog Decoder;
+	Decoder.Reset(0);
+	int32 Offset = 0;
+	FLairCommand Command;
+	if (!Decoder.AppendEncoded(Record) || !Decoder.Read(Offset, Command) || Offset != Record.Num())
+	{
+		UE_LOG(LogLair, Warning, TEXT("ULairLockstepComponent::ServerSubmitCommand - Malformed command"));
+		return;
+	}
+
+	// A peer only acts for its own player
+	if (Command.PlayerIndex != PlayerIndex)
+	{
+		UE_LOG(LogLair, Warning, TEXT("ULairLockstepComponent::ServerSubmitCommand - Peer for player %d sent a command for player %d"),
+			PlayerIndex, Command.PlayerIndex);
+		return;
+	}
+
+	// Executed commands reach every peer through the game mode
+	GameMode->ExecuteCommand(Command);
+}
+
+void ULairLockstepComponent::ServerReportDesync_Implementation(int32 NumCommands, const TArray<uint8>& StateBytes)
+{
+	if (ALairGameMode* GameMode = GetHostGameMode())
+	{
+		GameMode->HandleLockstepDesync(this, NumCommands, StateBytes);
+	}
+}
+
+ALairGameMode* ULairLockstepComponent::GetHostGameMode() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetAuthGameMode<ALairGameMode>() : nullptr;
+}
@@ -0,0 +1,734 @@
+// LairMatchState.cpp
+// Headless Match State (Simulation Core)
+
+#include "LairMatchState.h"
+#include "MiningSystemComponent.h"
+#include "Hash/CityHash.h"
+#include "Serialization/MemoryWriter.h"
+
+// ============================================================================
+// FLairMatchRules
+// ============================================================================
+
+TSharedRef<FLairMatchRules> FLairMatchRules::MakeDefault(int32 Size)
+{
+	TSharedRef<FLairMatchRules> Rules = MakeShared<FLairMatchRules>();
+
+	Size = FMath::Clamp(Size, 3, 255);
+	Rules->BoardSize = FIntPoint(Size, Size);
+	Rules->TileFlags.Init(ELairTileFlags::Walkable, Size * Size);
+
+	// Mining band along the anti-diagonal (equidistant from both corner bases)
+	for (int32 X = 0; X < Size; ++X)
+	{
+		const int32 Y = Size - 1 - X;
+		Rules->TileFlags[Rules->GetTileIndex(FIntPoint(X, Y))] |= ELairTileFlags::CanMine;
+	}
+
+	// Bases in opposite corners, matching UBoardSystemComponent::GenerateDefaultBoard
+	Rules->BaseTiles.Add(Rules->GetTileIndex(FIntPoint(0, 0)));
+	Rules->BaseTiles.Add(Rules->GetTileIndex(FIntPoint(Size - 1, Size - 1)));
+	Rules->NumPlayers = Rules->BaseTiles.Num();
+
+	Rules->AddDefaultUnitTypes();
+	Rules->CardTable = UMiningSystemComponent::MakeDefaultCardTable();
+	Rules->FinalizeBoard();
+
+	return Rules;
+}
+
+void FLairMatchRules::AddDefaultUnitTypes()
+{
+	// Same values as URulesEngineComponent's default unit data
+	auto AddUnitType = [this](const TCHAR* Name, int32 Cost, uint8 MovementPoints, uint8 SubSlotSize, bool bCanMine)
+	{
+		FLairUnitTypeStats Stats;
+		Stats.Cost = Cost;
+		Stats.MovementPoints = MovementPoints;
+		Stats.HitPoints = 1;
+		Stats.SubSlotSize = SubSlotSize;
+		Stats.bCanMine = bCanMine ? 1 : 0;
+
+		UnitTypeNames.Add(FName(Name));
+		UnitTypes.Add(Stats);
+	};
+
+	AddUnitType(TEXT("Miner"), 40, 4, 1, true);
+	AddUnitType(TEXT("Wagon"), 70, 6, 2, false);
+	AddUnitType(TEXT("Footman"), 50, 5, 1, false);
+}
+
+void FLairMatchRules::FinalizeBoard()
+{
+	const int32 NumTiles = GetNumTiles();
+	MineDistance.Init(MAX_uint16, NumTiles);
+
+	// Multi-source BFS from every walkable mining tile over walkable tiles (8-connected)
+	TArray<int32> Queue;
+	Queue.Reserve(NumTiles);
+	for (int32 TileIndex = 0; TileIndex < NumTiles; ++TileIndex)
+	{
+		const uint8 Flags = TileFlags[TileIndex];
+		if ((Flags & ELairTileFlags::Walkable) && (Flags & ELairTileFlags::CanMine))
+		{
+			MineDistance[TileIndex] = 0;
+			Queue.Add(TileIndex);
+		}
+	}
+
+	for (int32 Head = 0; Head < Queue.Num(); ++Head)
+	{
+		const int32 TileIndex = Queue[Head];
+		const FIntPoint Coord = GetTileCoord(TileIndex);
+
+		for (int32 DY = -1; DY <= 1; ++DY)
+		{
+			for (int32 DX = -1; DX <= 1; ++DX)
+			{
+				const int32 NeighborIndex = GetTileIndex(Coord + FIntPoint(DX, DY));
+				if (NeighborIndex == INDEX_NONE || MineDistance[NeighborIndex] != MAX_uint16
+					|| !(TileFlags[NeighborIndex] & ELairTileFlags::Walkable))
+				{
+					continue;
+				}
+
+				// Saturate below the unreachable marker on very long paths
+				MineDistance[NeighborIndex] = FMath::Min<uint16>(MineDistance[TileIndex] + 1, MAX_uint16 - 1);
+				Queue.Add(NeighborIndex);
+			}
+		}
+	}
+}
+
+void FLairMatchRules::Serialize(FArchive& Ar)
+{
+	Ar << UnitTypeNames;
+
+	int32 NumUnitTypes = UnitTypes.Num();
+	Ar << NumUnitTypes;
+	if (Ar.IsLoading())
+	{
+		UnitTypes.SetNum(FMath::Clamp(NumUnitTypes, 0, MAX_uint8));
+	}
+	for (FLairUnitTypeStats& Stats : UnitTypes)
+	{
+		Ar << Stats.Cost << Stats.MovementPoints << Stats.HitPoints << Stats.SubSlotSize << Stats.bCanMine;
+	}
+
+	Ar << BoardSize << TileFlags << BaseTiles;
+	Ar << StartingGold << GoldVictoryThreshold << MaxTurns << NumPlayers;
+
+	// Card table is shared and immutable, so it is rebuilt rather than edited in place
+	TArray<FMiningCardData> Cards;
+	if (Ar.IsSaving() && CardTable.IsValid())
+	{
+		Cards = *CardTable;
+	}
+
+	int32 NumCards = Cards.Num();
+	Ar << NumCards;
+	if (Ar.IsLoading())
+	{
+		Cards.SetNum(FMath::Clamp(NumCards, 0, MAX_uint16));
+	}
+	for (FMiningCardData& Card : Cards)
+	{
+		Ar << Card.OutcomeType << Card.OutcomeID << Card.GoldValue << Card.CopiesInDeck;
+	}
+
+	if (Ar.IsLoading())
+	{
+		CardTable = MakeShared<const TArray<FMiningCardData>>(MoveTemp(Cards));
+
+		// Checked in int64 so a hostile board size cannot overflow past the tile limit
+		const bool bValidBoard = BoardSize.X > 0 && BoardSize.Y > 0
+			&& static_cast<int64>(BoardSize.X) * BoardSize.Y <= MAX_TILES;
+		const bool bValid = bValidBoard && UnitTypeNames.Num() == UnitTypes.Num() && TileFlags.Num() == GetNumTiles()
+			&& NumPlayers >= 1 && NumPlayers <= LairConstants::MAX_PLAYERS && BaseTiles.Num() == NumPlayers
+			&& !BaseTiles.ContainsByPredicate([this](int32 BaseTile) { return BaseTile < 0 || BaseTile >= GetNumTiles(); });
+		if (!bValid)
+		{
+			Ar.SetError();
+			return;
+		}
+		FinalizeBoard();
+	}
+}
+
+uint64 FLairMatchRules::ComputeFingerprint() const
+{
+	// Serialize takes a mutable archive target; saving leaves the copy untouched
+	FLairMatchRules Copy = *this;
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	Copy.Serialize(Writer);
+	return CityHash64(reinterpret_cast<const char*>(Bytes.GetData()), Bytes.Num());
+}
+
+// ============================================================================
+// FLairMatchState
+// ============================================================================
+
+void FLairMatchState::Initialize(TSharedPtr<const FLairMatchRules> InRules, uint64 Seed)
+{
+	Rules = MoveTemp(InRules);
+	check(Rules.IsValid());
+
+	Tiles.Reset();
+	Tiles.SetNum(Rules->GetNumTiles());
+	Units.Reset();
+	Gold.Init(Rules->StartingGold, Rules->NumPlayers);
+
+	Phase = ETurnPhase::Purchase;
+	CurrentPlayerIndex = 0;
+	TurnNumber = 1;
+	WinnerIndex = INDEX_NONE;
+	bGameOver = false;
+
+	// Same order as ALairGameMode::StartGame: seed first, then shuffle the deck from the mining stream
+	Random.Initialize(Seed);
+	MiningDeck.Initialize(Rules->CardTable, Random.GetStream(ELairRandomStream::Mining));
+}
+
+int32 FLairMatchState::FindFreeSubSlot(uint8 OccupiedMask, int32 SubSlotSize)
+{
+	if (SubSlotSize == 2)
+	{
+		for (int32 SlotIndex = 0; SlotIndex < LairConstants::TILE_SUB_SLOTS - 1; ++SlotIndex)
+		{
+			if (!(OccupiedMask & GetSubSlotBits(SlotIndex, 2)))
+			{
+				return SlotIndex;
+			}
+		}
+		return INDEX_NONE;
+	}
+
+	if (SubSlotSize != 1)
+	{
+		return INDEX_NONE;
+	}
+
+	for (int32 SlotIndex = 0; SlotIndex < LairConstants::TILE_SUB_SLOTS; ++SlotIndex)
+	{
+		if (!(OccupiedMask & (1 << SlotIndex)))
+		{
+			return SlotIndex;
+		}
+	}
+	return INDEX_NONE;
+}
+
+int32 FLairMatchState::GetStepCost(int32 FromTile, int32 ToTile) const
+{
+	const FIntPoint From = Rules->GetTileCoord(FromTile);
+	const FIntPoint To = Rules->GetTileCoord(ToTile);
+	const int32 DeltaX = FMath::Abs(To.X - From.X);
+	const int32 DeltaY = FMath::Abs(To.Y - From.Y);
+
+	if (DeltaX + DeltaY == 1)
+	{
+		return LairConstants::ORTHOGONAL_MOVE_COST;
+	}
+	if (DeltaX == 1 && DeltaY == 1)
+	{
+		return LairConstants::DIAGONAL_MOVE_COST;
+	}
+	return -1;
+}
+
+void FLairMatchState::GetLegalCommands(TArray<FLairCommand>& OutCommands) const
+{
+	if (bGameOver)
+	{
+		return;
+	}
+
+	const int32 Player = CurrentPlayerIndex;
+
+	switch (Phase)
+	{
+	case ETurnPhase::Purchase:
+	{
+		const int32 BaseTile = Rules->BaseTiles[Player];
+		const FLairSimTile& Base = Tiles[BaseTile];
+		if (Base.OccupantOwner == INDEX_NONE || Base.OccupantOwner == Player)
+		{
+			for (int32 TypeIndex = 0; TypeIndex < Rules->UnitTypes.Num(); ++TypeIndex)
+			{
+				const FLairUnitTypeStats& Stats = Rules->UnitTypes[TypeIndex];
+				if (Stats.Cost <= Gold[Player] && FindFreeSubSlot(Base.OccupiedMask, Stats.SubSlotSize) != INDEX_NONE)
+				{
+					OutCommands.Add(FLairCommand::MakePurchase(Player, TypeIndex));
+				}
+			}
+		}
+		break;
+	}
+
+	case ETurnPhase::Mining:
+		for (int32 UnitIndex = 0; UnitIndex < Units.Num(); ++UnitIndex)
+		{
+			const FLairSimUnit& Unit = Units[UnitIndex];
+			if (Unit.OwnerIndex == Player && !Unit.bHasMined && Rules->UnitTypes[Unit.TypeIndex].bCanMine
+				&& (Rules->TileFlags[Unit.TileIndex] & ELairTileFlags::CanMine))
+			{
+				OutCommands.Add(FLairCommand::MakeMine(Player, UnitIndex));
+			}
+		}
+		break;
+
+	case ETurnPhase::MovementCombat:
+		for (int32 UnitIndex = 0; UnitIndex < Units.Num(); ++UnitIndex)
+		{
+			const FLairSimUnit& Unit = Units[UnitIndex];
+			if (Unit.OwnerIndex != Player || Unit.RemainingMovement == 0)
+			{
+				continue;
+			}
+
+			const FIntPoint Coord = Rules->GetTileCoord(Unit.TileIndex);
+			for (int32 DY = -1; DY <= 1; ++DY)
+			{
+				for (int32 DX = -1; DX <= 1; ++DX)
+				{
+					const int32 TargetTile = Rules->GetTileIndex(Coord + FIntPoint(DX, DY));
+					if (TargetTile != INDEX_NONE && TargetTile != static_cast<int32>(Unit.TileIndex))
+					{
+						const FLairCommand Move = FLairCommand::MakeMove(Player, UnitIndex, TargetTile);
+						if (IsCommandLegal(Move))
+						{
+							OutCommands.Add(Move);
+						}
+					}
+				}
+			}
+		}
+		break;
+
+	default:
+		break;
+	}
+
+	OutCommands.Add(FLairCommand::MakeSimple(ELairCommandType::AdvancePhase, Player));
+	OutCommands.Add(FLairCommand::MakeSimple(ELairCommandType::EndTurn, Player));
+}
+
+bool FLairMatchState::IsCommandLegal(const FLairCommand& Command) const
+{
+	if (bGameOver || Command.PlayerIndex != CurrentPlayerIndex)
+	{
+		return false;
+	}
+
+	const int32 Player = Command.PlayerIndex;
+
+	switch (Command.Type)
+	{
+	case ELairCommandType::Purchase:
+	{
+		if (Phase != ETurnPhase::Purchase || !Rules->UnitTypes.IsValidIndex(Command.UnitType))
+		{
+			return false;
+		}
+
+		const FLairUnitTypeStats& Stats = Rules->UnitTypes[Command.UnitType];
+		const FLairSimTile& Base = Tiles[Rules->BaseTiles[Player]];
+		return Stats.Cost <= Gold[Player]
+			&& (Base.OccupantOwner == INDEX_NONE || Base.OccupantOwner == Player)
+			&& FindFreeSubSlot(Base.OccupiedMask, Stats.SubSlotSize) != INDEX_NONE;
+	}
+
+	case ELairCommandType::Mine:
+	{
+		if (Phase != ETurnPhase::Mining || !Units.IsValidIndex(Command.UnitIndex))
+		{
+			return false;
+		}
+
+		const FLairSimUnit& Unit = Units[Command.UnitIndex];
+		return Unit.OwnerIndex == Player && !Unit.bHasMined && Rules->UnitTypes[Unit.TypeIndex].bCanMine
+			&& (Rules->TileFlags[Unit.TileIndex] & ELairTileFlags::CanMine);
+	}
+
+	case ELairCommandType::Move:
+	{
+		if (Phase != ETurnPhase::MovementCombat || !Units.IsValidIndex(Command.UnitIndex)
+			|| !Tiles.IsValidIndex(Command.TargetTile))
+		{
+			return false;
+		}
+
+		const FLairSimUnit& Unit = Units[Command.UnitIndex];
+		if (Unit.OwnerIndex != Player)
+		{
+			return false;
+		}
+
+		const int32 StepCost = GetStepCost(Unit.TileIndex, Command.TargetTile);
+		if (StepCost < 0 || StepCost > Unit.RemainingMovement
+			|| !(Rules->TileFlags[Command.TargetTile] & ELairTileFlags::Walkable))
+		{
+			return false;
+		}
+
+		// No combat in the headless ruleset yet: enemy-held tiles are blocked
+		const FLairSimTile& Target = Tiles[Command.TargetTile];
+		return (Target.OccupantOwner == INDEX_NONE || Target.OccupantOwner == Player)
+			&& FindFreeSubSlot(Target.OccupiedMask, Rules->UnitTypes[Unit.TypeIndex].SubSlotSize) != INDEX_NONE;
+	}
+
+	case ELairCommandType::AdvancePhase:
+	case ELairCommandType::EndTurn:
+		return true;
+
+	default:
+		return false;
+	}
+}
+
+bool FLairMatchState::ApplyCommand(const FLairCommand& Command)
+{
+	if (!IsCommandLegal(Command))
+	{
+		return false;
+	}
+
+	const int32 Player = Command.PlayerIndex;
+
+	switch (Command.Type)
+	{
+	case ELairCommandType::Purchase:
+	{
+		const FLairUnitTypeStats& Stats = Rules->UnitTypes[Command.UnitType];
+		const int32 BaseTile = Rules->BaseTiles[Player];
+		FLairSimTile& Base = Tiles[BaseTile];
+		const int32 SlotIndex = FindFreeSubSlot(Base.OccupiedMask, Stats.SubSlotSize);
+
+		FLairSimUnit& Unit = Units.AddDefaulted_GetRef();
+		Unit.TypeIndex = Command.UnitType;
+		Unit.OwnerIndex = static_cast<int8>(Player);
+		Unit.CurrentHP = Stats.HitPoints;
+		Unit.RemainingMovement = Stats.MovementPoints;
+		Unit.TileIndex = static_cast<uint32>(BaseTile);
+		Unit.SubSlotIndex = static_cast<uint8>(SlotIndex);
+
+		Base.OccupiedMask |= GetSubSlotBits(SlotIndex, Stats.SubSlotSize);
+		Base.OccupantOwner = static_cast<int8>(Player);
+		Gold[Player] -= Stats.Cost;
+		break;
+	}
+
+	case ELairCommandType::Mine:
+	{
+		FLairSimUnit& Unit = Units[Command.UnitIndex];
+		Unit.bHasMined = 1;
+
+		const int32 CardIndex = MiningDeck.DrawIndex(Random.GetStream(ELairRandomStream::Mining));
+		if (CardIndex != INDEX_NONE)
+		{
+			const FMiningCardData& Card = MiningDeck.GetCard(CardIndex);
+			if (Card.OutcomeType == EMiningOutcome::Mineral)
+			{
+				Gold[Player] += Card.GoldValue;
+			}
+		}
+		break;
+	}
+
+	case ELairCommandType::Move:
+	{
+		FLairSimUnit& Unit = Units[Command.UnitIndex];
+		const int32 SubSlotSize = Rules->UnitTypes[Unit.TypeIndex].SubSlotSize;
+
+		FLairSimTile& From = Tiles[Unit.TileIndex];
+		From.OccupiedMask &= ~GetSubSlotBits(Unit.SubSlotIndex, SubSlotSize);
+		if (From.OccupiedMask == 0)
+		{
+			From.OccupantOwner = INDEX_NONE;
+		}
+
+		FLairSimTile& To = Tiles[Command.TargetTile];
+		const int32 SlotIndex = FindFreeSubSlot(To.OccupiedMask, SubSlotSize);
+		To.OccupiedMask |= GetSubSlotBits(SlotIndex, SubSlotSize);
+		To.OccupantOwner = static_cast<int8>(Player);
+
+		Unit.RemainingMovement -= static_cast<uint8>(GetStepCost(Unit.TileIndex, Command.TargetTile));
+		Unit.TileIndex = Command.TargetTile;
+		Unit.SubSlotIndex = static_cast<uint8>(SlotIndex);
+		break;
+	}
+
+	case ELairCommandType::AdvancePhase:
+		// Same progression as UTurnManagerComponent::AdvancePhase
+		switch (Phase)
+		{
+		case ETurnPhase::Purchase:
+			Phase = ETurnPhase::Mining;
+			break;
+		case ETurnPhase::Mining:
+			Phase = ETurnPhase::MovementCombat;
+			break;
+		default:
+			AdvancePlayer();
+			break;
+		}
+		break;
+
+	case ELairCommandType::EndTurn:
+		AdvancePlayer();
+		break;
+
+	default:
+		break;
+	}
+
+	UpdateGameOver();
+	return true;
+}
+
+void FLairMatchState::AdvancePlayer()
+{
+	CurrentPlayerIndex = (CurrentPlayerIndex + 1) % Rules->NumPlayers;
+	if (CurrentPlayerIndex == 0)
+	{
+		TurnNumber++;
+	}
+	Phase = ETurnPhase::Purchase;
+
+	// Refresh the incoming player's units for their turn
+	for (FLairSimUnit& Unit : Units)
+	{
+		if (Unit.OwnerIndex == CurrentPlayerIndex)
+		{
+			Unit.RemainingMovement = Rules->UnitTypes[Unit.TypeIndex].MovementPoints;
+			Unit.bHasMined = 0;
+		}
+	}
+}
+
+void FLairMatchState::UpdateGameOver()
+{
+	if (bGameOver)
+	{
+		return;
+	}
+
+	if (Rules->GoldVictoryThreshold > 0)
+	{
+		for (int32 PlayerIndex = 0; PlayerIndex < Gold.Num(); ++PlayerIndex)
+		{
+			if (Gold[PlayerIndex] >= Rules->GoldVictoryThreshold)
+			{
+				WinnerIndex = PlayerIndex;
+				bGameOver = true;
+				return;
+			}
+		}
+	}
+
+	if (Rules->MaxTurns > 0 && TurnNumber > Rules->MaxTurns)
+	{
+		bGameOver = true;
+	}
+}
+
+uint64 FLairMatchState::ComputeHash() const
+{
+	uint64 Hash = CityHash64(reinterpret_cast<const char*>(Units.GetData()), Units.Num() * sizeof(FLairSimUnit));
+	Hash = CityHash64WithSeed(reinterpret_cast<const char*>(Tiles.GetData()), Tiles.Num() * sizeof(FLairSimTile), Hash);
+	Hash = CityHash64WithSeed(reinterpret_cast<const char*>(Gold.GetData()), Gold.Num() * sizeof(int32), Hash);
+
+	const int32 Header[4] = { static_cast<int32>(Phase), CurrentPlayerIndex, TurnNumber, WinnerIndex };
+	Hash = CityHash64WithSeed(reinterpret_cast<const char*>(Header), sizeof(Header), Hash);
+	Hash = CityHash64WithSeed(reinterpret_cast<const char*>(&MiningDeck.CurrentCardIndex), sizeof(int32), Hash);
+
+	return Hash;
+}
+
+uint64 FLairMatchState::ComputeChecksum() const
+{
+	uint64 Hash = ComputeHash();
+
+	for (int32 StreamIndex = 0; StreamIndex < static_cast<int32>(ELairRandomStream::Count); ++StreamIndex)
+	{
+		if (static_cast<ELairRandomStream>(StreamIndex) == ELairRandomStream::AI)
+		{
+			continue;
+		}
+
+		// Hash the generator words in place (no copy per checksum)
+		const FLairRandomStream& Stream = Random.GetStream(static_cast<ELairRandomStream>(StreamIndex));
+		Hash = CityHash64WithSeed(reinterpret_cast<const char*>(Stream.State), sizeof(Stream.State), Hash);
+	}
+
+	Hash = CityHash64WithSeed(reinterpret_cast<const char*>(MiningDeck.Order.GetData()), MiningDeck.Order.Num() * sizeof(uint16), Hash);
+	return Hash;
+}
+
+void FLairMatchState::Serialize(FArchive& Ar)
+{
+	check(Rules.IsValid());
+
+	int32 NumUnits = Units.Num();
+	Ar << NumUnits;
+	if (Ar.IsLoading())
+	{
+		Units.SetNumZeroed(FMath::Clamp(NumUnits, 0, static_cast<int32>(MAX_uint16)));
+		Tiles.SetNum(Rules->GetNumTiles());
+	}
+	for (FLairSimUnit& Unit : Units)
+	{
+		Ar << Unit.TypeIndex << Unit.OwnerIndex << Unit.CurrentHP << Unit.RemainingMovement
+			<< Unit.TileIndex << Unit.SubSlotIndex << Unit.bHasMined;
+	}
+	for (FLairSimTile& Tile : Tiles)
+	{
+		Ar << Tile.OccupiedMask << Tile.OccupantOwner;
+	}
+
+	int32 NumPlayers = Gold.Num();
+	Ar << NumPlayers;
+	if (Ar.IsLoading())
+	{
+		Gold.SetNumZeroed(FMath::Clamp(NumPlayers, 0, LairConstants::MAX_PLAYERS));
+	}
+	for (int32& PlayerGold : Gold)
+	{
+		Ar << PlayerGold;
+	}
+
+	uint8 PhaseValue = static_cast<uint8>(Phase);
+	Ar << PhaseValue << CurrentPlayerIndex << TurnNumber << WinnerIndex << bGameOver;
+	Phase = static_cast<ETurnPhase>(PhaseValue);
+
+	Ar << Random;
+
+	TArray<uint16> DeckOrder(MiningDeck.Order);
+	Ar << DeckOrder << MiningDeck.CurrentCardIndex;
+	if (Ar.IsLoading())
+	{
+		MiningDeck.CardTable = Rules->CardTable;
+		MiningDeck.Order = DeckOrder;
+	}
+}
+
+FString FLairMatchState::DescribeFirstDifference(const FLairMatchState& Other) const
+{
+	auto Describe = [](const TCHAR* Field, int32 Mine, int32 Theirs)
+	{
+		return FString::Printf(TEXT("%s: %d vs %d"), Field, Mine, Theirs);
+	};
+
+	if (Phase != Other.Phase)
+	{
+		return Describe(TEXT("Phase"), static_cast<int32>(Phase), static_cast<int32>(Other.Phase));
+	}
+	if (CurrentPlayerIndex != Other.CurrentPlayerIndex)
+	{
+		return Describe(TEXT("CurrentPlayerIndex"), CurrentPlayerIndex, Other.CurrentPlayerIndex);
+	}
+	if (TurnNumber != Other.TurnNumber)
+	{
+		return Describe(TEXT("TurnNumber"), TurnNumber, Other.TurnNumber);
+	}
+	if (WinnerIndex != Other.WinnerIndex)
+	{
+		return Describe(TEXT("WinnerIndex"), WinnerIndex, Other.WinnerIndex);
+	}
+
+	if (Gold.Num() != Other.Gold.Num())
+	{
+		return Describe(TEXT("Gold.Num"), Gold.Num(), Other.Gold.Num());
+	}
+	for (int32 PlayerIndex = 0; PlayerIndex < Gold.Num(); ++PlayerIndex)
+	{
+		if (Gold[PlayerIndex] != Other.Gold[PlayerIndex])
+		{
+			return Describe(*FString::Printf(TEXT("Gold[%d]"), PlayerIndex), Gold[PlayerIndex], Other.Gold[PlayerIndex]);
+		}
+	}
+
+	if (Units.Num() != Other.Units.Num())
+	{
+		return Describe(TEXT("Units.Num"), Units.Num(), Other.Units.Num());
+	}
+	for (int32 UnitIndex = 0; UnitIndex < Units.Num(); ++UnitIndex)
+	{
+		const FLairSimUnit& Mine = Units[UnitIndex];
+		const FLairSimUnit& Theirs = Other.Units[UnitIndex];
+		const TPair<const TCHAR*, TPair<int32, int32>> Fields[] =
+		{
+			{ TEXT("TypeIndex"), { Mine.TypeIndex, Theirs.TypeIndex } },
+			{ TEXT("OwnerIndex"), { Mine.OwnerIndex, Theirs.OwnerIndex } },
+			{ TEXT("CurrentHP"), { Mine.CurrentHP, Theirs.CurrentHP } },
+			{ TEXT("RemainingMovement"), { Mine.RemainingMovement, Theirs.RemainingMovement } },
+			{ TEXT("TileIndex"), { static_cast<int32>(Mine.TileIndex), static_cast<int32>(Theirs.TileIndex) } },
+			{ TEXT("SubSlotIndex"), { Mine.SubSlotIndex, Theirs.SubSlotIndex } },
+			{ TEXT("bHasMined"), { Mine.bHasMined, Theirs.bHasMined } }
+		};
+		for (const auto& Field : Fields)
+		{
+			if (Field.Value.Key != Field.Value.Value)
+			{
+				return Describe(*FString::Printf(TEXT("Units[%d].%s"), UnitIndex, Field.Key), Field.Value.Key, Field.Value.Value);
+			}
+		}
+	}
+
+	if (Tiles.Num() != Other.Tiles.Num())
+	{
+		return Describe(TEXT("Tiles.Num"), Tiles.Num(), Other.Tiles.Num());
+	}
+	for (int32 TileIndex = 0; TileIndex < Tiles.Num(); ++TileIndex)
+	{
+		if (Tiles[TileIndex].OccupiedMask != Other.Tiles[TileIndex].OccupiedMask)
+		{
+			return Describe(*FString::Printf(TEXT("Tiles[%d].OccupiedMask"), TileIndex),
+				Tiles[TileIndex].OccupiedMask, Other.Tiles[TileIndex].OccupiedMask);
+		}
+		if (Tiles[TileIndex].OccupantOwner != Other.Tiles[TileIndex].OccupantOwner)
+		{
+			return Describe(*FString::Printf(TEXT("Tiles[%d].OccupantOwner"), TileIndex),
+				Tiles[TileIndex].OccupantOwner, Other.Tiles[TileIndex].OccupantOwner);
+		}
+	}
+
+	if (MiningDeck.CurrentCardIndex != Other.MiningDeck.CurrentCardIndex)
+	{
+		return Describe(TEXT("MiningDeck.CurrentCardIndex"), MiningDeck.CurrentCardIndex, Other.MiningDeck.CurrentCardIndex);
+	}
+	if (MiningDeck.Order.Num() != Other.MiningDeck.Order.Num())
+	{
+		return Describe(TEXT("MiningDeck.Order.Num"), MiningDeck.Order.Num(), Other.MiningDeck.Order.Num());
+	}
+	for (int32 CardIndex = 0; CardIndex < MiningDeck.Order.Num(); ++CardIndex)
+	{
+		if (MiningDeck.Order[CardIndex] != Other.MiningDeck.Order[CardIndex])
+		{
+			return Describe(*FString::Printf(TEXT("MiningDeck.Order[%d]"), CardIndex),
+				MiningDeck.Order[CardIndex], Other.MiningDeck.Order[CardIndex]);
+		}
+	}
+
+	for (int32 StreamIndex = 0; StreamIndex < static_cast<int32>(ELairRandomStream::Count); ++StreamIndex)
+	{
+		const ELairRandomStream Stream = static_cast<ELairRandomStream>(StreamIndex);
+		if (Stream != ELairRandomStream::AI && !(Random.GetStream(Stream) == Other.Random.GetStream(Stream)))
+		{
+			return FString::Printf(TEXT("Random stream %d: states differ"), StreamIndex);
+		}
+	}
+
+	return FString();
+}
+
+int32 FLairMatchState::CountUnits(int32 PlayerIndex) const
+{
+	int32 Count = 0;
+	for (const FLairSimUnit& Unit : Units)
+	{
+		Count += (Unit.OwnerIndex == PlayerIndex) ? 1 : 0;
+	}
+	return Count;
+}
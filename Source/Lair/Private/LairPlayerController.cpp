@@ -2,7 +2,10 @@
 // Step 9: Player Controller (Input Handling)
 
 #include "LairPlayerController.h"
+#include "LairLog.h"
+#include "LairTrace.h"
 #include "LairGameMode.h"
+#include "LairLockstepComponent.h"
 #include "TurnManagerComponent.h"
 #include "Tile.h"
 #include "Unit.h"
@@ -17,6 +20,8 @@ ALairPlayerController::ALairPlayerController()
 	SelectedTile = nullptr;
 	SelectedUnit = nullptr;
 	GameModeRef = nullptr;
+
+	Lockstep = CreateDefaultSubobject<ULairLockstepComponent>(TEXT("Lockstep"));
 }
 
 void ALairPlayerController::BeginPlay()
@@ -35,7 +40,7 @@ void ALairPlayerController::BeginPlay()
 	InputMode.SetLockMouseToViewportBehavior(EMouseLockMode::DoNotLock);
 	SetInputMode(InputMode);
 
-	UE_LOG(LogTemp, Log, TEXT("ALairPlayerController::BeginPlay - Controller initialized"));
+	UE_LOG(LogLairInput, Log, TEXT("ALairPlayerController::BeginPlay - Controller initialized"));
 }
 
 void ALairPlayerController::SetupInputComponent()
@@ -48,12 +53,18 @@ void ALairPlayerController::SetupInputComponent()
 		// This works without requiring custom action mappings in project settings
 		InputComponent->BindKey(EKeys::LeftMouseButton, IE_Pressed, this, &ALairPlayerController::OnLeftMouseClick);
 		InputComponent->BindKey(EKeys::RightMouseButton, IE_Pressed, this, &ALairPlayerController::OnRightMouseClick);
+
+		// Hotseat undo/redo
+		InputComponent->BindKey(FInputChord(EKeys::Z, false, true, false, false), IE_Pressed, this, &ALairPlayerController::OnUndoClicked);
+		InputComponent->BindKey(FInputChord(EKeys::Y, false, true, false, false), IE_Pressed, this, &ALairPlayerController::OnRedoClicked);
 	}
 }
 
 void ALairPlayerController::OnLeftMouseClick()
 {
-	UE_LOG(LogTemp, Verbose, TEXT("ALairPlayerController::OnLeftMouseClick"));
+	TRACE_CPUPROFILER_EVENT_SCOPE(ALairPlayerController::OnLeftMouseClick);
+
+	UE_LOG(LogLairInput, Verbose, TEXT("ALairPlayerController::OnLeftMouseClick"));
 
 	// First check for unit under cursor
 	AUnit* UnitUnderCursor = GetUnitUnderCursor();
@@ -73,7 +84,9 @@ void ALairPlayerController::OnLeftMouseClick()
 
 void ALairPlayerController::OnRightMouseClick()
 {
-	UE_LOG(LogTemp, Verbose, TEXT("ALairPlayerController::OnRightMouseClick"));
+	TRACE_CPUPROFILER_EVENT_SCOPE(ALairPlayerController::OnRightMouseClick);
+
+	UE_LOG(LogLairInput, Verbose, TEXT("ALairPlayerController::OnRightMouseClick"));
 
 	// Right click clears selection
 	ClearSelection();
@@ -81,9 +94,21 @@ void ALairPlayerController::OnRightMouseClick()
 
 void ALairPlayerController::OnPurchaseButtonClicked(FName UnitTypeID)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(ALairPlayerController::OnPurchaseButtonClicked);
+
+	if (!GameModeRef && Lockstep && Lockstep->IsMatchStarted())
+	{
+		const int32 UnitType = Lockstep->GetLocalState().Rules->FindUnitType(UnitTypeID);
+		if (UnitType != INDEX_NONE)
+		{
+			SubmitToHost(FLairCommand::MakePurchase(GetLocalPlayerIndex(), UnitType));
+		}
+		return;
+	}
+
 	if (!GameModeRef)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ALairPlayerController::OnPurchaseButtonClicked - GameMode is null"));
+		UE_LOG(LogLairInput, Warning, TEXT("ALairPlayerController::OnPurchaseButtonClicked - GameMode is null"));
 		return;
 	}
 
@@ -93,25 +118,33 @@ void ALairPlayerController::OnPurchaseButtonClicked(FName UnitTypeID)
 
 	if (bSuccess)
 	{
-		UE_LOG(LogTemp, Log, TEXT("ALairPlayerController::OnPurchaseButtonClicked - Player %d purchased %s"),
+		UE_LOG(LogLairInput, Log, TEXT("ALairPlayerController::OnPurchaseButtonClicked - Player %d purchased %s"),
 			PlayerIndex, *UnitTypeID.ToString());
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ALairPlayerController::OnPurchaseButtonClicked - Purchase failed for %s"),
+		UE_LOG(LogLairInput, Warning, TEXT("ALairPlayerController::OnPurchaseButtonClicked - Purchase failed for %s"),
 			*UnitTypeID.ToString());
 	}
 }
 
 void ALairPlayerController::OnEndTurnClicked()
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(ALairPlayerController::OnEndTurnClicked);
+
+	if (SubmitToHost(FLairCommand::MakeSimple(ELairCommandType::EndTurn, GetLocalPlayerIndex())))
+	{
+		ClearSelection();
+		return;
+	}
+
 	if (!GameModeRef)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ALairPlayerController::OnEndTurnClicked - GameMode is null"));
+		UE_LOG(LogLairInput, Warning, TEXT("ALairPlayerController::OnEndTurnClicked - GameMode is null"));
 		return;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("ALairPlayerController::OnEndTurnClicked - Ending turn"));
+	UE_LOG(LogLairInput, Log, TEXT("ALairPlayerController::OnEndTurnClicked - Ending turn"));
 
 	GameModeRef->EndCurrentTurn();
 	ClearSelection();
@@ -119,16 +152,50 @@ void ALairPlayerController::OnEndTurnClicked()
 
 void ALairPlayerController::OnAdvancePhaseClicked()
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(ALairPlayerController::OnAdvancePhaseClicked);
+
+	if (SubmitToHost(FLairCommand::MakeSimple(ELairCommandType::AdvancePhase, GetLocalPlayerIndex())))
+	{
+		return;
+	}
+
+	if (!GameModeRef)
+	{
+		return;
+	}
+
+	GameModeRef->AdvanceCurrentPhase();
+	UE_LOG(LogLairInput, Log, TEXT("ALairPlayerController::OnAdvancePhaseClicked - Phase advanced"));
+}
+
+void ALairPlayerController::OnUndoClicked()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(ALairPlayerController::OnUndoClicked);
+
 	if (!GameModeRef)
 	{
 		return;
 	}
 
-	UTurnManagerComponent* TurnManager = GameModeRef->GetTurnManager();
-	if (TurnManager)
+	// The selected unit may have moved or been removed
+	if (GameModeRef->Undo())
 	{
-		TurnManager->AdvancePhase();
-		UE_LOG(LogTemp, Log, TEXT("ALairPlayerController::OnAdvancePhaseClicked - Phase advanced"));
+		ClearSelection();
+	}
+}
+
+void ALairPlayerController::OnRedoClicked()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(ALairPlayerController::OnRedoClicked);
+
+	if (!GameModeRef)
+	{
+		return;
+	}
+
+	if (GameModeRef->Redo())
+	{
+		ClearSelection();
 	}
 }
 
@@ -160,8 +227,25 @@ AUnit* ALairPlayerController::GetUnitUnderCursor() const
 	return nullptr;
 }
 
+bool ALairPlayerController::SubmitToHost(const FLairCommand& Command)
+{
+	// The host (and hotseat) run commands through the game mode instead
+	if (GameModeRef || !Lockstep || !Lockstep->IsMatchStarted())
+	{
+		return false;
+	}
+
+	return Lockstep->SubmitCommand(Command);
+}
+
 int32 ALairPlayerController::GetLocalPlayerIndex() const
 {
+	// Lockstep peers always play their own seat
+	if (!GameModeRef && Lockstep && Lockstep->IsMatchStarted())
+	{
+		return Lockstep->GetPlayerIndex();
+	}
+
 	// In hotseat mode, return the current player from TurnManager
 	if (GameModeRef)
 	{
@@ -193,7 +277,7 @@ void ALairPlayerController::SelectTile(ATile* Tile)
 	if (SelectedTile)
 	{
 		SelectedTile->SetHighlight(true, FLinearColor::Green);
-		UE_LOG(LogTemp, Verbose, TEXT("ALairPlayerController::SelectTile - Selected tile at (%d, %d)"),
+		UE_LOG(LogLairInput, Verbose, TEXT("ALairPlayerController::SelectTile - Selected tile at (%d, %d)"),
 			SelectedTile->GridCoord.X, SelectedTile->GridCoord.Y);
 	}
 
@@ -218,7 +302,7 @@ void ALairPlayerController::SelectUnit(AUnit* Unit)
 	if (SelectedUnit)
 	{
 		SelectedUnit->SetSelected(true);
-		UE_LOG(LogTemp, Verbose, TEXT("ALairPlayerController::SelectUnit - Selected unit %s"),
+		UE_LOG(LogLairInput, Verbose, TEXT("ALairPlayerController::SelectUnit - Selected unit %s"),
 			*SelectedUnit->UnitTypeID.ToString());
 
 		// Also select the tile the unit is on
@@ -248,5 +332,5 @@ void ALairPlayerController::ClearSelection()
 	OnTileSelected.Broadcast(nullptr);
 	OnUnitSelected.Broadcast(nullptr);
 
-	UE_LOG(LogTemp, Verbose, TEXT("ALairPlayerController::ClearSelection - Selection cleared"));
+	UE_LOG(LogLairInput, Verbose, TEXT("ALairPlayerController::ClearSelection - Selection cleared"));
 }
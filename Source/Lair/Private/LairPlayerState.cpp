@@ -2,6 +2,7 @@
 // Step 5: Player State (Per-Player Data)
 
 #include "LairPlayerState.h"
+#include "LairLog.h"
 #include "Unit.h"
 
 ALairPlayerState::ALairPlayerState()
@@ -19,7 +20,7 @@ void ALairPlayerState::InitializePlayer(int32 InPlayerIndex, int32 StartingGold)
 	// Set default faction based on player index (Phase 1: generic colors)
 	Faction = EArmyFaction::Neutral;
 
-	UE_LOG(LogTemp, Log, TEXT("ALairPlayerState::InitializePlayer - Player %d initialized with %d gold"),
+	UE_LOG(LogLairEconomy, Log, TEXT("ALairPlayerState::InitializePlayer - Player %d initialized with %d gold"),
 		PlayerIndex, Gold);
 }
 
@@ -27,30 +28,30 @@ void ALairPlayerState::AddGold(int32 Amount)
 {
 	if (Amount <= 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ALairPlayerState::AddGold - Invalid amount %d"), Amount);
+		UE_LOG(LogLairEconomy, Warning, TEXT("ALairPlayerState::AddGold - Invalid amount %d"), Amount);
 		return;
 	}
 
 	int32 OldGold = Gold;
 	Gold += Amount;
 
-	UE_LOG(LogTemp, Log, TEXT("ALairPlayerState::AddGold - Player %d: %d + %d = %d gold"),
+	UE_LOG(LogLairEconomy, Verbose, TEXT("ALairPlayerState::AddGold - Player %d: %d + %d = %d gold"),
 		PlayerIndex, OldGold, Amount, Gold);
 
-	OnGoldChanged.Broadcast(OldGold, Gold);
+	NotifyGoldChanged(OldGold);
 }
 
 void ALairPlayerState::DeductGold(int32 Amount)
 {
 	if (Amount <= 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ALairPlayerState::DeductGold - Invalid amount %d"), Amount);
+		UE_LOG(LogLairEconomy, Warning, TEXT("ALairPlayerState::DeductGold - Invalid amount %d"), Amount);
 		return;
 	}
 
 	if (Amount > Gold)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ALairPlayerState::DeductGold - Cannot deduct %d from %d gold"),
+		UE_LOG(LogLairEconomy, Warning, TEXT("ALairPlayerState::DeductGold - Cannot deduct %d from %d gold"),
 			Amount, Gold);
 		return;
 	}
@@ -58,10 +59,10 @@ void ALairPlayerState::DeductGold(int32 Amount)
 	int32 OldGold = Gold;
 	Gold -= Amount;
 
-	UE_LOG(LogTemp, Log, TEXT("ALairPlayerState::DeductGold - Player %d: %d - %d = %d gold"),
+	UE_LOG(LogLairEconomy, Verbose, TEXT("ALairPlayerState::DeductGold - Player %d: %d - %d = %d gold"),
 		PlayerIndex, OldGold, Amount, Gold);
 
-	OnGoldChanged.Broadcast(OldGold, Gold);
+	NotifyGoldChanged(OldGold);
 }
 
 bool ALairPlayerState::CanAfford(int32 Cost) const
@@ -76,17 +77,17 @@ void ALairPlayerState::SetGold(int32 Amount)
 
 	if (OldGold != Gold)
 	{
-		UE_LOG(LogTemp, Log, TEXT("ALairPlayerState::SetGold - Player %d: gold set to %d"),
+		UE_LOG(LogLairEconomy, Verbose, TEXT("ALairPlayerState::SetGold - Player %d: gold set to %d"),
 			PlayerIndex, Gold);
 
-		OnGoldChanged.Broadcast(OldGold, Gold);
+		NotifyGoldChanged(OldGold);
 	}
 }
 
 void ALairPlayerState::SetFaction(EArmyFaction NewFaction)
 {
 	Faction = NewFaction;
-	UE_LOG(LogTemp, Log, TEXT("ALairPlayerState::SetFaction - Player %d: faction set to %d"),
+	UE_LOG(LogLairEconomy, Log, TEXT("ALairPlayerState::SetFaction - Player %d: faction set to %d"),
 		PlayerIndex, static_cast<int32>(Faction));
 }
 
@@ -95,17 +96,87 @@ void ALairPlayerState::AddOwnedUnit(AUnit* Unit)
 	if (Unit && !OwnedUnits.Contains(Unit))
 	{
 		OwnedUnits.Add(Unit);
-		UE_LOG(LogTemp, Verbose, TEXT("ALairPlayerState::AddOwnedUnit - Player %d now owns %d units"),
+		UE_LOG(LogLairEconomy, Verbose, TEXT("ALairPlayerState::AddOwnedUnit - Player %d now owns %d units"),
 			PlayerIndex, OwnedUnits.Num());
+
+		NotifyOwnedUnitsChanged(OwnedUnits.Num() - 1);
 	}
 }
 
 void ALairPlayerState::RemoveOwnedUnit(AUnit* Unit)
 {
-	if (Unit)
+	if (Unit && OwnedUnits.Remove(Unit) > 0)
 	{
-		OwnedUnits.Remove(Unit);
-		UE_LOG(LogTemp, Verbose, TEXT("ALairPlayerState::RemoveOwnedUnit - Player %d now owns %d units"),
+		UE_LOG(LogLairEconomy, Verbose, TEXT("ALairPlayerState::RemoveOwnedUnit - Player %d now owns %d units"),
 			PlayerIndex, OwnedUnits.Num());
+
+		NotifyOwnedUnitsChanged(OwnedUnits.Num() + 1);
+	}
+}
+
+void ALairPlayerState::SetEventBus(FLairEventBus* InEventBus)
+{
+	if (EventBus)
+	{
+		EventBus->On(ELairEventType::GoldChanged).RemoveAll(this);
+		EventBus->On(ELairEventType::OwnedUnitsChanged).RemoveAll(this);
+		EventBus->On(ELairEventType::GoldChanged, ELairEventListener::Presentation).RemoveAll(this);
+	}
+
+	EventBus = InEventBus;
+
+	if (EventBus)
+	{
+		EventBus->On(ELairEventType::GoldChanged).AddUObject(this, &ALairPlayerState::ForwardGameplayEvent);
+		EventBus->On(ELairEventType::OwnedUnitsChanged).AddUObject(this, &ALairPlayerState::ForwardGameplayEvent);
+		EventBus->On(ELairEventType::GoldChanged, ELairEventListener::Presentation).AddUObject(this, &ALairPlayerState::ForwardPresentationEvent);
+	}
+}
+
+void ALairPlayerState::NotifyGoldChanged(int32 OldGold)
+{
+	if (EventBus)
+	{
+		EventBus->Post(ELairEventType::GoldChanged, PlayerIndex, OldGold, Gold);
+		return;
+	}
+
+	OnGoldChanged.Broadcast(OldGold, Gold);
+	OnGoldChangedNative.Broadcast(this, OldGold, Gold);
+}
+
+void ALairPlayerState::NotifyOwnedUnitsChanged(int32 OldNumOwnedUnits)
+{
+	if (EventBus)
+	{
+		EventBus->Post(ELairEventType::OwnedUnitsChanged, PlayerIndex, OldNumOwnedUnits, OwnedUnits.Num());
+		return;
+	}
+
+	OnOwnedUnitsChangedNative.Broadcast(this, OwnedUnits.Num());
+}
+
+void ALairPlayerState::ForwardGameplayEvent(const FLairEvent& Event)
+{
+	if (Event.PlayerIndex != PlayerIndex)
+	{
+		return;
+	}
+
+	if (Event.Type == ELairEventType::GoldChanged)
+	{
+		OnGoldChangedNative.Broadcast(this, Event.OldValue, Event.NewValue);
+	}
+	else if (Event.Type == ELairEventType::OwnedUnitsChanged)
+	{
+		OnOwnedUnitsChangedNative.Broadcast(this, Event.NewValue);
+	}
+}
+
+void ALairPlayerState::ForwardPresentationEvent(const FLairEvent& Event)
+{
+	if (Event.PlayerIndex == PlayerIndex && OnGoldChanged.IsBound())
+	{
+		OnGoldChanged.Broadcast(Event.OldValue, Event.NewValue);
 	}
 }
@@ -0,0 +1,149 @@
+// LairRandom.cpp
+// Match RNG Service (Deterministic Random Streams)
+
+#include "LairRandom.h"
+#include "HAL/PlatformTime.h"
+
+namespace
+{
+	/** SplitMix64 step, used only to expand seeds */
+	uint64 SplitMix64(uint64& X)
+	{
+		uint64 Z = (X += 0x9E3779B97F4A7C15ull);
+		Z = (Z ^ (Z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		Z = (Z ^ (Z >> 27)) * 0x94D049BB133111EBull;
+		return Z ^ (Z >> 31);
+	}
+
+	/** Largest multiple of 6 that fits in a byte; bytes at or above are rejected */
+	constexpr uint32 DIE_BYTE_LIMIT = 252;
+}
+
+// ============================================================================
+// FLairRandomStream
+// ============================================================================
+
+void FLairRandomStream::Seed(uint64 Seed)
+{
+	uint64 X = Seed;
+	for (uint64& Word : State)
+	{
+		Word = SplitMix64(X);
+	}
+}
+
+void FLairRandomStream::Jump()
+{
+	static constexpr uint64 JumpTable[] = {
+		0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull, 0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull
+	};
+
+	uint64 S0 = 0, S1 = 0, S2 = 0, S3 = 0;
+	for (uint64 JumpWord : JumpTable)
+	{
+		for (int32 Bit = 0; Bit < 64; ++Bit)
+		{
+			if (JumpWord & (1ull << Bit))
+			{
+				S0 ^= State[0];
+				S1 ^= State[1];
+				S2 ^= State[2];
+				S3 ^= State[3];
+			}
+			Next();
+		}
+	}
+
+	State[0] = S0;
+	State[1] = S1;
+	State[2] = S2;
+	State[3] = S3;
+}
+
+uint32 FLairRandomStream::NextBounded(uint32 Bound)
+{
+	check(Bound > 0);
+	checkf(IsSeeded(), TEXT("FLairRandomStream::NextBounded - Stream was never seeded"));
+
+	// Lemire's multiply-shift with rejection of the biased low range
+	uint64 Product = static_cast<uint64>(NextUInt32()) * Bound;
+	uint32 Low = static_cast<uint32>(Product);
+	if (Low < Bound)
+	{
+		const uint32 Threshold = (0u - Bound) % Bound;
+		while (Low < Threshold)
+		{
+			Product = static_cast<uint64>(NextUInt32()) * Bound;
+			Low = static_cast<uint32>(Product);
+		}
+	}
+	return static_cast<uint32>(Product >> 32);
+}
+
+int32 FLairRandomStream::RandRange(int32 Min, int32 Max)
+{
+	if (Max <= Min)
+	{
+		return Min;
+	}
+
+	const uint32 Range = static_cast<uint32>(static_cast<int64>(Max) - Min + 1);
+	return Min + static_cast<int32>(NextBounded(Range));
+}
+
+uint8 FLairRandomStream::RollDie()
+{
+	uint8 Die = 0;
+	FillDice(TArrayView<uint8>(&Die, 1));
+	return Die;
+}
+
+void FLairRandomStream::FillDice(TArrayView<uint8> OutDice)
+{
+	int32 Filled = 0;
+	const int32 Count = OutDice.Num();
+
+	while (Filled < Count)
+	{
+		uint64 Bits = Next();
+
+		// Eight candidate bytes per draw; rejection keeps faces exactly uniform
+		for (int32 Byte = 0; Byte < 8 && Filled < Count; ++Byte, Bits >>= 8)
+		{
+			const uint32 Value = static_cast<uint32>(Bits & 0xFF);
+			if (Value < DIE_BYTE_LIMIT)
+			{
+				OutDice[Filled++] = static_cast<uint8>(Value % 6 + 1);
+			}
+		}
+	}
+}
+
+// ============================================================================
+// FLairRandomService
+// ============================================================================
+
+FLairRandomService::FLairRandomService()
+{
+	Initialize(0);
+}
+
+void FLairRandomService::Initialize(uint64 InMatchSeed)
+{
+	MatchSeed = InMatchSeed;
+
+	// Sibling streams are 2^128 draws apart, so they can never overlap
+	FLairRandomStream Base;
+	Base.Seed(MatchSeed);
+	for (FLairRandomStream& Stream : Streams)
+	{
+		Stream = Base;
+		Base.Jump();
+	}
+}
+
+uint64 FLairRandomService::MakeRandomSeed()
+{
+	uint64 X = FPlatformTime::Cycles64() ^ (static_cast<uint64>(FPlatformTLS::GetCurrentThreadId()) << 32);
+	return SplitMix64(X);
+}
@@ -0,0 +1,183 @@
+// LairReplay.cpp
+// Replay (Headless Playback and Seeking)
+
+#include "LairReplay.h"
+#include "LairLog.h"
+#include "LairMemory.h"
+#include "Algo/BinarySearch.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+	/** "LRPL" */
+	constexpr uint32 REPLAY_MAGIC = 0x4C52504C;
+
+	/** Bump when the file layout changes */
+	constexpr uint16 REPLAY_VERSION = 1;
+}
+
+bool FLairReplay::Build(TSharedPtr<const FLairMatchRules> InRules, const FLairCommandLog& InLog, int32 KeyframeInterval)
+{
+	LLM_SCOPE_BYTAG(Lair_Replay);
+
+	Rules = MoveTemp(InRules);
+	Log = InLog;
+	Commands.Reset(Log.Num());
+	TurnStarts.Reset();
+	Keyframes.Reset();
+
+	if (!Rules.IsValid())
+	{
+		return false;
+	}
+
+	KeyframeInterval = FMath::Max(KeyframeInterval, 1);
+
+	FLairMatchState State;
+	State.Initialize(Rules, Log.GetMatchSeed());
+	Keyframes.Add({ 0, State });
+	TurnStarts.Add(0);
+
+	bool bValid = true;
+	int32 Offset = 0;
+	FLairCommand Command;
+	while (Offset < Log.GetNumBytes())
+	{
+		if (!Log.Read(Offset, Command) || !State.ApplyCommand(Command))
+		{
+			UE_LOG(LogLair, Warning, TEXT("FLairReplay::Build - Command %d does not apply, replay cut at turn %d"),
+				Commands.Num(), State.TurnNumber);
+			bValid = false;
+			break;
+		}
+
+		Commands.Add(Command);
+
+		if (State.TurnNumber > TurnStarts.Num())
+		{
+			TurnStarts.Add(Commands.Num());
+			if ((State.TurnNumber - 1) % KeyframeInterval == 0)
+			{
+				Keyframes.Add({ Commands.Num(), State });
+			}
+		}
+	}
+
+	if (!bValid)
+	{
+		// Keep the log consistent with what can actually be replayed
+		Log.Reset(InLog.GetMatchSeed());
+		for (const FLairCommand& Valid : Commands)
+		{
+			Log.Append(Valid);
+		}
+	}
+
+	UE_LOG(LogLair, Log, TEXT("FLairReplay::Build - %d commands, %d turns, %d keyframes"),
+		Commands.Num(), TurnStarts.Num(), Keyframes.Num());
+
+	return bValid;
+}
+
+bool FLairReplay::SeekToTurn(int32 TurnNumber, FLairMatchState& OutState, int32* OutCommandIndex) const
+{
+	if (!IsValid())
+	{
+		return false;
+	}
+
+	const int32 CommandIndex = GetTurnStartCommand(TurnNumber);
+	if (OutCommandIndex)
+	{
+		*OutCommandIndex = CommandIndex;
+	}
+	return SeekToCommand(CommandIndex, OutState);
+}
+
+bool FLairReplay::SeekToCommand(int32 CommandIndex, FLairMatchState& OutState) const
+{
+	if (!IsValid())
+	{
+		return false;
+	}
+
+	CommandIndex = FMath::Clamp(CommandIndex, 0, Commands.Num());
+
+	// Last keyframe at or before the target
+	const int32 KeyframeIndex = Algo::UpperBoundBy(Keyframes, CommandIndex, &FKeyframe::CommandIndex) - 1;
+	const FKeyframe& Keyframe = Keyframes[KeyframeIndex];
+
+	OutState = Keyframe.State;
+	for (int32 Index = Keyframe.CommandIndex; Index < CommandIndex; ++Index)
+	{
+		// Every command was validated in Build
+		OutState.ApplyCommand(Commands[Index]);
+	}
+
+	return true;
+}
+
+bool FLairReplay::SaveToFile(const FString& FilePath, const FLairMatchRules& Rules, const FLairCommandLog& Log)
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+
+	uint32 Magic = REPLAY_MAGIC;
+	uint16 Version = REPLAY_VERSION;
+	uint64 Seed = Log.GetMatchSeed();
+	TArray<uint8> Data = Log.GetData();
+
+	FLairMatchRules RulesCopy = Rules;
+	Writer << Magic << Version << Seed;
+	RulesCopy.Serialize(Writer);
+	Writer << Data;
+
+	if (!FFileHelper::SaveArrayToFile(Bytes, *FilePath))
+	{
+		UE_LOG(LogLair, Warning, TEXT("FLairReplay::SaveToFile - Failed to write %s"), *FilePath);
+		return false;
+	}
+
+	return true;
+}
+
+bool FLairReplay::LoadFromFile(const FString& FilePath)
+{
+	LLM_SCOPE_BYTAG(Lair_Replay);
+
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *FilePath))
+	{
+		UE_LOG(LogLair, Warning, TEXT("FLairReplay::LoadFromFile - Failed to read %s"), *FilePath);
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+
+	uint32 Magic = 0;
+	uint16 Version = 0;
+	uint64 Seed = 0;
+	Reader << Magic << Version << Seed;
+	if (Magic != REPLAY_MAGIC || Version != REPLAY_VERSION)
+	{
+		UE_LOG(LogLair, Warning, TEXT("FLairReplay::LoadFromFile - %s is not a version %d replay"), *FilePath, REPLAY_VERSION);
+		return false;
+	}
+
+	TSharedRef<FLairMatchRules> LoadedRules = MakeShared<FLairMatchRules>();
+	LoadedRules->Serialize(Reader);
+
+	TArray<uint8> Data;
+	Reader << Data;
+
+	FLairCommandLog LoadedLog;
+	if (Reader.IsError() || !LoadedLog.SetData(Seed, MoveTemp(Data)))
+	{
+		UE_LOG(LogLair, Warning, TEXT("FLairReplay::LoadFromFile - %s is corrupt"), *FilePath);
+		return false;
+	}
+
+	return Build(LoadedRules, LoadedLog);
+}
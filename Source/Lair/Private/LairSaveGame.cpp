@@ -0,0 +1,267 @@
+// LairSaveGame.cpp
+// Save Game (Compact Binary Match Saves)
+
+#include "LairSaveGame.h"
+#include "LairLog.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+void FLairSaveGame::Save(const FLairMatchState& State, const TArray<FName>& TileTypes, const FLairCommandLog& Log, TArray<uint8>& OutBytes)
+{
+	check(State.Rules.IsValid());
+	const FLairMatchRules& Rules = *State.Rules;
+
+	OutBytes.Reset();
+	FMemoryWriter Writer(OutBytes);
+
+	uint32 Magic = MAGIC;
+	uint16 Version = VERSION;
+	Writer << Magic << Version;
+
+	// Board: tile type palette, one palette index and one occupancy mask per tile
+	int16 SizeX = static_cast<int16>(Rules.BoardSize.X);
+	int16 SizeY = static_cast<int16>(Rules.BoardSize.Y);
+	Writer << SizeX << SizeY;
+
+	TArray<FName> Palette;
+	TArray<uint8> TilePaletteIndices;
+	TArray<uint8> TileOccupancy;
+	TilePaletteIndices.SetNumUninitialized(Rules.GetNumTiles());
+	TileOccupancy.SetNumUninitialized(Rules.GetNumTiles());
+	for (int32 TileIndex = 0; TileIndex < Rules.GetNumTiles(); ++TileIndex)
+	{
+		const FName TileType = TileTypes.IsValidIndex(TileIndex) ? TileTypes[TileIndex] : NAME_None;
+		const int32 PaletteIndex = Palette.AddUnique(TileType);
+		check(PaletteIndex < MAX_uint8);
+		TilePaletteIndices[TileIndex] = static_cast<uint8>(PaletteIndex);
+		TileOccupancy[TileIndex] = State.Tiles[TileIndex].OccupiedMask;
+	}
+	Writer << Palette;
+	Writer.Serialize(TilePaletteIndices.GetData(), TilePaletteIndices.Num());
+	Writer.Serialize(TileOccupancy.GetData(), TileOccupancy.Num());
+
+	// Units: type names once, then packed per-unit fields
+	TArray<FName> UnitTypeNames = Rules.UnitTypeNames;
+	Writer << UnitTypeNames;
+
+	int32 NumUnits = State.Units.Num();
+	Writer << NumUnits;
+	for (const FLairSimUnit& ConstUnit : State.Units)
+	{
+		FLairSimUnit Unit = ConstUnit;
+		Writer << Unit.TypeIndex << Unit.OwnerIndex << Unit.CurrentHP << Unit.RemainingMovement
+			<< Unit.TileIndex << Unit.SubSlotIndex << Unit.bHasMined;
+	}
+
+	// Players and turn
+	uint8 NumPlayers = static_cast<uint8>(State.Gold.Num());
+	Writer << NumPlayers;
+	for (int32 Gold : State.Gold)
+	{
+		Writer << Gold;
+	}
+
+	uint8 Phase = static_cast<uint8>(State.Phase);
+	uint8 CurrentPlayer = static_cast<uint8>(State.CurrentPlayerIndex);
+	int32 TurnNumber = State.TurnNumber;
+	int8 WinnerIndex = static_cast<int8>(State.WinnerIndex);
+	Writer << Phase << CurrentPlayer << TurnNumber << WinnerIndex;
+
+	// RNG and deck order, so the game continues exactly as it would have
+	FLairRandomService Random = State.Random;
+	Writer << Random;
+
+	TArray<uint16> DeckOrder(State.MiningDeck.Order);
+	int32 CurrentCardIndex = State.MiningDeck.CurrentCardIndex;
+	Writer << DeckOrder << CurrentCardIndex;
+
+	// History
+	uint64 LogSeed = Log.GetMatchSeed();
+	TArray<uint8> LogData = Log.GetData();
+	Writer << LogSeed << LogData;
+}
+
+bool FLairSaveGame::Load(const TArray<uint8>& Bytes, const TSharedPtr<const FLairMatchRules>& Rules,
+	FLairMatchState& OutState, TArray<FName>& OutTileTypes, FLairCommandLog& OutLog)
+{
+	if (!Rules.IsValid())
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+
+	uint32 Magic = 0;
+	uint16 Version = 0;
+	Reader << Magic << Version;
+	if (Magic != MAGIC || Version != VERSION)
+	{
+		UE_LOG(LogLair, Warning, TEXT("FLairSaveGame::Load - Not a version %d save"), VERSION);
+		return false;
+	}
+
+	int16 SizeX = 0;
+	int16 SizeY = 0;
+	Reader << SizeX << SizeY;
+	if (FIntPoint(SizeX, SizeY) != Rules->BoardSize)
+	{
+		UE_LOG(LogLair, Warning, TEXT("FLairSaveGame::Load - Saved board is %dx%d, current board is %dx%d"),
+			SizeX, SizeY, Rules->BoardSize.X, Rules->BoardSize.Y);
+		return false;
+	}
+
+	const int32 NumTiles = Rules->GetNumTiles();
+
+	TArray<FName> Palette;
+	Reader << Palette;
+
+	TArray<uint8> TilePaletteIndices;
+	TArray<uint8> TileOccupancy;
+	TilePaletteIndices.SetNumUninitialized(NumTiles);
+	TileOccupancy.SetNumUninitialized(NumTiles);
+	Reader.Serialize(TilePaletteIndices.GetData(), NumTiles);
+	Reader.Serialize(TileOccupancy.GetData(), NumTiles);
+
+	TArray<FName> UnitTypeNames;
+	Reader << UnitTypeNames;
+
+	int32 NumUnits = 0;
+	Reader << NumUnits;
+	if (Reader.IsError() || NumUnits < 0 || NumUnits > MAX_uint16)
+	{
+		UE_LOG(LogLair, Warning, TEXT("FLairSaveGame::Load - Corrupt header"));
+		return false;
+	}
+
+	// Saved type indices map to the running rules by name
+	TArray<int32> TypeRemap;
+	for (const FName& UnitTypeName : UnitTypeNames)
+	{
+		TypeRemap.Add(Rules->FindUnitType(UnitTypeName));
+	}
+
+	OutState.Rules = Rules;
+	OutState.Tiles.Reset();
+	OutState.Tiles.SetNum(NumTiles);
+	OutState.Units.Reset();
+	OutState.Units.SetNum(NumUnits);
+
+	for (FLairSimUnit& Unit : OutState.Units)
+	{
+		Reader << Unit.TypeIndex << Unit.OwnerIndex << Unit.CurrentHP << Unit.RemainingMovement
+			<< Unit.TileIndex << Unit.SubSlotIndex << Unit.bHasMined;
+
+		if (Unit.OwnerIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
+		const int32 TypeIndex = TypeRemap.IsValidIndex(Unit.TypeIndex) ? TypeRemap[Unit.TypeIndex] : INDEX_NONE;
+		if (TypeIndex == INDEX_NONE || Unit.OwnerIndex < 0 || Unit.OwnerIndex >= Rules->NumPlayers
+			|| Unit.TileIndex >= static_cast<uint32>(NumTiles) || Unit.SubSlotIndex >= LairConstants::TILE_SUB_SLOTS)
+		{
+			UE_LOG(LogLair, Warning, TEXT("FLairSaveGame::Load - Unit of unknown type or out of range"));
+			return false;
+		}
+		Unit.TypeIndex = static_cast<uint8>(TypeIndex);
+
+		FLairSimTile& Tile = OutState.Tiles[Unit.TileIndex];
+		Tile.OccupiedMask |= FLairMatchState::GetSubSlotBits(Unit.SubSlotIndex, Rules->UnitTypes[TypeIndex].SubSlotSize);
+		Tile.OccupantOwner = Unit.OwnerIndex;
+	}
+
+	// Occupancy is derivable from the units; a mismatch means the file is damaged
+	for (int32 TileIndex = 0; TileIndex < NumTiles; ++TileIndex)
+	{
+		if (OutState.Tiles[TileIndex].OccupiedMask != TileOccupancy[TileIndex])
+		{
+			UE_LOG(LogLair, Warning, TEXT("FLairSaveGame::Load - Sub-slot occupancy of tile %d does not match its units"), TileIndex);
+			return false;
+		}
+	}
+
+	uint8 NumPlayers = 0;
+	Reader << NumPlayers;
+	if (NumPlayers != Rules->NumPlayers)
+	{
+		UE_LOG(LogLair, Warning, TEXT("FLairSaveGame::Load - Saved for %d players, match has %d"), NumPlayers, Rules->NumPlayers);
+		return false;
+	}
+
+	OutState.Gold.Reset();
+	for (int32 PlayerIndex = 0; PlayerIndex < NumPlayers; ++PlayerIndex)
+	{
+		int32 Gold = 0;
+		Reader << Gold;
+		OutState.Gold.Add(Gold);
+	}
+
+	uint8 Phase = 0;
+	uint8 CurrentPlayer = 0;
+	int8 WinnerIndex = INDEX_NONE;
+	Reader << Phase << CurrentPlayer << OutState.TurnNumber << WinnerIndex;
+	OutState.Phase = static_cast<ETurnPhase>(Phase);
+	OutState.CurrentPlayerIndex = CurrentPlayer;
+	OutState.WinnerIndex = WinnerIndex;
+	OutState.bGameOver = WinnerIndex != INDEX_NONE;
+
+	Reader << OutState.Random;
+
+	TArray<uint16> DeckOrder;
+	int32 CurrentCardIndex = 0;
+	Reader << DeckOrder << CurrentCardIndex;
+
+	const int32 NumCards = Rules->CardTable.IsValid() ? Rules->CardTable->Num() : 0;
+	for (uint16 CardIndex : DeckOrder)
+	{
+		if (CardIndex >= NumCards)
+		{
+			UE_LOG(LogLair, Warning, TEXT("FLairSaveGame::Load - Deck refers to card %d of %d"), CardIndex, NumCards);
+			return false;
+		}
+	}
+	OutState.MiningDeck.CardTable = Rules->CardTable;
+	OutState.MiningDeck.Order = DeckOrder;
+	OutState.MiningDeck.CurrentCardIndex = FMath::Clamp(CurrentCardIndex, 0, DeckOrder.Num());
+
+	uint64 LogSeed = 0;
+	TArray<uint8> LogData;
+	Reader << LogSeed << LogData;
+
+	// The turn state is used as is (phase switches, player and winner indices), so out-of-range values are corruption
+	const bool bValidTurn = CurrentPlayer < NumPlayers && Phase <= static_cast<uint8>(ETurnPhase::EndTurn)
+		&& OutState.TurnNumber >= 1 && WinnerIndex >= INDEX_NONE && WinnerIndex < NumPlayers;
+	if (Reader.IsError() || !bValidTurn || !OutLog.SetData(LogSeed, MoveTemp(LogData)))
+	{
+		UE_LOG(LogLair, Warning, TEXT("FLairSaveGame::Load - Corrupt turn, deck or command log"));
+		return false;
+	}
+
+	OutTileTypes.Reset(NumTiles);
+	for (uint8 PaletteIndex : TilePaletteIndices)
+	{
+		OutTileTypes.Add(Palette.IsValidIndex(PaletteIndex) ? Palette[PaletteIndex] : NAME_None);
+	}
+
+	return true;
+}
+
+bool FLairSaveGame::WriteFile(const FString& FilePath, const TArray<uint8>& Bytes)
+{
+	const FString TempPath = FilePath + TEXT(".tmp");
+	if (!FFileHelper::SaveArrayToFile(Bytes, *TempPath) || !IFileManager::Get().Move(*FilePath, *TempPath, true, true))
+	{
+		UE_LOG(LogLair, Warning, TEXT("FLairSaveGame::WriteFile - Failed to write %s"), *FilePath);
+		return false;
+	}
+
+	return true;
+}
+
+FString FLairSaveGame::GetSlotPath(const FString& SlotName)
+{
+	return FPaths::ProjectSavedDir() / TEXT("SaveGames") / (SlotName + TEXT(".lairsave"));
+}
@@ -0,0 +1,360 @@
+// LairTournamentCommandlet.cpp
+// Tournament Commandlet (AI Self-Play)
+
+#include "LairTournamentCommandlet.h"
+#include "LairLog.h"
+#include "LairAIPolicy.h"
+#include "LairMatchState.h"
+#include "LairReplay.h"
+#include "Async/ParallelFor.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+	/** Scale from natural-log strength to Elo points */
+	const double ELO_PER_NEPER = 400.0 / FMath::Loge(10.0);
+
+	/** Derive an independent seed for a match (SplitMix64 finalizer) */
+	uint64 MixSeed(uint64 Seed, uint64 Salt)
+	{
+		uint64 Z = Seed + (Salt + 1) * 0x9E3779B97F4A7C15ull;
+		Z = (Z ^ (Z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		Z = (Z ^ (Z >> 27)) * 0x94D049BB133111EBull;
+		return Z ^ (Z >> 31);
+	}
+}
+
+ULairTournamentCommandlet::ULairTournamentCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+	ShowErrorCount = true;
+}
+
+int32 ULairTournamentCommandlet::Main(const FString& Params)
+{
+	// Parse arguments
+	FString PoliciesArg;
+	if (!FParse::Value(*Params, TEXT("Policies="), PoliciesArg, false))
+	{
+		PoliciesArg = TEXT("Greedy,Random");
+	}
+
+	int32 Rounds = 100;
+	int32 BoardSize = LairConstants::DEFAULT_BOARD_SIZE_X;
+	int32 MaxTurns = 200;
+	int32 MaxCommands = 100000;
+	int64 TournamentSeed = 1;
+	FString ReportPath = FPaths::ProjectSavedDir() / TEXT("Tournament.json");
+	FString ReplayDir;
+	FParse::Value(*Params, TEXT("Rounds="), Rounds);
+	FParse::Value(*Params, TEXT("BoardSize="), BoardSize);
+	FParse::Value(*Params, TEXT("MaxTurns="), MaxTurns);
+	FParse::Value(*Params, TEXT("MaxCommands="), MaxCommands);
+	FParse::Value(*Params, TEXT("Seed="), TournamentSeed);
+	FParse::Value(*Params, TEXT("Report="), ReportPath);
+	FParse::Value(*Params, TEXT("ReplayDir="), ReplayDir);
+
+	TArray<FString> PolicyStrings;
+	PoliciesArg.ParseIntoArray(PolicyStrings, TEXT(","));
+
+	TArray<FName> PolicyNames;
+	for (const FString& PolicyString : PolicyStrings)
+	{
+		const FName PolicyName(*PolicyString.TrimStartAndEnd());
+		if (!FLairAIPolicyRegistry::Get().CreatePolicy(PolicyName))
+		{
+			UE_LOG(LogLair, Error, TEXT("ULairTournamentCommandlet::Main - Unknown policy %s"), *PolicyName.ToString());
+			return 1;
+		}
+		PolicyNames.AddUnique(PolicyName);
+	}
+
+	if (PolicyNames.Num() < 2 || Rounds <= 0)
+	{
+		UE_LOG(LogLair, Error, TEXT("ULairTournamentCommandlet::Main - Need at least two policies and one round"));
+		return 1;
+	}
+
+	if (MaxCommands <= 0)
+	{
+		UE_LOG(LogLair, Error, TEXT("ULairTournamentCommandlet::Main - MaxCommands must be positive"));
+		return 1;
+	}
+
+	TSharedRef<FLairMatchRules> MutableRules = FLairMatchRules::MakeDefault(BoardSize);
+	MutableRules->MaxTurns = MaxTurns;
+	const TSharedPtr<const FLairMatchRules> Rules = MutableRules;
+
+	// Schedule: every pair plays each round twice with the same seed, once from each side
+	TArray<FMatchResult> Results;
+	for (int32 Round = 0; Round < Rounds; ++Round)
+	{
+		for (int32 A = 0; A < PolicyNames.Num(); ++A)
+		{
+			for (int32 B = A + 1; B < PolicyNames.Num(); ++B)
+			{
+				FMatchResult& First = Results.AddDefaulted_GetRef();
+				First.PolicyA = A;
+				First.PolicyB = B;
+
+				FMatchResult& Second = Results.AddDefaulted_GetRef();
+				Second.PolicyA = B;
+				Second.PolicyB = A;
+			}
+		}
+	}
+
+	UE_LOG(LogLair, Display, TEXT("ULairTournamentCommandlet::Main - %d policies, %d matches, seed %lld, %d worker threads"),
+		PolicyNames.Num(), Results.Num(), TournamentSeed, FTaskGraphInterface::Get().GetNumWorkerThreads());
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	ParallelFor(Results.Num(), [&Results, &PolicyNames, &Rules, &ReplayDir, TournamentSeed, MaxCommands](int32 MatchIndex)
+	{
+		FMatchResult& Result = Results[MatchIndex];
+
+		// Mirrored pairs share a seed so side assignment is the only difference
+		const uint64 Seed = MixSeed(static_cast<uint64>(TournamentSeed), MatchIndex / 2);
+
+		TUniquePtr<ILairAIPolicy> PolicyA = FLairAIPolicyRegistry::Get().CreatePolicy(PolicyNames[Result.PolicyA]);
+		TUniquePtr<ILairAIPolicy> PolicyB = FLairAIPolicyRegistry::Get().CreatePolicy(PolicyNames[Result.PolicyB]);
+
+		FLairCommandLog Log;
+		const int32 Winner = PlayMatch(Rules, Seed, *PolicyA, *PolicyB, MaxCommands, Result.Turns, Result.Commands,
+			ReplayDir.IsEmpty() ? nullptr : &Log);
+		Result.ScoreA = (Winner == 0) ? 1.0f : (Winner == 1) ? 0.0f : 0.5f;
+
+		if (!ReplayDir.IsEmpty())
+		{
+			const FString ReplayPath = ReplayDir / FString::Printf(TEXT("Match_%05d_%s_vs_%s.lairreplay"), MatchIndex,
+				*PolicyNames[Result.PolicyA].ToString(), *PolicyNames[Result.PolicyB].ToString());
+			FLairReplay::SaveToFile(ReplayPath, *Rules, Log);
+		}
+	}, EParallelForFlags::Unbalanced);
+
+	const double ElapsedSeconds = FMath::Max(FPlatformTime::Seconds() - StartTime, SMALL_NUMBER);
+
+	int64 TotalCommands = 0;
+	for (const FMatchResult& Result : Results)
+	{
+		TotalCommands += Result.Commands;
+	}
+
+	const double MatchesPerSecond = Results.Num() / ElapsedSeconds;
+	const TArray<FPolicyRating> Ratings = ComputeRatings(PolicyNames, Results);
+
+	// Console report
+	UE_LOG(LogLair, Display, TEXT("ULairTournamentCommandlet::Main - %d matches in %.2fs (%.1f matches/sec, %.0f commands/sec)"),
+		Results.Num(), ElapsedSeconds, MatchesPerSecond, TotalCommands / ElapsedSeconds);
+
+	for (const FPolicyRating& Rating : Ratings)
+	{
+		UE_LOG(LogLair, Display, TEXT("  %-16s Elo %7.1f +/- %5.1f  (W %d / L %d / D %d)"),
+			*Rating.PolicyName.ToString(), Rating.Elo, Rating.ConfidenceInterval, Rating.Wins, Rating.Losses, Rating.Draws);
+	}
+
+	// JSON report
+	FString Report;
+	const TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> Writer =
+		TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&Report);
+
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("seed"), TournamentSeed);
+	Writer->WriteValue(TEXT("boardSize"), Rules->BoardSize.X);
+	Writer->WriteValue(TEXT("maxTurns"), MaxTurns);
+	Writer->WriteValue(TEXT("maxCommands"), MaxCommands);
+	Writer->WriteValue(TEXT("rounds"), Rounds);
+	Writer->WriteValue(TEXT("matches"), Results.Num());
+	Writer->WriteValue(TEXT("seconds"), ElapsedSeconds);
+	Writer->WriteValue(TEXT("matchesPerSecond"), MatchesPerSecond);
+	Writer->WriteValue(TEXT("replayDir"), ReplayDir);
+
+	Writer->WriteArrayStart(TEXT("ratings"));
+	for (const FPolicyRating& Rating : Ratings)
+	{
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("policy"), Rating.PolicyName.ToString());
+		Writer->WriteValue(TEXT("elo"), Rating.Elo);
+		Writer->WriteValue(TEXT("ci95"), Rating.ConfidenceInterval);
+		Writer->WriteValue(TEXT("wins"), Rating.Wins);
+		Writer->WriteValue(TEXT("losses"), Rating.Losses);
+		Writer->WriteValue(TEXT("draws"), Rating.Draws);
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+
+	Writer->WriteObjectEnd();
+	Writer->Close();
+
+	if (!FFileHelper::SaveStringToFile(Report, *ReportPath))
+	{
+		UE_LOG(LogLair, Error, TEXT("ULairTournamentCommandlet::Main - Failed to write report to %s"), *ReportPath);
+		return 1;
+	}
+
+	UE_LOG(LogLair, Display, TEXT("ULairTournamentCommandlet::Main - Report written to %s"), *ReportPath);
+	return 0;
+}
+
+int32 ULairTournamentCommandlet::PlayMatch(const TSharedPtr<const FLairMatchRules>& Rules, uint64 Seed,
+	ILairAIPolicy& Player0, ILairAIPolicy& Player1, int32 MaxCommands, int32& OutTurns, int32& OutCommands, FLairCommandLog* OutLog)
+{
+	FLairMatchState State;
+	State.Initialize(Rules, Seed);
+
+	if (OutLog)
+	{
+		OutLog->Reset(Seed);
+	}
+
+	// Policies get their own streams so their choices never consume match randomness
+	FLairRandomStream PolicyStreams[2];
+	PolicyStreams[0].Seed(MixSeed(Seed, 0xA1));
+	PolicyStreams[1].Seed(MixSeed(Seed, 0xB2));
+
+	ILairAIPolicy* Policies[2] = { &Player0, &Player1 };
+
+	OutCommands = 0;
+	// MaxCommands is a hard cap in case a policy never advances the phase (MaxTurns may be 0 = unlimited)
+	while (!State.bGameOver && OutCommands < MaxCommands)
+	{
+		const int32 Player = State.CurrentPlayerIndex;
+
+		FLairAIContext Context;
+		Context.PlayerIndex = Player;
+		Context.Random = &PolicyStreams[Player];
+
+		FLairCommand Command = Policies[Player]->ChooseCommand(State, Context);
+		if (!State.ApplyCommand(Command))
+		{
+			// An illegal choice forfeits the phase rather than stalling the match
+			Command = FLairCommand::MakeSimple(ELairCommandType::AdvancePhase, Player);
+			State.ApplyCommand(Command);
+		}
+
+		if (OutLog)
+		{
+			OutLog->Append(Command);
+		}
+		OutCommands++;
+	}
+
+	OutTurns = State.TurnNumber;
+	return State.WinnerIndex;
+}
+
+TArray<ULairTournamentCommandlet::FPolicyRating> ULairTournamentCommandlet::ComputeRatings(
+	const TArray<FName>& PolicyNames, const TArray<FMatchResult>& Results)
+{
+	const int32 NumPolicies = PolicyNames.Num();
+
+	TArray<FPolicyRating> Ratings;
+	Ratings.SetNum(NumPolicies);
+	for (int32 i = 0; i < NumPolicies; ++i)
+	{
+		Ratings[i].PolicyName = PolicyNames[i];
+	}
+
+	// Pairwise games and scores (draws count half). One virtual draw per pair keeps
+	// strengths finite when a policy wins or loses every game.
+	TArray<double> Games;
+	TArray<double> Score;
+	Games.Init(0.0, NumPolicies * NumPolicies);
+	Score.Init(0.0, NumPolicies);
+
+	for (int32 A = 0; A < NumPolicies; ++A)
+	{
+		for (int32 B = A + 1; B < NumPolicies; ++B)
+		{
+			Games[A * NumPolicies + B] += 1.0;
+			Games[B * NumPolicies + A] += 1.0;
+			Score[A] += 0.5;
+			Score[B] += 0.5;
+		}
+	}
+
+	for (const FMatchResult& Result : Results)
+	{
+		Games[Result.PolicyA * NumPolicies + Result.PolicyB] += 1.0;
+		Games[Result.PolicyB * NumPolicies + Result.PolicyA] += 1.0;
+		Score[Result.PolicyA] += Result.ScoreA;
+		Score[Result.PolicyB] += 1.0 - Result.ScoreA;
+
+		if (Result.ScoreA > 0.75f)
+		{
+			Ratings[Result.PolicyA].Wins++;
+			Ratings[Result.PolicyB].Losses++;
+		}
+		else if (Result.ScoreA < 0.25f)
+		{
+			Ratings[Result.PolicyA].Losses++;
+			Ratings[Result.PolicyB].Wins++;
+		}
+		else
+		{
+			Ratings[Result.PolicyA].Draws++;
+			Ratings[Result.PolicyB].Draws++;
+		}
+	}
+
+	// Bradley-Terry maximum likelihood by minorization-maximization (Hunter 2004)
+	TArray<double> Strength;
+	Strength.Init(1.0, NumPolicies);
+	for (int32 Iteration = 0; Iteration < 1000; ++Iteration)
+	{
+		double MaxChange = 0.0;
+		for (int32 i = 0; i < NumPolicies; ++i)
+		{
+			double Denominator = 0.0;
+			for (int32 j = 0; j < NumPolicies; ++j)
+			{
+				if (j != i)
+				{
+					Denominator += Games[i * NumPolicies + j] / (Strength[i] + Strength[j]);
+				}
+			}
+
+			const double NewStrength = Score[i] / Denominator;
+			MaxChange = FMath::Max(MaxChange, FMath::Abs(FMath::Loge(NewStrength / Strength[i])));
+			Strength[i] = NewStrength;
+		}
+
+		if (MaxChange < 1e-9)
+		{
+			break;
+		}
+	}
+
+	// Convert to Elo centred on 1500. Standard errors come from the diagonal of the
+	// Fisher information in log-strength (treating the other ratings as known).
+	double MeanLogStrength = 0.0;
+	for (int32 i = 0; i < NumPolicies; ++i)
+	{
+		MeanLogStrength += FMath::Loge(Strength[i]) / NumPolicies;
+	}
+
+	for (int32 i = 0; i < NumPolicies; ++i)
+	{
+		double Information = 0.0;
+		for (int32 j = 0; j < NumPolicies; ++j)
+		{
+			if (j != i)
+			{
+				const double Sum = Strength[i] + Strength[j];
+				Information += Games[i * NumPolicies + j] * Strength[i] * Strength[j] / (Sum * Sum);
+			}
+		}
+
+		Ratings[i].Elo = 1500.0 + (FMath::Loge(Strength[i]) - MeanLogStrength) * ELO_PER_NEPER;
+		Ratings[i].ConfidenceInterval = (Information > 0.0) ? 1.96 * ELO_PER_NEPER / FMath::Sqrt(Information) : 0.0;
+	}
+
+	Ratings.Sort([](const FPolicyRating& A, const FPolicyRating& B) { return A.Elo > B.Elo; });
+	return Ratings;
+}
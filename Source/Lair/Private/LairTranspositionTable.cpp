@@ -0,0 +1,183 @@
+// LairTranspositionTable.cpp
+// Transposition Table (Shared AI Search Cache)
+
+#include "LairTranspositionTable.h"
+#include "LairLog.h"
+#include "LairMemory.h"
+
+// Packed layout: [63..56] generation | [55..48] depth | [47..32] best action | [31..16] visits | [15..0] value
+namespace
+{
+	constexpr float VALUE_SCALE = 32767.0f;
+}
+
+FLairTranspositionTable::~FLairTranspositionTable()
+{
+	FMemory::Free(Buckets);
+}
+
+void FLairTranspositionTable::Resize(int32 SizeInMegabytes)
+{
+	LLM_SCOPE_BYTAG(Lair_AI);
+
+	FMemory::Free(Buckets);
+	Buckets = nullptr;
+	NumBuckets = 0;
+
+	const uint64 Bytes = static_cast<uint64>(FMath::Max(SizeInMegabytes, 1)) * 1024 * 1024;
+	const uint64 MaxBuckets = FMath::Min<uint64>(Bytes / sizeof(FBucket), static_cast<uint64>(1) << 30);
+	NumBuckets = static_cast<int32>(1ull << FMath::FloorLog2_64(MaxBuckets));
+
+	Buckets = static_cast<FBucket*>(FMemory::Malloc(static_cast<SIZE_T>(NumBuckets) * sizeof(FBucket), alignof(FBucket)));
+	Clear();
+
+	UE_LOG(LogLair, Log, TEXT("FLairTranspositionTable::Resize - %d entries (%llu KB)"),
+		GetNumEntries(), static_cast<uint64>(NumBuckets) * sizeof(FBucket) / 1024);
+}
+
+void FLairTranspositionTable::Clear()
+{
+	for (int32 BucketIndex = 0; BucketIndex < NumBuckets; ++BucketIndex)
+	{
+		new (&Buckets[BucketIndex]) FBucket();
+	}
+
+	for (FCounterShard& Shard : CounterShards)
+	{
+		Shard.Probes.store(0, std::memory_order_relaxed);
+		Shard.Hits.store(0, std::memory_order_relaxed);
+	}
+
+	Generation.store(0, std::memory_order_relaxed);
+}
+
+uint64 FLairTranspositionTable::Pack(const FLairTTEntry& Entry) const
+{
+	const int32 Value = FMath::RoundToInt(FMath::Clamp(Entry.Value, -1.0f, 1.0f) * VALUE_SCALE);
+
+	return (static_cast<uint64>(Generation.load(std::memory_order_relaxed)) << 56)
+		| (static_cast<uint64>(Entry.Depth) << 48)
+		| (static_cast<uint64>(Entry.BestAction) << 32)
+		| (static_cast<uint64>(Entry.Visits) << 16)
+		| static_cast<uint64>(static_cast<uint16>(static_cast<int16>(Value)));
+}
+
+void FLairTranspositionTable::Unpack(uint64 Data, FLairTTEntry& OutEntry)
+{
+	OutEntry.Value = static_cast<int16>(Data & 0xFFFF) / VALUE_SCALE;
+	OutEntry.Visits = static_cast<uint16>(Data >> 16);
+	OutEntry.BestAction = static_cast<uint16>(Data >> 32);
+	OutEntry.Depth = static_cast<uint8>(Data >> 48);
+}
+
+bool FLairTranspositionTable::Probe(uint64 Key, FLairTTEntry& OutEntry) const
+{
+	if (NumBuckets == 0)
+	{
+		return false;
+	}
+
+	FCounterShard& Shard = GetCounterShard();
+	Shard.Probes.fetch_add(1, std::memory_order_relaxed);
+
+	const FBucket& Bucket = GetBucket(Key);
+	for (const FSlot& Slot : Bucket.Slots)
+	{
+		const uint64 Data = Slot.Data.load(std::memory_order_relaxed);
+		const uint64 KeyXorData = Slot.KeyXorData.load(std::memory_order_relaxed);
+		if (Data != 0 && (KeyXorData ^ Data) == Key)
+		{
+			Unpack(Data, OutEntry);
+			Shard.Hits.fetch_add(1, std::memory_order_relaxed);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void FLairTranspositionTable::Store(uint64 Key, const FLairTTEntry& Entry)
+{
+	if (NumBuckets == 0)
+	{
+		return;
+	}
+
+	FBucket& Bucket = GetBucket(Key);
+	const uint8 CurrentGeneration = Generation.load(std::memory_order_relaxed);
+
+	FSlot* Target = nullptr;
+	int32 TargetScore = MAX_int32;
+
+	for (FSlot& Slot : Bucket.Slots)
+	{
+		const uint64 Data = Slot.Data.load(std::memory_order_relaxed);
+		const uint64 KeyXorData = Slot.KeyXorData.load(std::memory_order_relaxed);
+
+		if (Data == 0 || (KeyXorData ^ Data) == Key)
+		{
+			Target = &Slot;
+			break;
+		}
+
+		// Prefer evicting stale generations, then shallow, rarely visited entries
+		const int32 Age = static_cast<uint8>(CurrentGeneration - GetGeneration(Data));
+		const int32 Score = static_cast<int32>((Data >> 48) & 0xFF) * 256 + static_cast<int32>((Data >> 16) & 0xFFFF) / 256 - Age * 65536;
+		if (Score < TargetScore)
+		{
+			TargetScore = Score;
+			Target = &Slot;
+		}
+	}
+
+	// A packed entry of zero means "empty", so never store it
+	const uint64 Data = Pack(Entry) | ((Entry.Visits == 0 && Entry.Depth == 0) ? (static_cast<uint64>(1) << 16) : 0);
+	Target->KeyXorData.store(Key ^ Data, std::memory_order_relaxed);
+	Target->Data.store(Data, std::memory_order_relaxed);
+}
+
+void FLairTranspositionTable::AddSample(uint64 Key, float Value, uint8 Depth)
+{
+	FLairTTEntry Entry;
+	if (Probe(Key, Entry))
+	{
+		const float Visits = static_cast<float>(Entry.Visits);
+		Entry.Value = (Entry.Value * Visits + Value) / (Visits + 1.0f);
+		Entry.Visits = static_cast<uint16>(FMath::Min<int32>(Entry.Visits + 1, MAX_uint16));
+		Entry.Depth = FMath::Max(Entry.Depth, Depth);
+	}
+	else
+	{
+		Entry.Value = Value;
+		Entry.Visits = 1;
+		Entry.Depth = Depth;
+	}
+
+	Store(Key, Entry);
+}
+
+uint64 FLairTranspositionTable::GetNumProbes() const
+{
+	uint64 Total = 0;
+	for (const FCounterShard& Shard : CounterShards)
+	{
+		Total += Shard.Probes.load(std::memory_order_relaxed);
+	}
+	return Total;
+}
+
+uint64 FLairTranspositionTable::GetNumHits() const
+{
+	uint64 Total = 0;
+	for (const FCounterShard& Shard : CounterShards)
+	{
+		Total += Shard.Hits.load(std::memory_order_relaxed);
+	}
+	return Total;
+}
+
+double FLairTranspositionTable::GetHitRate() const
+{
+	const uint64 Probes = GetNumProbes();
+	return Probes > 0 ? static_cast<double>(GetNumHits()) / static_cast<double>(Probes) : 0.0;
+}
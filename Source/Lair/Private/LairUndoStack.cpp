@@ -0,0 +1,49 @@
+// LairUndoStack.cpp
+// Undo Stack (Per-Action Deltas)
+
+#include "LairUndoStack.h"
+
+void FLairUndoStack::SetCapacity(int32 InCapacity)
+{
+	Records.Reset();
+	Records.SetNum(FMath::Max(InCapacity, 1));
+	Reset();
+}
+
+void FLairUndoStack::Push(FLairUndoRecord&& Record, bool bFromRedo)
+{
+	if (Records.Num() == 0)
+	{
+		SetCapacity(1);
+	}
+
+	if (bFromRedo && Cursor < Count)
+	{
+		// Same action as the redo record: refresh it and keep the rest of the redo chain
+		Records[GetSlot(Cursor)] = MoveTemp(Record);
+		++Cursor;
+		return;
+	}
+
+	// A new action invalidates everything that was undone
+	Count = Cursor;
+
+	if (Count == Records.Num())
+	{
+		// Full: forget the oldest record
+		Start = (Start + 1) % Records.Num();
+		--Count;
+		--Cursor;
+	}
+
+	Records[GetSlot(Count)] = MoveTemp(Record);
+	++Count;
+	++Cursor;
+}
+
+const FLairUndoRecord& FLairUndoStack::Undo()
+{
+	check(CanUndo());
+	--Cursor;
+	return Records[GetSlot(Cursor)];
+}
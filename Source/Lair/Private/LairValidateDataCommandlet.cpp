@@ -0,0 +1,438 @@
+// LairValidateDataCommandlet.cpp
+// Data Validation Commandlet (Content Checks)
+
+#include "LairValidateDataCommandlet.h"
+#include "LairLog.h"
+#include "LairMatchState.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/ParallelFor.h"
+#include "Engine/DataTable.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+	/** Sentinel for grid cells without a layout row */
+	constexpr uint8 NO_TILE = 0xFF;
+
+	/** Largest coordinate a layout row may use; anything beyond is treated as a typo */
+	constexpr int32 MAX_BOARD_DIMENSION = 1024;
+
+	/** Row names and typed row pointers of a table, in table order */
+	template<typename RowType>
+	void GatherRows(const UDataTable* Table, TArray<FName>& OutRowNames, TArray<const RowType*>& OutRows)
+	{
+		for (const TPair<FName, uint8*>& Pair : Table->GetRowMap())
+		{
+			OutRowNames.Add(Pair.Key);
+			OutRows.Add(reinterpret_cast<const RowType*>(Pair.Value));
+		}
+	}
+
+	void AddIssue(TArray<ULairValidateDataCommandlet::FIssue>& Issues, const FString& Asset, FName Row, bool bError, FString&& Message)
+	{
+		ULairValidateDataCommandlet::FIssue& Issue = Issues.AddDefaulted_GetRef();
+		Issue.Asset = Asset;
+		Issue.Row = Row;
+		Issue.bError = bError;
+		Issue.Message = MoveTemp(Message);
+	}
+
+	FString EscapeJson(const FString& Value)
+	{
+		FString Escaped;
+		Escaped.Reserve(Value.Len());
+		for (const TCHAR Char : Value)
+		{
+			switch (Char)
+			{
+			case TEXT('\\'): Escaped += TEXT("\\\\"); break;
+			case TEXT('"'): Escaped += TEXT("\\\""); break;
+			case TEXT('\n'): Escaped += TEXT("\\n"); break;
+			case TEXT('\r'): Escaped += TEXT("\\r"); break;
+			case TEXT('\t'): Escaped += TEXT("\\t"); break;
+			default:
+				// Remaining control characters are not allowed raw in JSON strings
+				if (Char < 0x20)
+				{
+					Escaped += FString::Printf(TEXT("\\u%04x"), static_cast<uint32>(Char));
+				}
+				else
+				{
+					Escaped.AppendChar(Char);
+				}
+				break;
+			}
+		}
+		return Escaped;
+	}
+}
+
+ULairValidateDataCommandlet::ULairValidateDataCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+	ShowErrorCount = true;
+}
+
+int32 ULairValidateDataCommandlet::Main(const FString& Params)
+{
+	// Parse arguments
+	FString ContentPath = TEXT("/Game");
+	FString ReportPath = FPaths::ProjectSavedDir() / TEXT("DataValidation.json");
+	FParse::Value(*Params, TEXT("Path="), ContentPath);
+	FParse::Value(*Params, TEXT("Report="), ReportPath);
+	const bool bWarningsAsErrors = FParse::Param(*Params, TEXT("WarningsAsErrors"));
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Find every data table (loading stays on the game thread)
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	AssetRegistry.SearchAllAssets(true);
+
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UDataTable::StaticClass()->GetClassPathName());
+	Filter.PackagePaths.Add(FName(*ContentPath));
+	Filter.bRecursivePaths = true;
+
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssets(Filter, Assets);
+
+	TArray<const UDataTable*> UnitTables;
+	TArray<const UDataTable*> TileTypeTables;
+	TArray<const UDataTable*> LayoutTables;
+	for (const FAssetData& Asset : Assets)
+	{
+		const UDataTable* Table = Cast<UDataTable>(Asset.GetAsset());
+		const UScriptStruct* RowStruct = Table ? Table->GetRowStruct() : nullptr;
+		if (!RowStruct)
+		{
+			continue;
+		}
+
+		if (RowStruct->IsChildOf(FUnitData::StaticStruct()))
+		{
+			UnitTables.Add(Table);
+		}
+		else if (RowStruct->IsChildOf(FTileTypeData::StaticStruct()))
+		{
+			TileTypeTables.Add(Table);
+		}
+		else if (RowStruct->IsChildOf(FBoardLayoutRow::StaticStruct()))
+		{
+			LayoutTables.Add(Table);
+		}
+	}
+
+	TArray<FIssue> Issues;
+
+	// Tile types: every layout is checked against all of them
+	TMap<FName, uint8> TileTypeFlags;
+	for (const UDataTable* Table : TileTypeTables)
+	{
+		TArray<FName> RowNames;
+		TArray<const FTileTypeData*> Rows;
+		GatherRows(Table, RowNames, Rows);
+		for (int32 i = 0; i < Rows.Num(); ++i)
+		{
+			TileTypeFlags.Add(RowNames[i], ELairTileFlags::FromTileTypeData(*Rows[i]));
+		}
+	}
+
+	if (TileTypeTables.Num() == 0)
+	{
+		AddIssue(Issues, ContentPath, NAME_None, false, TEXT("No tile type table found; layouts are checked against the built-in Empty and PlayerBase types"));
+		TileTypeFlags.Add(FName("Empty"), ELairTileFlags::Walkable);
+		TileTypeFlags.Add(FName("PlayerBase"), ELairTileFlags::Walkable);
+	}
+
+	// Units and layouts: one job per table, each with its own issue list
+	const int32 NumJobs = UnitTables.Num() + LayoutTables.Num();
+	TArray<TArray<FIssue>> JobIssues;
+	JobIssues.SetNum(NumJobs);
+
+	ParallelFor(NumJobs, [&UnitTables, &LayoutTables, &TileTypeFlags, &JobIssues](int32 JobIndex)
+	{
+		if (JobIndex < UnitTables.Num())
+		{
+			const UDataTable* Table = UnitTables[JobIndex];
+			TArray<FName> RowNames;
+			TArray<const FUnitData*> Rows;
+			GatherRows(Table, RowNames, Rows);
+			ValidateUnits(Table->GetPathName(), RowNames, Rows, JobIssues[JobIndex]);
+		}
+		else
+		{
+			const UDataTable* Table = LayoutTables[JobIndex - UnitTables.Num()];
+			TArray<FName> RowNames;
+			TArray<const FBoardLayoutRow*> Rows;
+			GatherRows(Table, RowNames, Rows);
+			ValidateLayout(Table->GetPathName(), RowNames, Rows, TileTypeFlags, JobIssues[JobIndex]);
+		}
+	}, EParallelForFlags::Unbalanced);
+
+	for (TArray<FIssue>& Job : JobIssues)
+	{
+		Issues.Append(MoveTemp(Job));
+	}
+
+	const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+
+	int32 NumErrors = 0;
+	int32 NumWarnings = 0;
+	for (const FIssue& Issue : Issues)
+	{
+		if (Issue.bError)
+		{
+			++NumErrors;
+			UE_LOG(LogLair, Error, TEXT("%s [%s]: %s"), *Issue.Asset, *Issue.Row.ToString(), *Issue.Message);
+		}
+		else
+		{
+			++NumWarnings;
+			UE_LOG(LogLair, Warning, TEXT("%s [%s]: %s"), *Issue.Asset, *Issue.Row.ToString(), *Issue.Message);
+		}
+	}
+
+	UE_LOG(LogLair, Display, TEXT("ULairValidateDataCommandlet::Main - %d unit, %d tile type and %d layout tables in %.2fs: %d errors, %d warnings"),
+		UnitTables.Num(), TileTypeTables.Num(), LayoutTables.Num(), ElapsedSeconds, NumErrors, NumWarnings);
+
+	// JSON report
+	FString Report = TEXT("{\n");
+	Report += FString::Printf(TEXT("  \"path\": \"%s\",\n  \"unitTables\": %d,\n  \"tileTypeTables\": %d,\n  \"layouts\": %d,\n"),
+		*EscapeJson(ContentPath), UnitTables.Num(), TileTypeTables.Num(), LayoutTables.Num());
+	Report += FString::Printf(TEXT("  \"seconds\": %.3f,\n  \"errors\": %d,\n  \"warnings\": %d,\n"),
+		ElapsedSeconds, NumErrors, NumWarnings);
+	Report += TEXT("  \"issues\": [\n");
+	for (int32 i = 0; i < Issues.Num(); ++i)
+	{
+		const FIssue& Issue = Issues[i];
+		Report += FString::Printf(TEXT("    { \"asset\": \"%s\", \"row\": \"%s\", \"severity\": \"%s\", \"message\": \"%s\" }%s\n"),
+			*EscapeJson(Issue.Asset), Issue.Row.IsNone() ? TEXT("") : *EscapeJson(Issue.Row.ToString()),
+			Issue.bError ? TEXT("error") : TEXT("warning"), *EscapeJson(Issue.Message),
+			(i + 1 < Issues.Num()) ? TEXT(",") : TEXT(""));
+	}
+	Report += TEXT("  ]\n}\n");
+
+	if (!FFileHelper::SaveStringToFile(Report, *ReportPath))
+	{
+		UE_LOG(LogLair, Error, TEXT("ULairValidateDataCommandlet::Main - Failed to write report to %s"), *ReportPath);
+		return 1;
+	}
+
+	UE_LOG(LogLair, Display, TEXT("ULairValidateDataCommandlet::Main - Report written to %s"), *ReportPath);
+	return (NumErrors > 0 || (bWarningsAsErrors && NumWarnings > 0)) ? 1 : 0;
+}
+
+void ULairValidateDataCommandlet::ValidateUnits(const FString& Asset, const TArray<FName>& RowNames,
+	const TArray<const FUnitData*>& Rows, TArray<FIssue>& OutIssues)
+{
+	if (Rows.Num() == 0)
+	{
+		AddIssue(OutIssues, Asset, NAME_None, true, TEXT("Unit table is empty"));
+	}
+	else if (Rows.Num() > MAX_uint8)
+	{
+		AddIssue(OutIssues, Asset, NAME_None, true, FString::Printf(TEXT("%d unit types; the rules table holds at most %d"), Rows.Num(), MAX_uint8));
+	}
+
+	for (int32 i = 0; i < Rows.Num(); ++i)
+	{
+		const FUnitData& Unit = *Rows[i];
+		const FName Row = RowNames[i];
+
+		if (Unit.Cost < 0)
+		{
+			AddIssue(OutIssues, Asset, Row, true, FString::Printf(TEXT("Negative cost %d"), Unit.Cost));
+		}
+		if (Unit.MovementPoints < 0 || Unit.MovementPoints > 255)
+		{
+			AddIssue(OutIssues, Asset, Row, true, FString::Printf(TEXT("MovementPoints %d outside 0..255"), Unit.MovementPoints));
+		}
+		if (Unit.HitPoints < 1 || Unit.HitPoints > 255)
+		{
+			AddIssue(OutIssues, Asset, Row, true, FString::Printf(TEXT("HitPoints %d outside 1..255"), Unit.HitPoints));
+		}
+
+		// A unit must fit on an empty base tile, or it can never be bought
+		if (Unit.SubSlotSize < 1 || Unit.SubSlotSize > LairConstants::TILE_SUB_SLOTS)
+		{
+			AddIssue(OutIssues, Asset, Row, true, FString::Printf(TEXT("SubSlotSize %d does not fit a tile (1..%d)"),
+				Unit.SubSlotSize, LairConstants::TILE_SUB_SLOTS));
+		}
+		else if (Unit.SubSlotSize > 2)
+		{
+			AddIssue(OutIssues, Asset, Row, false, FString::Printf(TEXT("SubSlotSize %d: spawning only reserves contiguous sub-slots for sizes 1 and 2"),
+				Unit.SubSlotSize));
+		}
+
+		for (const int32 Face : Unit.AttackDiceValues)
+		{
+			if (Face < 1 || Face > 6)
+			{
+				AddIssue(OutIssues, Asset, Row, true, FString::Printf(TEXT("Attack die value %d is not a face of a d6"), Face));
+			}
+		}
+		if (Unit.AttackDiceValues.Num() > 0 && Unit.NumberOfDice < 1)
+		{
+			AddIssue(OutIssues, Asset, Row, true, FString::Printf(TEXT("Has hit faces but rolls %d dice"), Unit.NumberOfDice));
+		}
+	}
+}
+
+void ULairValidateDataCommandlet::ValidateLayout(const FString& Asset, const TArray<FName>& RowNames,
+	const TArray<const FBoardLayoutRow*>& Rows, const TMap<FName, uint8>& TileTypeFlags, TArray<FIssue>& OutIssues)
+{
+	if (Rows.Num() == 0)
+	{
+		AddIssue(OutIssues, Asset, NAME_None, true, TEXT("Layout is empty"));
+		return;
+	}
+
+	// Bounds, as LoadBoardFromDataTable computes them
+	FIntPoint BoardSize(0, 0);
+	for (int32 i = 0; i < Rows.Num(); ++i)
+	{
+		const FIntPoint Coord = Rows[i]->GridCoord;
+		if (Coord.X < 0 || Coord.Y < 0)
+		{
+			AddIssue(OutIssues, Asset, RowNames[i], true, FString::Printf(TEXT("Negative coordinate (%d, %d)"), Coord.X, Coord.Y));
+			continue;
+		}
+		if (Coord.X >= MAX_BOARD_DIMENSION || Coord.Y >= MAX_BOARD_DIMENSION)
+		{
+			AddIssue(OutIssues, Asset, RowNames[i], true, FString::Printf(TEXT("Coordinate (%d, %d) is beyond the %d tile board limit"),
+				Coord.X, Coord.Y, MAX_BOARD_DIMENSION));
+			continue;
+		}
+		BoardSize.X = FMath::Max(BoardSize.X, Coord.X + 1);
+		BoardSize.Y = FMath::Max(BoardSize.Y, Coord.Y + 1);
+	}
+
+	// The match simulation accepts at most FLairMatchRules::MAX_TILES tiles
+	const int64 NumCells = static_cast<int64>(BoardSize.X) * BoardSize.Y;
+	if (NumCells > FLairMatchRules::MAX_TILES)
+	{
+		AddIssue(OutIssues, Asset, NAME_None, true, FString::Printf(TEXT("%dx%d board has %lld tiles; at most %d are supported"),
+			BoardSize.X, BoardSize.Y, NumCells, FLairMatchRules::MAX_TILES));
+		return;
+	}
+
+	// Flags per cell (NO_TILE where the layout has no row)
+	TArray<uint8> Grid;
+	Grid.Init(NO_TILE, static_cast<int32>(NumCells));
+
+	TArray<int32> BaseCells;
+	BaseCells.Init(INDEX_NONE, LairConstants::MAX_PLAYERS);
+
+	for (int32 i = 0; i < Rows.Num(); ++i)
+	{
+		const FBoardLayoutRow& Tile = *Rows[i];
+		const FName Row = RowNames[i];
+		if (Tile.GridCoord.X < 0 || Tile.GridCoord.Y < 0 || Tile.GridCoord.X >= BoardSize.X || Tile.GridCoord.Y >= BoardSize.Y)
+		{
+			continue;
+		}
+
+		const int32 Cell = Tile.GridCoord.Y * BoardSize.X + Tile.GridCoord.X;
+		if (Grid[Cell] != NO_TILE)
+		{
+			AddIssue(OutIssues, Asset, Row, true, FString::Printf(TEXT("Duplicate coordinate (%d, %d)"), Tile.GridCoord.X, Tile.GridCoord.Y));
+			continue;
+		}
+
+		const uint8* Flags = TileTypeFlags.Find(Tile.TileTypeID);
+		if (!Flags)
+		{
+			AddIssue(OutIssues, Asset, Row, true, FString::Printf(TEXT("Unknown tile type %s"), *Tile.TileTypeID.ToString()));
+		}
+		Grid[Cell] = Flags ? *Flags : static_cast<uint8>(ELairTileFlags::None);
+
+		if (Tile.PlayerBaseIndex == INDEX_NONE)
+		{
+			continue;
+		}
+		if (!BaseCells.IsValidIndex(Tile.PlayerBaseIndex))
+		{
+			AddIssue(OutIssues, Asset, Row, true, FString::Printf(TEXT("PlayerBaseIndex %d outside -1..%d"),
+				Tile.PlayerBaseIndex, LairConstants::MAX_PLAYERS - 1));
+		}
+		else if (BaseCells[Tile.PlayerBaseIndex] != INDEX_NONE)
+		{
+			AddIssue(OutIssues, Asset, Row, true, FString::Printf(TEXT("Second base for player %d"), Tile.PlayerBaseIndex));
+		}
+		else
+		{
+			BaseCells[Tile.PlayerBaseIndex] = Cell;
+			if (!(Grid[Cell] & ELairTileFlags::Walkable))
+			{
+				AddIssue(OutIssues, Asset, Row, true, FString::Printf(TEXT("Base of player %d is not walkable"), Tile.PlayerBaseIndex));
+			}
+		}
+	}
+
+	int32 NumHoles = 0;
+	for (const uint8 Flags : Grid)
+	{
+		NumHoles += (Flags == NO_TILE) ? 1 : 0;
+	}
+	if (NumHoles > 0)
+	{
+		AddIssue(OutIssues, Asset, NAME_None, false, FString::Printf(TEXT("%d cells of the %dx%d board have no tile"),
+			NumHoles, BoardSize.X, BoardSize.Y));
+	}
+
+	for (int32 Player = 0; Player < BaseCells.Num(); ++Player)
+	{
+		if (BaseCells[Player] == INDEX_NONE)
+		{
+			AddIssue(OutIssues, Asset, NAME_None, true, FString::Printf(TEXT("No base for player %d (the board falls back to a default coordinate)"), Player));
+		}
+	}
+
+	// Bases must reach each other over walkable tiles (8-way, as GetMovementCost allows)
+	if (BaseCells[0] == INDEX_NONE)
+	{
+		return;
+	}
+
+	TBitArray<> Reached(false, Grid.Num());
+	TArray<int32> Frontier;
+	Frontier.Add(BaseCells[0]);
+	Reached[BaseCells[0]] = true;
+	while (Frontier.Num() > 0)
+	{
+		const int32 Cell = Frontier.Pop(false);
+		const int32 X = Cell % BoardSize.X;
+		const int32 Y = Cell / BoardSize.X;
+		for (int32 DY = -1; DY <= 1; ++DY)
+		{
+			for (int32 DX = -1; DX <= 1; ++DX)
+			{
+				const int32 NX = X + DX;
+				const int32 NY = Y + DY;
+				if ((DX == 0 && DY == 0) || NX < 0 || NY < 0 || NX >= BoardSize.X || NY >= BoardSize.Y)
+				{
+					continue;
+				}
+
+				const int32 Neighbor = NY * BoardSize.X + NX;
+				if (!Reached[Neighbor] && Grid[Neighbor] != NO_TILE && (Grid[Neighbor] & ELairTileFlags::Walkable))
+				{
+					Reached[Neighbor] = true;
+					Frontier.Add(Neighbor);
+				}
+			}
+		}
+	}
+
+	for (int32 Player = 1; Player < BaseCells.Num(); ++Player)
+	{
+		if (BaseCells[Player] != INDEX_NONE && !Reached[BaseCells[Player]])
+		{
+			AddIssue(OutIssues, Asset, NAME_None, true, FString::Printf(TEXT("Base of player %d cannot be reached from player 0's base"), Player));
+		}
+	}
+}
@@ -0,0 +1,194 @@
+// MiningSystemComponent.cpp
+// Mining System Component (Mining Deck)
+
+#include "MiningSystemComponent.h"
+#include "LairLog.h"
+#include "Tile.h"
+#include "Unit.h"
+#include "Engine/DataTable.h"
+
+// ============================================================================
+// FMiningDeck
+// ============================================================================
+
+void FMiningDeck::Initialize(TSharedPtr<const TArray<FMiningCardData>> InCardTable, FLairRandomStream& Stream)
+{
+	CardTable = MoveTemp(InCardTable);
+	Order.Reset();
+	CurrentCardIndex = 0;
+
+	if (!CardTable.IsValid())
+	{
+		return;
+	}
+
+	const int32 NumCards = FMath::Min(CardTable->Num(), static_cast<int32>(MAX_uint16));
+	for (int32 CardIndex = 0; CardIndex < NumCards; ++CardIndex)
+	{
+		const int32 Copies = FMath::Max(0, (*CardTable)[CardIndex].CopiesInDeck);
+		for (int32 Copy = 0; Copy < Copies; ++Copy)
+		{
+			Order.Add(static_cast<uint16>(CardIndex));
+		}
+	}
+
+	Reshuffle(Stream);
+}
+
+int32 FMiningDeck::DrawIndex(FLairRandomStream& Stream)
+{
+	if (Order.Num() == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	if (CurrentCardIndex >= Order.Num())
+	{
+		Reshuffle(Stream);
+	}
+
+	return Order[CurrentCardIndex++];
+}
+
+void FMiningDeck::Reshuffle(FLairRandomStream& Stream)
+{
+	Stream.Shuffle(MakeArrayView(Order));
+	CurrentCardIndex = 0;
+}
+
+// ============================================================================
+// UMiningSystemComponent
+// ============================================================================
+
+UMiningSystemComponent::UMiningSystemComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+
+	MiningCardsDataTable = nullptr;
+	RandomStream = nullptr;
+}
+
+void UMiningSystemComponent::Initialize(UDataTable* InMiningCardsTable, FLairRandomStream* InRandomStream)
+{
+	MiningCardsDataTable = InMiningCardsTable;
+	RandomStream = InRandomStream;
+
+	if (!RandomStream)
+	{
+		UE_LOG(LogLairEconomy, Warning, TEXT("UMiningSystemComponent::Initialize - No match RNG stream, using local stream"));
+		LocalStream.Seed(FLairRandomService::MakeRandomSeed());
+	}
+
+	Deck.Initialize(BuildCardTable(), GetStream());
+
+	UE_LOG(LogLairEconomy, Log, TEXT("UMiningSystemComponent::Initialize - Deck built with %d cards (%d distinct)"),
+		Deck.Num(), Deck.CardTable.IsValid() ? Deck.CardTable->Num() : 0);
+}
+
+TSharedPtr<const TArray<FMiningCardData>> UMiningSystemComponent::BuildCardTable() const
+{
+	TSharedPtr<TArray<FMiningCardData>> CardTable = MakeShared<TArray<FMiningCardData>>();
+
+	if (MiningCardsDataTable)
+	{
+		// Iterate by row name and use FindRow to ensure correct key/value pairing
+		TArray<FName> RowNames = MiningCardsDataTable->GetRowNames();
+		for (const FName& RowName : RowNames)
+		{
+			FMiningCardData* CardRow = MiningCardsDataTable->FindRow<FMiningCardData>(RowName, TEXT("BuildCardTable"));
+			if (CardRow)
+			{
+				CardTable->Add(*CardRow);
+			}
+		}
+	}
+	else
+	{
+		UE_LOG(LogLairEconomy, Log, TEXT("UMiningSystemComponent::BuildCardTable - Created default mining deck"));
+		return MakeDefaultCardTable();
+	}
+
+	return CardTable;
+}
+
+TSharedPtr<const TArray<FMiningCardData>> UMiningSystemComponent::MakeDefaultCardTable()
+{
+	TSharedPtr<TArray<FMiningCardData>> CardTable = MakeShared<TArray<FMiningCardData>>();
+
+	// Default deck matching the Technical Specification distribution (120 cards)
+	auto AddCard = [&CardTable](EMiningOutcome Outcome, const TCHAR* OutcomeID, int32 GoldValue, int32 Copies)
+	{
+		FMiningCardData Card;
+		Card.OutcomeType = Outcome;
+		Card.OutcomeID = FName(OutcomeID);
+		Card.GoldValue = GoldValue;
+		Card.CopiesInDeck = Copies;
+		CardTable->Add(Card);
+	};
+
+	AddCard(EMiningOutcome::Mineral, TEXT("IronOre"), 50, 22);
+	AddCard(EMiningOutcome::Mineral, TEXT("Copper"), 70, 20);
+	AddCard(EMiningOutcome::Mineral, TEXT("Silver"), 90, 17);
+	AddCard(EMiningOutcome::Mineral, TEXT("Gold"), 120, 15);
+	AddCard(EMiningOutcome::Mineral, TEXT("Platinum"), 200, 9);
+	AddCard(EMiningOutcome::Mineral, TEXT("Gems"), 350, 5);
+	AddCard(EMiningOutcome::Treasure, TEXT("Treasure"), 0, 8);
+	AddCard(EMiningOutcome::Monster, TEXT("Monster"), 0, 10);
+	AddCard(EMiningOutcome::MinedOut, TEXT("MinedOut"), 0, 6);
+	AddCard(EMiningOutcome::DigDeeper, TEXT("DigDeeper"), 0, 8);
+
+	return CardTable;
+}
+
+FMiningResult UMiningSystemComponent::DrawMiningCard(AUnit* Miner, ATile* MiningTile)
+{
+	FMiningResult Result;
+
+	if (!Miner || !MiningTile)
+	{
+		UE_LOG(LogLairEconomy, Warning, TEXT("UMiningSystemComponent::DrawMiningCard - Miner or tile is null"));
+		return Result;
+	}
+
+	const FMiningCardData* Card = DrawCard();
+	if (!Card)
+	{
+		UE_LOG(LogLairEconomy, Warning, TEXT("UMiningSystemComponent::DrawMiningCard - Mining deck is empty"));
+		return Result;
+	}
+
+	ResolveMiningOutcome(*Card, Miner, MiningTile, Result);
+
+	UE_LOG(LogLairEconomy, Verbose, TEXT("UMiningSystemComponent::DrawMiningCard - Tile (%d, %d) drew outcome %d (%d gold), %d cards left"),
+		MiningTile->GridCoord.X, MiningTile->GridCoord.Y, static_cast<int32>(Result.OutcomeType), Result.GoldValue,
+		Deck.GetRemainingCards());
+
+	return Result;
+}
+
+const FMiningCardData* UMiningSystemComponent::DrawCard()
+{
+	const int32 CardIndex = Deck.DrawIndex(GetStream());
+	return (CardIndex != INDEX_NONE) ? &Deck.GetCard(CardIndex) : nullptr;
+}
+
+void UMiningSystemComponent::ShuffleMiningDeck()
+{
+	Deck.Reshuffle(GetStream());
+	UE_LOG(LogLairEconomy, Log, TEXT("UMiningSystemComponent::ShuffleMiningDeck - Reshuffled %d cards"), Deck.Num());
+}
+
+void UMiningSystemComponent::RestoreDeck(const FMiningDeck& Snapshot)
+{
+	Deck = Snapshot;
+}
+
+void UMiningSystemComponent::ResolveMiningOutcome(const FMiningCardData& CardData, AUnit* Miner, ATile* Tile, FMiningResult& OutResult) const
+{
+	OutResult.OutcomeType = CardData.OutcomeType;
+	OutResult.OutcomeID = CardData.OutcomeID;
+	OutResult.GoldValue = (CardData.OutcomeType == EMiningOutcome::Mineral) ? CardData.GoldValue : 0;
+
+	// Monster spawning arrives with the monster system; report the draw only
+	OutResult.bSpawnedMonster = false;
+}
@@ -2,10 +2,119 @@
 // Step 8: Rules Engine Component (Validation Logic)
 
 #include "RulesEngineComponent.h"
+#include "LairLog.h"
+#include "LairMemory.h"
+#include "LairTrace.h"
+#include "LairStats.h"
 #include "Tile.h"
 #include "Unit.h"
+#include "CombatOddsComponent.h"
+#include "BoardSystemComponent.h"
 #include "Engine/DataTable.h"
 
+namespace
+{
+	FLairUnitTypeStats MakeUnitStats(const FUnitData& Row)
+	{
+		FLairUnitTypeStats Stats;
+		Stats.Cost = Row.Cost;
+		Stats.MovementPoints = static_cast<uint8>(FMath::Clamp(Row.MovementPoints, 0, 255));
+		Stats.HitPoints = static_cast<uint8>(FMath::Clamp(Row.HitPoints, 1, 255));
+		Stats.SubSlotSize = static_cast<uint8>(FMath::Clamp(Row.SubSlotSize, 1, LairConstants::TILE_SUB_SLOTS));
+		Stats.bCanMine = Row.bCanMine ? 1 : 0;
+		return Stats;
+	}
+}
+
+// ============================================================================
+// FLairRulesTable
+// ============================================================================
+
+void FLairRulesTable::Reset()
+{
+	UnitTypeNames.Reset();
+	UnitStats.Reset();
+	UnitHitFaceMasks.Reset();
+	UnitRows.Empty();
+	TileTypeNames.Reset();
+	TileFlags.Reset();
+	TileRows.Empty();
+	UnitTypeIds.Reset();
+	TileTypeIds.Reset();
+}
+
+SIZE_T FLairRulesTable::GetAllocatedSize() const
+{
+	SIZE_T Size = UnitTypeNames.GetAllocatedSize() + UnitStats.GetAllocatedSize() + UnitHitFaceMasks.GetAllocatedSize()
+		+ TileTypeNames.GetAllocatedSize() + TileFlags.GetAllocatedSize()
+		+ UnitTypeIds.GetAllocatedSize() + TileTypeIds.GetAllocatedSize();
+
+	// Indirect arrays own one heap block per row plus the pointer array
+	Size += UnitRows.GetAllocatedSize() + UnitRows.Num() * sizeof(FUnitData);
+	Size += TileRows.GetAllocatedSize() + TileRows.Num() * sizeof(FTileTypeData);
+	return Size;
+}
+
+void FLairRulesTable::AddUnitType(FName UnitTypeID, const FUnitData& Row)
+{
+	if (UnitTypeNames.Num() >= INVALID_ID)
+	{
+		UE_LOG(LogLairRules, Warning, TEXT("FLairRulesTable::AddUnitType - Too many unit types, ignoring %s"), *UnitTypeID.ToString());
+		return;
+	}
+
+	UnitTypeIds.Add(UnitTypeID, static_cast<uint8>(UnitTypeNames.Num()));
+	UnitTypeNames.Add(UnitTypeID);
+	UnitStats.Add(MakeUnitStats(Row));
+	UnitHitFaceMasks.Add(FCombatantProfile::MakeHitFaceMask(Row.AttackDiceValues));
+	UnitRows.Add(new FUnitData(Row));
+}
+
+void FLairRulesTable::AddTileType(FName TileTypeID, const FTileTypeData& Row)
+{
+	if (TileTypeNames.Num() >= INVALID_ID)
+	{
+		UE_LOG(LogLairRules, Warning, TEXT("FLairRulesTable::AddTileType - Too many tile types, ignoring %s"), *TileTypeID.ToString());
+		return;
+	}
+
+	TileTypeIds.Add(TileTypeID, static_cast<uint8>(TileTypeNames.Num()));
+	TileTypeNames.Add(TileTypeID);
+	TileFlags.Add(ELairTileFlags::FromTileTypeData(Row));
+	TileRows.Add(new FTileTypeData(Row));
+}
+
+bool FLairRulesTable::UpdateUnitType(uint8 UnitTypeId, const FUnitData& Row)
+{
+	if (!UnitRows.IsValidIndex(UnitTypeId)
+		|| FUnitData::StaticStruct()->CompareScriptStruct(&UnitRows[UnitTypeId], &Row, PPF_None))
+	{
+		return false;
+	}
+
+	UnitRows[UnitTypeId] = Row;
+	UnitStats[UnitTypeId] = MakeUnitStats(Row);
+	UnitHitFaceMasks[UnitTypeId] = FCombatantProfile::MakeHitFaceMask(Row.AttackDiceValues);
+	return true;
+}
+
+bool FLairRulesTable::UpdateTileType(uint8 TileTypeId, const FTileTypeData& Row)
+{
+	if (!TileRows.IsValidIndex(TileTypeId)
+		|| FTileTypeData::StaticStruct()->CompareScriptStruct(&TileRows[TileTypeId], &Row, PPF_None))
+	{
+		return false;
+	}
+
+	TileRows[TileTypeId] = Row;
+	TileFlags[TileTypeId] = ELairTileFlags::FromTileTypeData(Row);
+	return true;
+}
+
+// ============================================================================
+// URulesEngineComponent
+// ============================================================================
+
 URulesEngineComponent::URulesEngineComponent()
 {
 	PrimaryComponentTick.bCanEverTick = false;
@@ -14,21 +123,34 @@ URulesEngineComponent::URulesEngineComponent()
 	TileTypesDataTable = nullptr;
 }
 
+void URulesEngineComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UnbindTableChangeNotifications();
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void URulesEngineComponent::Initialize(UDataTable* InUnitsTable, UDataTable* InTileTypesTable)
 {
+	UnbindTableChangeNotifications();
+
 	UnitsDataTable = InUnitsTable;
 	TileTypesDataTable = InTileTypesTable;
 
 	CacheDataFromTables();
+	BindTableChangeNotifications();
+	SET_MEMORY_STAT(STAT_LairRulesMemory, RulesTable.GetAllocatedSize());
 
-	UE_LOG(LogTemp, Log, TEXT("URulesEngineComponent::Initialize - Cached %d unit types, %d tile types"),
-		CachedUnitData.Num(), CachedTileTypeData.Num());
+	UE_LOG(LogLairRules, Log, TEXT("URulesEngineComponent::Initialize - Cached %d unit types, %d tile types"),
+		RulesTable.NumUnitTypes(), RulesTable.NumTileTypes());
 }
 
 void URulesEngineComponent::CacheDataFromTables()
 {
-	CachedUnitData.Empty();
-	CachedTileTypeData.Empty();
+	TRACE_CPUPROFILER_EVENT_SCOPE(URulesEngineComponent::CacheDataFromTables);
+	LLM_SCOPE_BYTAG(Lair_Rules);
+
+	RulesTable.Reset();
 
 	// Cache unit data
 	if (UnitsDataTable)
@@ -41,8 +163,8 @@ void URulesEngineComponent::CacheDataFromTables()
 			FUnitData* UnitRow = UnitsDataTable->FindRow<FUnitData>(RowName, TEXT("CacheDataFromTables"));
 			if (UnitRow)
 			{
-				CachedUnitData.Add(RowName, *UnitRow);
-				UE_LOG(LogTemp, Verbose, TEXT("Cached unit: %s (Cost: %d, Movement: %d)"),
+				RulesTable.AddUnitType(RowName, *UnitRow);
+				UE_LOG(LogLairRules, Verbose, TEXT("Cached unit: %s (Cost: %d, Movement: %d)"),
 					*RowName.ToString(), UnitRow->Cost, UnitRow->MovementPoints);
 			}
 		}
@@ -56,7 +178,8 @@ void URulesEngineComponent::CacheDataFromTables()
 		MinerData.MovementPoints = 4;
 		MinerData.HitPoints = 1;
 		MinerData.SubSlotSize = 1;
-		CachedUnitData.Add(FName("Miner"), MinerData);
+		MinerData.bCanMine = true;
+		RulesTable.AddUnitType(FName("Miner"), MinerData);
 
 		FUnitData WagonData;
 		WagonData.DisplayName = FText::FromString(TEXT("Wagon"));
@@ -64,7 +187,7 @@ void URulesEngineComponent::CacheDataFromTables()
 		WagonData.MovementPoints = 6;
 		WagonData.HitPoints = 1;
 		WagonData.SubSlotSize = 2;
-		CachedUnitData.Add(FName("Wagon"), WagonData);
+		RulesTable.AddUnitType(FName("Wagon"), WagonData);
 
 		FUnitData FootmanData;
 		FootmanData.DisplayName = FText::FromString(TEXT("Footman"));
@@ -72,9 +195,9 @@ void URulesEngineComponent::CacheDataFromTables()
 		FootmanData.MovementPoints = 5;
 		FootmanData.HitPoints = 1;
 		FootmanData.SubSlotSize = 1;
-		CachedUnitData.Add(FName("Footman"), FootmanData);
+		RulesTable.AddUnitType(FName("Footman"), FootmanData);
 
-		UE_LOG(LogTemp, Log, TEXT("URulesEngineComponent::CacheDataFromTables - Created default unit data"));
+		UE_LOG(LogLairRules, Log, TEXT("URulesEngineComponent::CacheDataFromTables - Created default unit data"));
 	}
 
 	// Cache tile type data
@@ -88,7 +211,7 @@ void URulesEngineComponent::CacheDataFromTables()
 			FTileTypeData* TileRow = TileTypesDataTable->FindRow<FTileTypeData>(RowName, TEXT("CacheDataFromTables"));
 			if (TileRow)
 			{
-				CachedTileTypeData.Add(RowName, *TileRow);
+				RulesTable.AddTileType(RowName, *TileRow);
 			}
 		}
 	}
@@ -99,54 +222,278 @@ void URulesEngineComponent::CacheDataFromTables()
 		EmptyTile.DisplayName = FText::FromString(TEXT("Empty"));
 		EmptyTile.bWalkable = true;
 		EmptyTile.DebugColor = FLinearColor::White;
-		CachedTileTypeData.Add(FName("Empty"), EmptyTile);
+		RulesTable.AddTileType(FName("Empty"), EmptyTile);
 
 		FTileTypeData PlayerBaseTile;
 		PlayerBaseTile.DisplayName = FText::FromString(TEXT("Player Base"));
 		PlayerBaseTile.bWalkable = true;
 		PlayerBaseTile.DebugColor = FLinearColor::Blue;
-		CachedTileTypeData.Add(FName("PlayerBase"), PlayerBaseTile);
+		RulesTable.AddTileType(FName("PlayerBase"), PlayerBaseTile);
+
+		UE_LOG(LogLairRules, Log, TEXT("URulesEngineComponent::CacheDataFromTables - Created default tile type data"));
+	}
+}
+
+void URulesEngineComponent::BindTableChangeNotifications()
+{
+#if WITH_EDITOR
+	// Designers edit balance while playing; fold their edits in without a restart
+	if (UnitsDataTable)
+	{
+		UnitsTableChangedHandle = UnitsDataTable->OnDataTableChanged().AddUObject(this, &URulesEngineComponent::RefreshFromTables);
+	}
+	if (TileTypesDataTable)
+	{
+		TileTypesTableChangedHandle = TileTypesDataTable->OnDataTableChanged().AddUObject(this, &URulesEngineComponent::RefreshFromTables);
+	}
+#endif
+}
+
+void URulesEngineComponent::UnbindTableChangeNotifications()
+{
+#if WITH_EDITOR
+	if (UnitsDataTable && UnitsTableChangedHandle.IsValid())
+	{
+		UnitsDataTable->OnDataTableChanged().Remove(UnitsTableChangedHandle);
+	}
+	if (TileTypesDataTable && TileTypesTableChangedHandle.IsValid())
+	{
+		TileTypesDataTable->OnDataTableChanged().Remove(TileTypesTableChangedHandle);
+	}
+#endif
+	UnitsTableChangedHandle.Reset();
+	TileTypesTableChangedHandle.Reset();
+}
+
+void URulesEngineComponent::RefreshFromTables()
+{
+	if (bDeferTableEdits)
+	{
+		if (!bTableEditsPending)
+		{
+			UE_LOG(LogLairRules, Log, TEXT("URulesEngineComponent::RefreshFromTables - Edits deferred until released"));
+		}
+		bTableEditsPending = true;
+		return;
+	}
+
+	ApplyTableEdits();
+}
+
+void URulesEngineComponent::SetDeferTableEdits(bool bDefer)
+{
+	bDeferTableEdits = bDefer;
+
+	if (!bDefer && bTableEditsPending)
+	{
+		ApplyTableEdits();
+	}
+}
+
+void URulesEngineComponent::ApplyTableEdits()
+{
+	LLM_SCOPE_BYTAG(Lair_Rules);
+
+	bTableEditsPending = false;
+
+	TArray<uint8> ChangedUnitTypes;
+	TArray<uint8> ChangedTileTypes;
 
-		UE_LOG(LogTemp, Log, TEXT("URulesEngineComponent::CacheDataFromTables - Created default tile type data"));
+	if (UnitsDataTable)
+	{
+		for (const FName& RowName : UnitsDataTable->GetRowNames())
+		{
+			const FUnitData* UnitRow = UnitsDataTable->FindRow<FUnitData>(RowName, TEXT("ApplyTableEdits"));
+			if (!UnitRow)
+			{
+				continue;
+			}
+
+			uint8 UnitTypeId = RulesTable.FindUnitType(RowName);
+			if (UnitTypeId == FLairRulesTable::INVALID_ID)
+			{
+				RulesTable.AddUnitType(RowName, *UnitRow);
+				UnitTypeId = RulesTable.FindUnitType(RowName);
+				if (UnitTypeId != FLairRulesTable::INVALID_ID)
+				{
+					ChangedUnitTypes.Add(UnitTypeId);
+				}
+			}
+			else if (RulesTable.UpdateUnitType(UnitTypeId, *UnitRow))
+			{
+				ChangedUnitTypes.Add(UnitTypeId);
+			}
+		}
 	}
+
+	if (TileTypesDataTable)
+	{
+		for (const FName& RowName : TileTypesDataTable->GetRowNames())
+		{
+			const FTileTypeData* TileRow = TileTypesDataTable->FindRow<FTileTypeData>(RowName, TEXT("ApplyTableEdits"));
+			if (!TileRow)
+			{
+				continue;
+			}
+
+			uint8 TileTypeId = RulesTable.FindTileType(RowName);
+			if (TileTypeId == FLairRulesTable::INVALID_ID)
+			{
+				RulesTable.AddTileType(RowName, *TileRow);
+				TileTypeId = RulesTable.FindTileType(RowName);
+				if (TileTypeId != FLairRulesTable::INVALID_ID)
+				{
+					ChangedTileTypes.Add(TileTypeId);
+				}
+			}
+			else if (RulesTable.UpdateTileType(TileTypeId, *TileRow))
+			{
+				ChangedTileTypes.Add(TileTypeId);
+			}
+		}
+	}
+
+	if (ChangedUnitTypes.Num() == 0 && ChangedTileTypes.Num() == 0)
+	{
+		return;
+	}
+
+	SET_MEMORY_STAT(STAT_LairRulesMemory, RulesTable.GetAllocatedSize());
+
+	UE_LOG(LogLairRules, Log, TEXT("URulesEngineComponent::ApplyTableEdits - %d unit types, %d tile types changed"),
+		ChangedUnitTypes.Num(), ChangedTileTypes.Num());
+
+	OnRulesDataChangedNative.Broadcast(ChangedUnitTypes, ChangedTileTypes);
 }
 
 bool URulesEngineComponent::CanAffordUnit(int32 PlayerGold, FName UnitTypeID) const
 {
-	const FUnitData* UnitData = CachedUnitData.Find(UnitTypeID);
-	if (!UnitData)
+	const uint8 UnitTypeId = RulesTable.FindUnitType(UnitTypeID);
+	if (UnitTypeId == FLairRulesTable::INVALID_ID)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("URulesEngineComponent::CanAffordUnit - Unknown unit type: %s"),
+		UE_LOG(LogLairRules, Warning, TEXT("URulesEngineComponent::CanAffordUnit - Unknown unit type: %s"),
 			*UnitTypeID.ToString());
 		return false;
 	}
 
-	bool bCanAfford = PlayerGold >= UnitData->Cost;
+	return CanAffordUnitType(PlayerGold, UnitTypeId);
+}
+
+bool URulesEngineComponent::CanAffordUnitType(int32 PlayerGold, uint8 UnitTypeId) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_LairRulesCheck);
+
+	if (!IsValidUnitTypeId(UnitTypeId))
+	{
+		return false;
+	}
+
+	const int32 Cost = RulesTable.UnitStats[UnitTypeId].Cost;
+	if (PlayerGold < Cost)
+	{
+		UE_LOG(LogLairRules, Verbose, TEXT("URulesEngineComponent::CanAffordUnitType - %s costs %d, player has %d"),
+			*RulesTable.UnitTypeNames[UnitTypeId].ToString(), Cost, PlayerGold);
+		return false;
+	}
+
+	return true;
+}
+
+int32 URulesEngineComponent::ValidateBatch(int32 PlayerGold, TConstArrayView<FLairRulesCandidate> Candidates, TBitArray<>& OutResults) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_LairRulesValidateBatch);
+
+	OutResults.Init(false, Candidates.Num());
 
-	UE_LOG(LogTemp, Verbose, TEXT("URulesEngineComponent::CanAffordUnit - %s costs %d, player has %d: %s"),
-		*UnitTypeID.ToString(), UnitData->Cost, PlayerGold, bCanAfford ? TEXT("YES") : TEXT("NO"));
+	// Candidates usually share a tile (the base for purchases): gather its free sub-slots once
+	const ATile* MaskTile = nullptr;
+	uint8 FreeMask = 0;
 
-	return bCanAfford;
+	int32 NumPassed = 0;
+	for (int32 i = 0; i < Candidates.Num(); ++i)
+	{
+		const FLairRulesCandidate& Candidate = Candidates[i];
+		if (!IsValidUnitTypeId(Candidate.UnitTypeId))
+		{
+			UE_LOG(LogLairRules, Verbose, TEXT("URulesEngineComponent::ValidateBatch - Candidate %d: unknown unit type %d"), i, Candidate.UnitTypeId);
+			continue;
+		}
+
+		const FLairUnitTypeStats& Stats = RulesTable.UnitStats[Candidate.UnitTypeId];
+		if (Candidate.bPurchase && PlayerGold < Stats.Cost)
+		{
+			UE_LOG(LogLairRules, Verbose, TEXT("URulesEngineComponent::ValidateBatch - Candidate %d: %s costs %d, player has %d"),
+				i, *RulesTable.UnitTypeNames[Candidate.UnitTypeId].ToString(), Stats.Cost, PlayerGold);
+			continue;
+		}
+
+		if (Candidate.Tile)
+		{
+			if (Candidate.Tile != MaskTile)
+			{
+				MaskTile = Candidate.Tile;
+				FreeMask = MaskTile->GetFreeSubSlotMask();
+			}
+
+			if (!ATile::CanFitSubSlots(FreeMask, Stats.SubSlotSize))
+			{
+				UE_LOG(LogLairRules, Verbose, TEXT("URulesEngineComponent::ValidateBatch - Candidate %d: no room for size %d at (%d, %d)"),
+					i, Stats.SubSlotSize, MaskTile->GridCoord.X, MaskTile->GridCoord.Y);
+				continue;
+			}
+		}
+
+		OutResults[i] = true;
+		++NumPassed;
+	}
+
+	return NumPassed;
+}
+
+TArray<bool> URulesEngineComponent::GetPurchasableUnitTypes(int32 PlayerGold, ATile* SpawnTile) const
+{
+	TArray<FLairRulesCandidate, TInlineAllocator<16>> Candidates;
+	for (int32 UnitTypeId = 0; UnitTypeId < RulesTable.NumUnitTypes(); ++UnitTypeId)
+	{
+		Candidates.Emplace(static_cast<uint8>(UnitTypeId), true, SpawnTile);
+	}
+
+	TBitArray<> Results;
+	ValidateBatch(PlayerGold, Candidates, Results);
+
+	TArray<bool> Purchasable;
+	Purchasable.SetNumUninitialized(Candidates.Num());
+	for (int32 i = 0; i < Candidates.Num(); ++i)
+	{
+		Purchasable[i] = Results[i];
+	}
+	return Purchasable;
 }
 
 bool URulesEngineComponent::CanSpawnUnitAt(ATile* Tile, int32 SubSlotSize) const
 {
+	SCOPE_CYCLE_COUNTER(STAT_LairRulesCheck);
+
 	if (!Tile)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("URulesEngineComponent::CanSpawnUnitAt - Tile is null"));
+		UE_LOG(LogLairRules, Warning, TEXT("URulesEngineComponent::CanSpawnUnitAt - Tile is null"));
 		return false;
 	}
 
-	bool bCanPlace = Tile->CanPlaceUnit(SubSlotSize);
-
-	UE_LOG(LogTemp, Verbose, TEXT("URulesEngineComponent::CanSpawnUnitAt - Tile (%d, %d) for size %d: %s"),
-		Tile->GridCoord.X, Tile->GridCoord.Y, SubSlotSize, bCanPlace ? TEXT("YES") : TEXT("NO"));
+	if (!Tile->CanPlaceUnit(SubSlotSize))
+	{
+		UE_LOG(LogLairRules, Verbose, TEXT("URulesEngineComponent::CanSpawnUnitAt - No room at (%d, %d) for size %d"),
+			Tile->GridCoord.X, Tile->GridCoord.Y, SubSlotSize);
+		return false;
+	}
 
-	return bCanPlace;
+	return true;
 }
 
 bool URulesEngineComponent::CanPlaceUnitAt(ATile* Tile, AUnit* Unit) const
 {
+	SCOPE_CYCLE_COUNTER(STAT_LairRulesCheck);
+
 	if (!Tile || !Unit)
 	{
 		return false;
@@ -155,48 +502,56 @@ bool URulesEngineComponent::CanPlaceUnitAt(ATile* Tile, AUnit* Unit) const
 	return CanSpawnUnitAt(Tile, Unit->GetSubSlotSize());
 }
 
-FUnitData URulesEngineComponent::GetUnitData(FName UnitTypeID) const
+const FUnitData& URulesEngineComponent::GetUnitData(FName UnitTypeID) const
 {
-	const FUnitData* UnitData = CachedUnitData.Find(UnitTypeID);
-	if (UnitData)
+	const uint8 UnitTypeId = RulesTable.FindUnitType(UnitTypeID);
+	if (UnitTypeId != FLairRulesTable::INVALID_ID)
 	{
-		return *UnitData;
+		return RulesTable.UnitRows[UnitTypeId];
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("URulesEngineComponent::GetUnitData - Unknown unit type: %s"),
+	UE_LOG(LogLairRules, Warning, TEXT("URulesEngineComponent::GetUnitData - Unknown unit type: %s"),
 		*UnitTypeID.ToString());
 
-	return FUnitData();
+	static const FUnitData EmptyUnitData;
+	return EmptyUnitData;
 }
 
-FTileTypeData URulesEngineComponent::GetTileTypeData(FName TileTypeID) const
+const FTileTypeData& URulesEngineComponent::GetTileTypeData(FName TileTypeID) const
 {
-	const FTileTypeData* TileData = CachedTileTypeData.Find(TileTypeID);
-	if (TileData)
+	const uint8 TileTypeId = RulesTable.FindTileType(TileTypeID);
+	if (TileTypeId != FLairRulesTable::INVALID_ID)
 	{
-		return *TileData;
+		return RulesTable.TileRows[TileTypeId];
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("URulesEngineComponent::GetTileTypeData - Unknown tile type: %s"),
+	UE_LOG(LogLairRules, Warning, TEXT("URulesEngineComponent::GetTileTypeData - Unknown tile type: %s"),
 		*TileTypeID.ToString());
 
-	return FTileTypeData();
+	static const FTileTypeData EmptyTileTypeData;
+	return EmptyTileTypeData;
 }
 
 bool URulesEngineComponent::IsTileWalkable(ATile* Tile) const
 {
+	SCOPE_CYCLE_COUNTER(STAT_LairRulesCheck);
+
 	if (!Tile)
 	{
 		return false;
 	}
 
-	FTileTypeData TileData = GetTileTypeData(Tile->GetTileTypeID());
-	return TileData.bWalkable;
+	// Resolved at spawn into the board's per-tile flags
+	if (BoardSystem)
+	{
+		return BoardSystem->IsTileWalkable(Tile->GridCoord);
+	}
+
+	const uint8 TileTypeId = RulesTable.FindTileType(Tile->GetTileTypeID());
+	return (GetTileTypeFlags(TileTypeId) & ELairTileFlags::Walkable) != 0;
 }
 
 TArray<FName> URulesEngineComponent::GetAllUnitTypes() const
 {
-	TArray<FName> UnitTypes;
-	CachedUnitData.GetKeys(UnitTypes);
-	return UnitTypes;
+	return RulesTable.UnitTypeNames;
 }
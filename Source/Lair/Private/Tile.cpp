@@ -2,6 +2,8 @@
 // Step 3: Tile Actor (Board Building Block)
 
 #include "Tile.h"
+#include "LairLog.h"
+#include "LairStats.h"
 #include "Unit.h"
 #include "Components/StaticMeshComponent.h"
 #include "Materials/MaterialInstanceDynamic.h"
@@ -48,6 +50,9 @@ void ATile::BeginPlay()
 {
 	Super::BeginPlay();
 
+	INC_DWORD_STAT(STAT_LairLiveTiles);
+	INC_MEMORY_STAT_BY(STAT_LairTileMemory, sizeof(ATile) + SubSlots.GetAllocatedSize());
+
 	// Create dynamic material for color changes
 	if (TileMesh && TileMesh->GetMaterial(0))
 	{
@@ -57,46 +62,62 @@ void ATile::BeginPlay()
 	UpdateVisuals();
 }
 
+void ATile::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	DEC_DWORD_STAT(STAT_LairLiveTiles);
+	DEC_MEMORY_STAT_BY(STAT_LairTileMemory, sizeof(ATile) + SubSlots.GetAllocatedSize());
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void ATile::Initialize(FIntPoint InGridCoord, FName InTileTypeID)
 {
 	GridCoord = InGridCoord;
 	TileTypeID = InTileTypeID;
 
-	UE_LOG(LogTemp, Verbose, TEXT("ATile::Initialize - Tile at (%d, %d) type: %s"),
+	UE_LOG(LogLairBoard, Verbose, TEXT("ATile::Initialize - Tile at (%d, %d) type: %s"),
 		GridCoord.X, GridCoord.Y, *TileTypeID.ToString());
 }
 
 bool ATile::CanPlaceUnit(int32 SubSlotSize) const
+{
+	return CanFitSubSlots(GetFreeSubSlotMask(), SubSlotSize);
+}
+
+uint8 ATile::GetFreeSubSlotMask() const
+{
+	uint8 Mask = 0;
+	for (int32 i = 0; i < SubSlots.Num(); ++i)
+	{
+		if (SubSlots[i] == nullptr)
+		{
+			Mask |= static_cast<uint8>(1 << i);
+		}
+	}
+	return Mask;
+}
+
+bool ATile::CanFitSubSlots(uint8 FreeMask, int32 SubSlotSize)
 {
 	if (SubSlotSize <= 0 || SubSlotSize > LairConstants::TILE_SUB_SLOTS)
 	{
 		return false;
 	}
 
-	int32 AvailableSlots = GetAvailableSubSlots();
-
 	// For size 1 units, just need any empty slot
 	if (SubSlotSize == 1)
 	{
-		return AvailableSlots >= 1;
+		return FreeMask != 0;
 	}
 
-	// For wagons (size 2), need 2 contiguous empty slots
+	// For wagons (size 2), need 2 contiguous empty slots: (0,1), (1,2), (2,3)
 	if (SubSlotSize == 2)
 	{
-		// Check for contiguous pairs: (0,1), (1,2), (2,3)
-		for (int32 i = 0; i < LairConstants::TILE_SUB_SLOTS - 1; ++i)
-		{
-			if (SubSlots[i] == nullptr && SubSlots[i + 1] == nullptr)
-			{
-				return true;
-			}
-		}
-		return false;
+		return (FreeMask & (FreeMask >> 1)) != 0;
 	}
 
 	// For larger sizes (future-proofing)
-	return AvailableSlots >= SubSlotSize;
+	return static_cast<int32>(FMath::CountBits(FreeMask)) >= SubSlotSize;
 }
 
 int32 ATile::GetAvailableSubSlots() const
@@ -116,19 +137,19 @@ bool ATile::PlaceUnitInSubSlot(AUnit* Unit, int32 SubSlotIndex)
 {
 	if (!Unit)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ATile::PlaceUnitInSubSlot - Unit is null"));
+		UE_LOG(LogLairBoard, Warning, TEXT("ATile::PlaceUnitInSubSlot - Unit is null"));
 		return false;
 	}
 
 	if (SubSlotIndex < 0 || SubSlotIndex >= SubSlots.Num())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ATile::PlaceUnitInSubSlot - Invalid SubSlotIndex %d"), SubSlotIndex);
+		UE_LOG(LogLairBoard, Warning, TEXT("ATile::PlaceUnitInSubSlot - Invalid SubSlotIndex %d"), SubSlotIndex);
 		return false;
 	}
 
 	if (SubSlots[SubSlotIndex] != nullptr)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ATile::PlaceUnitInSubSlot - SubSlot %d is already occupied"), SubSlotIndex);
+		UE_LOG(LogLairBoard, Warning, TEXT("ATile::PlaceUnitInSubSlot - SubSlot %d is already occupied"), SubSlotIndex);
 		return false;
 	}
 
@@ -140,12 +161,12 @@ bool ATile::PlaceUnitInSubSlot(AUnit* Unit, int32 SubSlotIndex)
 	{
 		if (SubSlotIndex >= SubSlots.Num() - 1)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("ATile::PlaceUnitInSubSlot - Cannot place size 2 unit at slot %d"), SubSlotIndex);
+			UE_LOG(LogLairBoard, Warning, TEXT("ATile::PlaceUnitInSubSlot - Cannot place size 2 unit at slot %d"), SubSlotIndex);
 			return false;
 		}
 		if (SubSlots[SubSlotIndex + 1] != nullptr)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("ATile::PlaceUnitInSubSlot - SubSlot %d is already occupied (wagon needs 2 slots)"), SubSlotIndex + 1);
+			UE_LOG(LogLairBoard, Warning, TEXT("ATile::PlaceUnitInSubSlot - SubSlot %d is already occupied (wagon needs 2 slots)"), SubSlotIndex + 1);
 			return false;
 		}
 		// Occupy both slots for wagon
@@ -168,7 +189,7 @@ bool ATile::PlaceUnitInSubSlot(AUnit* Unit, int32 SubSlotIndex)
 	UnitPosition.Z += 50.0f; // Raise unit above tile
 	Unit->SetActorLocation(UnitPosition);
 
-	UE_LOG(LogTemp, Verbose, TEXT("ATile::PlaceUnitInSubSlot - Placed unit (size %d) in slot %d at tile (%d, %d)"),
+	UE_LOG(LogLairBoard, Verbose, TEXT("ATile::PlaceUnitInSubSlot - Placed unit (size %d) in slot %d at tile (%d, %d)"),
 		UnitSize, SubSlotIndex, GridCoord.X, GridCoord.Y);
 
 	return true;
@@ -188,7 +209,7 @@ bool ATile::RemoveUnitFromSubSlot(AUnit* Unit)
 		if (SubSlots[i] == Unit)
 		{
 			SubSlots[i] = nullptr;
-			UE_LOG(LogTemp, Verbose, TEXT("ATile::RemoveUnitFromSubSlot - Removed unit from slot %d at tile (%d, %d)"),
+			UE_LOG(LogLairBoard, Verbose, TEXT("ATile::RemoveUnitFromSubSlot - Removed unit from slot %d at tile (%d, %d)"),
 				i, GridCoord.X, GridCoord.Y);
 			bFound = true;
 		}
@@ -196,7 +217,7 @@ bool ATile::RemoveUnitFromSubSlot(AUnit* Unit)
 
 	if (!bFound)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ATile::RemoveUnitFromSubSlot - Unit not found on this tile"));
+		UE_LOG(LogLairBoard, Warning, TEXT("ATile::RemoveUnitFromSubSlot - Unit not found on this tile"));
 	}
 	return bFound;
 }
@@ -249,6 +270,8 @@ void ATile::SetHighlight(bool bHighlighted, FLinearColor Color)
 
 void ATile::UpdateVisuals()
 {
+	SCOPE_CYCLE_COUNTER(STAT_LairTileVisuals);
+
 	// Priority: PlayerBase color > TileType DebugColor > White default
 	if (PlayerBaseIndex == 0)
 	{
@@ -258,10 +281,10 @@ void ATile::UpdateVisuals()
 	{
 		SetTileColor(FLinearColor(1.0f, 0.0f, 0.0f, 1.0f)); // Red for P2
 	}
-	else if (CachedTileTypeData.DebugColor != FLinearColor::White)
+	else if (GetTileTypeData().DebugColor != FLinearColor::White)
 	{
 		// Use tile type debug color if set (non-white)
-		SetTileColor(CachedTileTypeData.DebugColor);
+		SetTileColor(GetTileTypeData().DebugColor);
 	}
 	else
 	{
@@ -269,12 +292,18 @@ void ATile::UpdateVisuals()
 	}
 }
 
-void ATile::SetTileTypeData(const FTileTypeData& InTileTypeData)
+void ATile::SetTileTypeData(const FTileTypeData* InTileTypeData)
 {
-	CachedTileTypeData = InTileTypeData;
+	TileTypeData = InTileTypeData;
 	UpdateVisuals();
 }
 
+const FTileTypeData& ATile::GetTileTypeData() const
+{
+	static const FTileTypeData DefaultTileTypeData;
+	return TileTypeData ? *TileTypeData : DefaultTileTypeData;
+}
+
 int32 ATile::FindAvailableSubSlot(int32 SubSlotSize) const
 {
 	if (SubSlotSize == 2)
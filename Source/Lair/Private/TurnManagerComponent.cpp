@@ -2,6 +2,8 @@
 // Step 7: Turn Manager Component (Phase Sequencing)
 
 #include "TurnManagerComponent.h"
+#include "LairLog.h"
+#include "LairTrace.h"
 
 UTurnManagerComponent::UTurnManagerComponent()
 {
@@ -19,16 +21,26 @@ void UTurnManagerComponent::StartFirstTurn()
 	TurnNumber = 1;
 	SetPhase(ETurnPhase::Purchase);
 
-	UE_LOG(LogTemp, Log, TEXT("UTurnManagerComponent::StartFirstTurn - Turn %d, Player %d, Phase: Purchase"),
+	UE_LOG(LogLairTurn, Log, TEXT("UTurnManagerComponent::StartFirstTurn - Turn %d, Player %d, Phase: Purchase"),
 		TurnNumber, CurrentPlayerIndex);
 
 	// Broadcast initial state
-	OnPlayerChanged.Broadcast(CurrentPlayerIndex);
-	OnTurnChanged.Broadcast(TurnNumber);
+	if (EventBus)
+	{
+		EventBus->Post(ELairEventType::PlayerChanged, INDEX_NONE, CurrentPlayerIndex, CurrentPlayerIndex);
+		EventBus->Post(ELairEventType::TurnChanged, INDEX_NONE, 0, TurnNumber);
+	}
+	else
+	{
+		OnPlayerChanged.Broadcast(CurrentPlayerIndex);
+		OnTurnChanged.Broadcast(TurnNumber);
+	}
 }
 
 void UTurnManagerComponent::AdvancePhase()
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnManagerComponent::AdvancePhase);
+
 	ETurnPhase OldPhase = CurrentPhase;
 
 	switch (CurrentPhase)
@@ -58,13 +70,13 @@ void UTurnManagerComponent::AdvancePhase()
 		break;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("UTurnManagerComponent::AdvancePhase - Phase changed from %d to %d"),
+	UE_LOG(LogLairTurn, Log, TEXT("UTurnManagerComponent::AdvancePhase - Phase changed from %d to %d"),
 		static_cast<int32>(OldPhase), static_cast<int32>(CurrentPhase));
 }
 
 void UTurnManagerComponent::EndTurn()
 {
-	UE_LOG(LogTemp, Log, TEXT("UTurnManagerComponent::EndTurn - Player %d ending turn"), CurrentPlayerIndex);
+	UE_LOG(LogLairTurn, Log, TEXT("UTurnManagerComponent::EndTurn - Player %d ending turn"), CurrentPlayerIndex);
 
 	// Advance to next player
 	AdvancePlayer();
@@ -73,15 +85,55 @@ void UTurnManagerComponent::EndTurn()
 	SetPhase(ETurnPhase::Purchase);
 }
 
+void UTurnManagerComponent::RestoreTurnState(int32 InPlayerIndex, ETurnPhase InPhase, int32 InTurnNumber)
+{
+	const int32 OldPlayerIndex = CurrentPlayerIndex;
+	const int32 OldTurnNumber = TurnNumber;
+
+	CurrentPlayerIndex = FMath::Clamp(InPlayerIndex, 0, FMath::Max(TotalPlayers - 1, 0));
+	TurnNumber = FMath::Max(InTurnNumber, 1);
+	SetPhase(InPhase);
+
+	UE_LOG(LogLairTurn, Log, TEXT("UTurnManagerComponent::RestoreTurnState - Turn %d, Player %d, Phase %d"),
+		TurnNumber, CurrentPlayerIndex, static_cast<int32>(CurrentPhase));
+
+	// Always announce the player, like StartFirstTurn, so per-turn listeners re-run
+	if (EventBus)
+	{
+		EventBus->Post(ELairEventType::PlayerChanged, INDEX_NONE, OldPlayerIndex, CurrentPlayerIndex);
+		if (TurnNumber != OldTurnNumber)
+		{
+			EventBus->Post(ELairEventType::TurnChanged, INDEX_NONE, OldTurnNumber, TurnNumber);
+		}
+	}
+	else
+	{
+		OnPlayerChanged.Broadcast(CurrentPlayerIndex);
+		if (TurnNumber != OldTurnNumber)
+		{
+			OnTurnChanged.Broadcast(TurnNumber);
+		}
+	}
+}
+
 void UTurnManagerComponent::SetPhase(ETurnPhase NewPhase)
 {
 	ETurnPhase OldPhase = CurrentPhase;
 	CurrentPhase = NewPhase;
 
-	UE_LOG(LogTemp, Verbose, TEXT("UTurnManagerComponent::SetPhase - Phase: %d -> %d"),
+	UE_LOG(LogLairTurn, Verbose, TEXT("UTurnManagerComponent::SetPhase - Phase: %d -> %d"),
+		static_cast<int32>(OldPhase), static_cast<int32>(CurrentPhase));
+	LAIR_TRACE_MARKER(TEXT("Lair: Player %d phase %d -> %d"), CurrentPlayerIndex,
 		static_cast<int32>(OldPhase), static_cast<int32>(CurrentPhase));
 
-	OnPhaseChanged.Broadcast(CurrentPhase);
+	if (EventBus)
+	{
+		EventBus->Post(ELairEventType::PhaseChanged, INDEX_NONE, static_cast<int32>(OldPhase), static_cast<int32>(CurrentPhase));
+	}
+	else
+	{
+		OnPhaseChanged.Broadcast(CurrentPhase);
+	}
 }
 
 void UTurnManagerComponent::AdvancePlayer()
@@ -95,12 +147,75 @@ void UTurnManagerComponent::AdvancePlayer()
 	if (CurrentPlayerIndex == 0)
 	{
 		TurnNumber++;
-		OnTurnChanged.Broadcast(TurnNumber);
-		UE_LOG(LogTemp, Log, TEXT("UTurnManagerComponent::AdvancePlayer - New turn %d"), TurnNumber);
+		if (EventBus)
+		{
+			EventBus->Post(ELairEventType::TurnChanged, INDEX_NONE, TurnNumber - 1, TurnNumber);
+		}
+		else
+		{
+			OnTurnChanged.Broadcast(TurnNumber);
+		}
+		UE_LOG(LogLairTurn, Log, TEXT("UTurnManagerComponent::AdvancePlayer - New turn %d"), TurnNumber);
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("UTurnManagerComponent::AdvancePlayer - Player %d -> %d"),
+	UE_LOG(LogLairTurn, Log, TEXT("UTurnManagerComponent::AdvancePlayer - Player %d -> %d"),
 		OldPlayerIndex, CurrentPlayerIndex);
 
-	OnPlayerChanged.Broadcast(CurrentPlayerIndex);
+	if (EventBus)
+	{
+		EventBus->Post(ELairEventType::PlayerChanged, INDEX_NONE, OldPlayerIndex, CurrentPlayerIndex);
+	}
+	else
+	{
+		OnPlayerChanged.Broadcast(CurrentPlayerIndex);
+	}
+}
+
+void UTurnManagerComponent::SetEventBus(FLairEventBus* InEventBus)
+{
+	if (EventBus)
+	{
+		EventBus->On(ELairEventType::PhaseChanged, ELairEventListener::Presentation).RemoveAll(this);
+		EventBus->On(ELairEventType::PlayerChanged, ELairEventListener::Presentation).RemoveAll(this);
+		EventBus->On(ELairEventType::TurnChanged, ELairEventListener::Presentation).RemoveAll(this);
+	}
+
+	EventBus = InEventBus;
+
+	if (EventBus)
+	{
+		EventBus->On(ELairEventType::PhaseChanged, ELairEventListener::Presentation).AddUObject(this, &UTurnManagerComponent::ForwardEventToDelegates);
+		EventBus->On(ELairEventType::PlayerChanged, ELairEventListener::Presentation).AddUObject(this, &UTurnManagerComponent::ForwardEventToDelegates);
+		EventBus->On(ELairEventType::TurnChanged, ELairEventListener::Presentation).AddUObject(this, &UTurnManagerComponent::ForwardEventToDelegates);
+	}
+}
+
+void UTurnManagerComponent::ForwardEventToDelegates(const FLairEvent& Event)
+{
+	switch (Event.Type)
+	{
+	case ELairEventType::PhaseChanged:
+		if (OnPhaseChanged.IsBound())
+		{
+			OnPhaseChanged.Broadcast(static_cast<ETurnPhase>(Event.NewValue));
+		}
+		break;
+
+	case ELairEventType::PlayerChanged:
+		if (OnPlayerChanged.IsBound())
+		{
+			OnPlayerChanged.Broadcast(Event.NewValue);
+		}
+		break;
+
+	case ELairEventType::TurnChanged:
+		if (OnTurnChanged.IsBound())
+		{
+			OnTurnChanged.Broadcast(Event.NewValue);
+		}
+		break;
+
+	default:
+		break;
+	}
 }
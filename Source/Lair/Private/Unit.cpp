@@ -2,6 +2,9 @@
 // Step 4: Unit Actor (Game Pieces)
 
 #include "Unit.h"
+#include "LairLog.h"
+#include "LairMemory.h"
+#include "LairStats.h"
 #include "Tile.h"
 #include "Components/StaticMeshComponent.h"
 #include "Materials/MaterialInstanceDynamic.h"
@@ -47,6 +50,10 @@ void AUnit::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// Type rows are shared and counted with the rules cache
+	INC_DWORD_STAT(STAT_LairLiveUnits);
+	INC_MEMORY_STAT_BY(STAT_LairUnitMemory, sizeof(AUnit));
+
 	// Create dynamic material for color changes
 	if (UnitMesh && UnitMesh->GetMaterial(0))
 	{
@@ -56,17 +63,48 @@ void AUnit::BeginPlay()
 	UpdateVisuals();
 }
 
+void AUnit::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	DEC_DWORD_STAT(STAT_LairLiveUnits);
+	DEC_MEMORY_STAT_BY(STAT_LairUnitMemory, sizeof(AUnit));
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void AUnit::InitializeFromDataTable(FName InUnitTypeID, const FUnitData& Data)
 {
+	LLM_SCOPE_BYTAG(Lair_Units);
+
+	// The caller's struct may not outlive the unit, so keep a private copy
+	OwnedTypeData = MakeUnique<FUnitData>(Data);
+	InitializeFromTypeData(InUnitTypeID, OwnedTypeData.Get());
+}
+
+void AUnit::InitializeFromTypeData(FName InUnitTypeID, const FUnitData* InTypeData)
+{
+	if (InTypeData != OwnedTypeData.Get())
+	{
+		OwnedTypeData.Reset();
+	}
+
 	UnitTypeID = InUnitTypeID;
-	CachedUnitData = Data;
+	TypeData = InTypeData;
+	const FUnitData& Data = GetUnitTypeData();
 
 	// Initialize stats
 	CurrentHP = Data.HitPoints;
 	RemainingMovement = Data.MovementPoints;
 
+	RefreshTypeData();
+
+	UE_LOG(LogLairBoard, Verbose, TEXT("AUnit::InitializeFromTypeData - Initialized %s (Cost: %d, Movement: %d, HP: %d, Size: %d)"),
+		*InUnitTypeID.ToString(), Data.Cost, Data.MovementPoints, Data.HitPoints, Data.SubSlotSize);
+}
+
+void AUnit::RefreshTypeData()
+{
 	// Adjust scale based on unit type
-	if (Data.SubSlotSize == 2)
+	if (GetUnitTypeData().SubSlotSize == 2)
 	{
 		// Wagon is wider
 		UnitMesh->SetRelativeScale3D(FVector(0.35f, 0.25f, 0.25f));
@@ -78,15 +116,18 @@ void AUnit::InitializeFromDataTable(FName InUnitTypeID, const FUnitData& Data)
 	}
 
 	UpdateVisuals();
+}
 
-	UE_LOG(LogTemp, Log, TEXT("AUnit::InitializeFromDataTable - Initialized %s (Cost: %d, Movement: %d, HP: %d, Size: %d)"),
-		*InUnitTypeID.ToString(), Data.Cost, Data.MovementPoints, Data.HitPoints, Data.SubSlotSize);
+const FUnitData& AUnit::GetUnitTypeData() const
+{
+	static const FUnitData DefaultTypeData;
+	return TypeData ? *TypeData : DefaultTypeData;
 }
 
 void AUnit::ResetMovement()
 {
-	RemainingMovement = CachedUnitData.MovementPoints;
-	UE_LOG(LogTemp, Verbose, TEXT("AUnit::ResetMovement - Reset movement to %d"), RemainingMovement);
+	RemainingMovement = GetUnitTypeData().MovementPoints;
+	UE_LOG(LogLairBoard, Verbose, TEXT("AUnit::ResetMovement - Reset movement to %d"), RemainingMovement);
 }
 
 void AUnit::SetCurrentTile(ATile* NewTile, int32 InSubSlotIndex)
@@ -96,7 +137,7 @@ void AUnit::SetCurrentTile(ATile* NewTile, int32 InSubSlotIndex)
 
 	if (CurrentTile)
 	{
-		UE_LOG(LogTemp, Verbose, TEXT("AUnit::SetCurrentTile - Unit now at tile (%d, %d) sub-slot %d"),
+		UE_LOG(LogLairBoard, Verbose, TEXT("AUnit::SetCurrentTile - Unit now at tile (%d, %d) sub-slot %d"),
 			CurrentTile->GridCoord.X, CurrentTile->GridCoord.Y, SubSlotIndex);
 	}
 }
@@ -139,6 +180,8 @@ void AUnit::SetUnitColor(FLinearColor Color)
 
 void AUnit::UpdateVisuals()
 {
+	SCOPE_CYCLE_COUNTER(STAT_LairUnitVisuals);
+
 	// Set color based on owner
 	if (OwnerPlayerIndex == 0)
 	{
@@ -0,0 +1,209 @@
+// VictoryManagerComponent.cpp
+// Victory Manager Component (Incremental Victory Tracking)
+
+#include "VictoryManagerComponent.h"
+#include "LairLog.h"
+#include "LairPlayerState.h"
+#include "Engine/DataTable.h"
+
+namespace
+{
+	/** Dirty bits are stored in a uint32 */
+	constexpr int32 MAX_TRACKED_PLAYERS = 32;
+}
+
+UVictoryManagerComponent::UVictoryManagerComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+
+	VictoryConditionsDataTable = nullptr;
+	NumEliminated = 0;
+	DirtyPlayerMask = 0;
+	WinnerIndex = INDEX_NONE;
+}
+
+void UVictoryManagerComponent::Initialize(UDataTable* InVictoryConditionsTable, int32 NumPlayers)
+{
+	VictoryConditionsDataTable = InVictoryConditionsTable;
+
+	Counters.Reset();
+	Counters.SetNum(FMath::Clamp(NumPlayers, 0, MAX_TRACKED_PLAYERS));
+	NumEliminated = 0;
+	DirtyPlayerMask = 0;
+	WinnerIndex = INDEX_NONE;
+
+	CompileConditions();
+
+	UE_LOG(LogLairTurn, Log, TEXT("UVictoryManagerComponent::Initialize - Tracking %d players against %d conditions"),
+		Counters.Num(), Conditions.Num());
+}
+
+void UVictoryManagerComponent::CompileConditions()
+{
+	Conditions.Reset();
+
+	if (VictoryConditionsDataTable)
+	{
+		TArray<FName> RowNames = VictoryConditionsDataTable->GetRowNames();
+		for (const FName& RowName : RowNames)
+		{
+			FVictoryConditionData* Row = VictoryConditionsDataTable->FindRow<FVictoryConditionData>(RowName, TEXT("CompileConditions"));
+			if (!Row || !Row->bEnabled)
+			{
+				continue;
+			}
+
+			FCompiledCondition& Condition = Conditions.AddDefaulted_GetRef();
+			Condition.ConditionID = RowName;
+			Condition.Type = Row->VictoryType;
+			Condition.Threshold = Row->GoldRequired;
+		}
+	}
+	else
+	{
+		// Phase 1 conditions from the Technical Specification sample data
+		Conditions.Add({ FName("GoldVictory"), EVictoryType::GoldThreshold, 3000 });
+		Conditions.Add({ FName("EliminationVictory"), EVictoryType::Elimination, 0 });
+
+		UE_LOG(LogLairTurn, Log, TEXT("UVictoryManagerComponent::CompileConditions - Created default victory conditions"));
+	}
+}
+
+void UVictoryManagerComponent::RegisterPlayerState(ALairPlayerState* PlayerState)
+{
+	if (!PlayerState || !Counters.IsValidIndex(PlayerState->PlayerIndex))
+	{
+		UE_LOG(LogLairTurn, Warning, TEXT("UVictoryManagerComponent::RegisterPlayerState - Invalid player state"));
+		return;
+	}
+
+	const int32 PlayerIndex = PlayerState->PlayerIndex;
+	Counters[PlayerIndex].Gold = PlayerState->GetGold();
+	SetUnitCount(PlayerIndex, PlayerState->GetNumOwnedUnits());
+	MarkDirty(PlayerIndex);
+
+	PlayerState->OnGoldChangedNative.RemoveAll(this);
+	PlayerState->OnGoldChangedNative.AddUObject(this, &UVictoryManagerComponent::HandleGoldChanged);
+	PlayerState->OnOwnedUnitsChangedNative.RemoveAll(this);
+	PlayerState->OnOwnedUnitsChangedNative.AddUObject(this, &UVictoryManagerComponent::HandleOwnedUnitsChanged);
+}
+
+void UVictoryManagerComponent::HandleGoldChanged(ALairPlayerState* PlayerState, int32 OldGold, int32 NewGold)
+{
+	if (PlayerState && Counters.IsValidIndex(PlayerState->PlayerIndex))
+	{
+		Counters[PlayerState->PlayerIndex].Gold = NewGold;
+		MarkDirty(PlayerState->PlayerIndex);
+	}
+}
+
+void UVictoryManagerComponent::HandleOwnedUnitsChanged(ALairPlayerState* PlayerState, int32 NumOwnedUnits)
+{
+	if (PlayerState && Counters.IsValidIndex(PlayerState->PlayerIndex))
+	{
+		SetUnitCount(PlayerState->PlayerIndex, NumOwnedUnits);
+	}
+}
+
+void UVictoryManagerComponent::SetUnitCount(int32 PlayerIndex, int32 NewUnitCount)
+{
+	FPlayerVictoryCounters& PlayerCounters = Counters[PlayerIndex];
+
+	const bool bWasEliminated = PlayerCounters.IsEliminated();
+	PlayerCounters.Units = NewUnitCount;
+	PlayerCounters.PeakUnits = FMath::Max(PlayerCounters.PeakUnits, NewUnitCount);
+	const bool bIsEliminated = PlayerCounters.IsEliminated();
+
+	if (bWasEliminated != bIsEliminated)
+	{
+		NumEliminated += bIsEliminated ? 1 : -1;
+
+		// Elimination changes the outcome for every surviving player
+		DirtyPlayerMask = (Counters.Num() >= MAX_TRACKED_PLAYERS) ? MAX_uint32 : ((1u << Counters.Num()) - 1);
+	}
+	else
+	{
+		MarkDirty(PlayerIndex);
+	}
+}
+
+int32 UVictoryManagerComponent::FindMetCondition(int32 PlayerIndex) const
+{
+	const FPlayerVictoryCounters& PlayerCounters = Counters[PlayerIndex];
+
+	for (int32 i = 0; i < Conditions.Num(); ++i)
+	{
+		const FCompiledCondition& Condition = Conditions[i];
+
+		bool bMet = false;
+		switch (Condition.Type)
+		{
+		case EVictoryType::GoldThreshold:
+			bMet = PlayerCounters.Gold >= Condition.Threshold;
+			break;
+
+		case EVictoryType::Elimination:
+			bMet = !PlayerCounters.IsEliminated() && Counters.Num() > 1 && NumEliminated == Counters.Num() - 1;
+			break;
+
+		default:
+			break;
+		}
+
+		if (bMet)
+		{
+			return i;
+		}
+	}
+
+	return INDEX_NONE;
+}
+
+bool UVictoryManagerComponent::HasPlayerWon(int32 PlayerIndex) const
+{
+	return Counters.IsValidIndex(PlayerIndex) && FindMetCondition(PlayerIndex) != INDEX_NONE;
+}
+
+int32 UVictoryManagerComponent::CheckVictoryConditions()
+{
+	if (WinnerIndex != INDEX_NONE || DirtyPlayerMask == 0)
+	{
+		return WinnerIndex;
+	}
+
+	for (int32 PlayerIndex = 0; PlayerIndex < Counters.Num(); ++PlayerIndex)
+	{
+		if (!(DirtyPlayerMask & (1u << PlayerIndex)))
+		{
+			continue;
+		}
+
+		const int32 ConditionIndex = FindMetCondition(PlayerIndex);
+		if (ConditionIndex != INDEX_NONE)
+		{
+			WinnerIndex = PlayerIndex;
+			DirtyPlayerMask = 0;
+
+			UE_LOG(LogLairTurn, Log, TEXT("UVictoryManagerComponent::CheckVictoryConditions - Player %d wins (%s)"),
+				PlayerIndex, *Conditions[ConditionIndex].ConditionID.ToString());
+
+			OnPlayerWon.Broadcast(PlayerIndex, Conditions[ConditionIndex].ConditionID);
+			return WinnerIndex;
+		}
+	}
+
+	DirtyPlayerMask = 0;
+	return INDEX_NONE;
+}
+
+FPlayerVictoryCounters UVictoryManagerComponent::GetPlayerCounters(int32 PlayerIndex) const
+{
+	return Counters.IsValidIndex(PlayerIndex) ? Counters[PlayerIndex] : FPlayerVictoryCounters();
+}
+
+int32 UVictoryManagerComponent::GetConditionThreshold(EVictoryType Type) const
+{
+	const FCompiledCondition* Condition = Conditions.FindByPredicate(
+		[Type](const FCompiledCondition& Candidate) { return Candidate.Type == Type; });
+	return Condition ? Condition->Threshold : 0;
+}
@@ -12,6 +12,7 @@
 // Forward declarations
 class ATile;
 class AUnit;
+class URulesEngineComponent;
 
 /**
  * Component that manages the game board grid.
@@ -21,6 +22,7 @@ class AUnit;
  * - Provide tile lookup by coordinate
  * - Calculate movement costs between tiles
  * - Identify neighboring tiles
+ * - Own the packed per-tile property flags used by rule and pathing queries
  */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class LAIR_API UBoardSystemComponent : public UActorComponent
@@ -45,6 +47,12 @@ public:
 	/** Set the tile types data table */
 	void SetTileTypesDataTable(UDataTable* InDataTable) { TileTypesDataTable = InDataTable; }
 
+	/** Set the rules engine whose compiled rows tiles share (falls back to the data table) */
+	void SetRulesEngine(URulesEngineComponent* InRulesEngine) { RulesEngine = InRulesEngine; }
+
+	/** Set the size of the generated board used when there is no layout table */
+	void SetDefaultBoardSize(FIntPoint InBoardSize) { DefaultBoardSize = InBoardSize; }
+
 	// ========================================================================
 	// Stable API - DO NOT MODIFY SIGNATURES
 	// ========================================================================
@@ -108,6 +116,56 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Board")
 	FIntPoint GetBoardSize() const { return BoardSize; }
 
+	// ========================================================================
+	// Tile Properties (packed per-tile flags)
+	// ========================================================================
+
+	/**
+	 * Convert a coordinate to a tile index (row-major, same as FLairMatchRules).
+	 * @param Coord - Grid coordinate
+	 * @return Tile index, or INDEX_NONE if out of bounds
+	 */
+	int32 GetTileIndex(FIntPoint Coord) const
+	{
+		return IsValidGridCoord(Coord) ? Coord.Y * BoardSize.X + Coord.X : INDEX_NONE;
+	}
+
+	/**
+	 * Get the packed properties of a tile (ELairTileFlags plus base index).
+	 * @param Coord - Grid coordinate
+	 * @return Packed byte, or ELairTileFlags::None if out of bounds or not spawned
+	 */
+	uint8 GetTileFlags(FIntPoint Coord) const
+	{
+		const int32 TileIndex = GetTileIndex(Coord);
+		return TileFlags.IsValidIndex(TileIndex) ? TileFlags[TileIndex] : static_cast<uint8>(ELairTileFlags::None);
+	}
+
+	/** Check a terrain flag of a tile */
+	bool HasTileFlag(FIntPoint Coord, ELairTileFlags::Type Flag) const { return (GetTileFlags(Coord) & Flag) != 0; }
+
+	/** Check if units can move onto a tile */
+	bool IsTileWalkable(FIntPoint Coord) const { return HasTileFlag(Coord, ELairTileFlags::Walkable); }
+
+	/** Player whose base a tile is (-1 if none) */
+	int32 GetTileBaseIndex(FIntPoint Coord) const { return ELairTileFlags::GetBaseIndex(GetTileFlags(Coord)); }
+
+	/** Packed flags of every tile, indexed by GetTileIndex (for pathing loops) */
+	const TArray<uint8>& GetTileFlagsArray() const { return TileFlags; }
+
+	/**
+	 * Change a tile's type, keeping its packed flags in sync.
+	 * @param Tile - Tile on this board
+	 * @param TileTypeID - Row name from DT_TileTypes
+	 */
+	void SetTileType(ATile* Tile, FName TileTypeID);
+
+	/**
+	 * Re-resolve every tile of the given types in one pass (after their rows were edited).
+	 * @param TileTypeIDs - Changed tile types
+	 */
+	void RefreshTileTypes(const TArray<FName>& TileTypeIDs);
+
 protected:
 	/** Grid storage (maps coordinate to tile) */
 	UPROPERTY()
@@ -117,6 +175,10 @@ protected:
 	UPROPERTY()
 	FIntPoint BoardSize;
 
+	/** Dimensions of the generated board */
+	UPROPERTY()
+	FIntPoint DefaultBoardSize;
+
 	/** Tile class to spawn */
 	UPROPERTY()
 	TSubclassOf<ATile> TileClass;
@@ -129,10 +191,23 @@ protected:
 	UPROPERTY()
 	UDataTable* TileTypesDataTable;
 
+	/** Rules engine owning the shared tile type rows */
+	UPROPERTY()
+	URulesEngineComponent* RulesEngine = nullptr;
+
 	/** Player base coordinates */
 	UPROPERTY()
 	TArray<FIntPoint> PlayerBaseCoords;
 
+	/** Packed ELairTileFlags and base index per tile, resolved once at spawn */
+	TArray<uint8> TileFlags;
+
+	/** Shared tile type row (nullptr if there is no table or row) */
+	const FTileTypeData* FindTileTypeData(FName TileTypeID) const;
+
+	/** Point a tile at its type row and re-pack its flags */
+	void ApplyTileType(ATile* Tile);
+
 	/** Spawn a tile at the given coordinate */
 	ATile* SpawnTile(FIntPoint Coord, FName TileTypeID, int32 PlayerBaseIndex);
 
@@ -0,0 +1,172 @@
+// CombatOddsComponent.h
+// Combat Odds Service (Exact Outcome Distributions)
+// Computes exact attacker/defender outcome odds for UI hover and AI evaluation.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "LairDataStructs.h"
+#include "CombatOddsComponent.generated.h"
+
+// Forward declarations
+class AUnit;
+
+/**
+ * Exact outcome distribution for one attacker/defender matchup.
+ */
+USTRUCT(BlueprintType)
+struct FCombatOdds
+{
+	GENERATED_BODY()
+
+	/** Probability the attacker eliminates the defender and survives */
+	UPROPERTY(BlueprintReadOnly, Category = "Combat")
+	float AttackerWinProbability = 0.0f;
+
+	/** Probability the defender eliminates the attacker and survives */
+	UPROPERTY(BlueprintReadOnly, Category = "Combat")
+	float DefenderWinProbability = 0.0f;
+
+	/** Probability both stacks are eliminated in the same round */
+	UPROPERTY(BlueprintReadOnly, Category = "Combat")
+	float MutualDestructionProbability = 0.0f;
+
+	/** Probability neither side can ever score a hit (e.g. Phase 1 units with no dice values) */
+	UPROPERTY(BlueprintReadOnly, Category = "Combat")
+	float StalemateProbability = 0.0f;
+
+	/** Expected number of attacking units alive when combat ends */
+	UPROPERTY(BlueprintReadOnly, Category = "Combat")
+	float ExpectedAttackerSurvivors = 0.0f;
+
+	/** Expected number of defending units alive when combat ends */
+	UPROPERTY(BlueprintReadOnly, Category = "Combat")
+	float ExpectedDefenderSurvivors = 0.0f;
+
+	/** Probability of each remaining attacker HP total when combat ends (index = HP) */
+	UPROPERTY(BlueprintReadOnly, Category = "Combat")
+	TArray<float> AttackerRemainingHP;
+
+	/** Probability of each remaining defender HP total when combat ends (index = HP) */
+	UPROPERTY(BlueprintReadOnly, Category = "Combat")
+	TArray<float> DefenderRemainingHP;
+};
+
+/**
+ * Combat-relevant stats of one unit, independent of any actor.
+ * Used by the odds calculator so AI code can evaluate hypothetical stacks.
+ */
+struct LAIR_API FCombatantProfile
+{
+	/** Hit points still remaining */
+	int32 HitPoints = 1;
+
+	/** Dice rolled per combat round */
+	int32 NumberOfDice = 1;
+
+	/** Bit N set means die face N+1 scores a hit */
+	uint8 HitFaceMask = 0;
+
+	/** Build a profile from unit type data */
+	static FCombatantProfile FromUnitData(const FUnitData& Data, int32 CurrentHP);
+
+	/** Build a profile from a live unit */
+	static FCombatantProfile FromUnit(const AUnit* Unit);
+
+	/** Convert DT_Units AttackDiceValues (e.g. [4,5,6]) to a face mask */
+	static uint8 MakeHitFaceMask(const TArray<int32>& AttackDiceValues);
+
+	/** Chance that a single die scores a hit */
+	float GetHitProbability() const;
+};
+
+/**
+ * Component that calculates exact combat odds between two stacks.
+ *
+ * Combat model (Phase 2 rules as specified for UCombatResolverComponent):
+ * - Both stacks roll simultaneously each round
+ * - Every living unit rolls NumberOfDice d6; a die hits on any face in AttackDiceValues
+ * - Each hit removes 1 HP from the opposing stack
+ * - Casualties are taken weakest unit first (fewest expected hits, then fewest HP)
+ * - Combat ends when either stack has no HP left
+ *
+ * The distribution is solved by dynamic programming over (attacker HP, defender HP)
+ * and memoized by a canonical stack signature, so repeated hover queries are a map lookup.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class LAIR_API UCombatOddsComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UCombatOddsComponent();
+
+	/**
+	 * Calculate exact outcome odds for an attack.
+	 * @param Attackers - Units initiating combat
+	 * @param Defenders - Units being attacked
+	 * @return Outcome distribution (all zero if either stack is empty)
+	 */
+	UFUNCTION(BlueprintPure, Category = "Combat")
+	FCombatOdds CalculateCombatOdds(const TArray<AUnit*>& Attackers, const TArray<AUnit*>& Defenders) const;
+
+	/**
+	 * Calculate exact outcome odds for hypothetical stacks (AI evaluation).
+	 * Safe to call from worker threads.
+	 * @param Attackers - Attacking stack profiles
+	 * @param Defenders - Defending stack profiles
+	 * @return Outcome distribution
+	 */
+	FCombatOdds CalculateOddsForProfiles(TConstArrayView<FCombatantProfile> Attackers, TConstArrayView<FCombatantProfile> Defenders) const;
+
+	/** Discard all memoized results (call after unit stats change) */
+	UFUNCTION(BlueprintCallable, Category = "Combat")
+	void ClearCache();
+
+	/** Get number of memoized matchups */
+	UFUNCTION(BlueprintPure, Category = "Combat")
+	int32 GetCachedMatchupCount() const;
+
+protected:
+	/** Maximum memoized matchups before the cache is flushed */
+	UPROPERTY(EditDefaultsOnly, Category = "Combat")
+	int32 MaxCachedMatchups = 4096;
+
+	/** Canonical key for a matchup: packed attacker profiles followed by packed defender profiles */
+	struct FStackSignature
+	{
+		TArray<uint32, TInlineAllocator<16>> Packed;
+		int32 NumAttackers = 0;
+
+		bool operator==(const FStackSignature& Other) const
+		{
+			return NumAttackers == Other.NumAttackers && Packed == Other.Packed;
+		}
+
+		friend uint32 GetTypeHash(const FStackSignature& Signature)
+		{
+			uint32 Hash = ::GetTypeHash(Signature.NumAttackers);
+			for (uint32 Value : Signature.Packed)
+			{
+				Hash = HashCombineFast(Hash, Value);
+			}
+			return Hash;
+		}
+	};
+
+	/** Memoized results */
+	mutable TMap<FStackSignature, FCombatOdds> OddsCache;
+
+	/** Guards OddsCache (UI queries on the game thread, AI queries on workers) */
+	mutable FRWLock OddsCacheLock;
+
+	/** Pack a profile into 32 bits (HP | dice << 8 | mask << 16) */
+	static uint32 PackProfile(const FCombatantProfile& Profile);
+
+	/** Sort packed profiles into casualty order (weakest first) */
+	static void SortCasualtyOrder(TArrayView<uint32> PackedProfiles);
+
+	/** Solve the outcome distribution for canonical stacks */
+	static FCombatOdds SolveOdds(TConstArrayView<uint32> Attackers, TConstArrayView<uint32> Defenders);
+};
@@ -0,0 +1,145 @@
+// LairAIComponent.h
+// AI Component (Background Turn Planning)
+// Plans AI turns on a worker task from a match state snapshot.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Tasks/Task.h"
+#include "LairMatchState.h"
+#include "LairAIComponent.generated.h"
+
+class FLairTranspositionTable;
+
+/** Native delegate for a finished AI turn (always broadcast on the game thread) */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnAITurnPlannedNative, int32 /*PlayerIndex*/, const TArray<FLairCommand>& /*Commands*/);
+
+/**
+ * Component that plans AI turns off the game thread.
+ * Responsibilities:
+ * - Decide which players are AI-controlled and with which policy
+ * - Plan a whole turn on a worker task over a copied match state
+ * - Enforce a wall-clock budget (the turn is ended when it runs out)
+ * - Cancel cooperatively on restart, quit or a newer request
+ * - Hand the planned commands back on the game thread
+ * - Own the transposition table that carries search results across turns (sized from config)
+ *
+ * The game thread never waits on the worker except in EndPlay, where cancellation
+ * makes the wait a few milliseconds at most.
+ */
+UCLASS(ClassGroup=(Custom), Config=Game, meta=(BlueprintSpawnableComponent))
+class LAIR_API ULairAIComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	ULairAIComponent();
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	// ========================================================================
+	// Configuration
+	// ========================================================================
+
+	/** Policy per player index (None = human controlled). Set in DefaultGame.ini or with ?AI= */
+	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category = "AI")
+	TArray<FName> PlayerPolicies;
+
+	/** Wall-clock budget for planning one turn (only applies when bDeterministicSearch is off) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "AI", meta = (ClampMin = "0.01"))
+	float ThinkBudgetSeconds = 2.0f;
+
+	/** Stop searches on iteration counts rather than wall time, so a seeded match plays identically on any machine */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "AI")
+	bool bDeterministicSearch = true;
+
+	/** Transposition table memory budget ([/Script/Lair.LairAIComponent] in DefaultGame.ini) */
+	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category = "AI", meta = (ClampMin = "1"))
+	int32 TranspositionTableSizeMB = 32;
+
+	// ========================================================================
+	// Public API
+	// ========================================================================
+
+	/**
+	 * Check whether a player is AI controlled.
+	 * @param PlayerIndex - Player to check
+	 * @return True if a policy is assigned to this player
+	 */
+	UFUNCTION(BlueprintPure, Category = "AI")
+	bool IsAIPlayer(int32 PlayerIndex) const;
+
+	/**
+	 * Assign a policy to a player.
+	 * @param PlayerIndex - Player to configure
+	 * @param PolicyName - Registered policy name (None = human controlled)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "AI")
+	void SetPlayerPolicy(int32 PlayerIndex, FName PolicyName);
+
+	/**
+	 * Start planning the current player's turn in the background.
+	 * Cancels any turn still being planned.
+	 * @param Snapshot - Match state to plan from (copied; the live game is never touched)
+	 * @param PolicySeed - Seed for the policy's private random stream
+	 * @return True if planning started
+	 */
+	bool StartThinking(const FLairMatchState& Snapshot, uint64 PolicySeed);
+
+	/**
+	 * Cancel the turn being planned. Its result is discarded.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "AI")
+	void CancelThinking();
+
+	/**
+	 * Check whether a turn is being planned.
+	 * @return True while a worker task is running
+	 */
+	UFUNCTION(BlueprintPure, Category = "AI")
+	bool IsThinking() const { return ActiveJob.IsValid(); }
+
+	/**
+	 * Get the fraction of transposition table probes that hit.
+	 * @return Hit rate since the table was last cleared (0-1)
+	 */
+	UFUNCTION(BlueprintPure, Category = "AI")
+	float GetTranspositionHitRate() const;
+
+	// ========================================================================
+	// Events
+	// ========================================================================
+
+	/** Broadcast on the game thread with the planned commands (ends with the turn ending) */
+	FOnAITurnPlannedNative OnTurnPlannedNative;
+
+protected:
+	/** State shared between the game thread and one worker task */
+	struct FThinkJob
+	{
+		FLairMatchState Snapshot;
+		FName PolicyName;
+		uint64 PolicySeed = 0;
+		double BudgetSeconds = 0.0;
+		bool bFixedIterations = true;
+		std::atomic<bool> bCancelled { false };
+		TArray<FLairCommand> Commands;
+		TSharedPtr<FLairTranspositionTable, ESPMode::ThreadSafe> TranspositionTable;
+	};
+
+	/** Search cache kept across turns (allocated on first use) */
+	TSharedPtr<FLairTranspositionTable, ESPMode::ThreadSafe> TranspositionTable;
+
+	/** Job currently being planned (null when idle) */
+	TSharedPtr<FThinkJob, ESPMode::ThreadSafe> ActiveJob;
+
+	/** Task planning ActiveJob */
+	UE::Tasks::FTask ActiveTask;
+
+	/** Plan a turn (runs on a worker thread) */
+	static void PlanTurn(FThinkJob& Job);
+
+	/** Deliver a finished job (runs on the game thread) */
+	void HandleJobFinished(const TSharedPtr<FThinkJob, ESPMode::ThreadSafe>& Job);
+};
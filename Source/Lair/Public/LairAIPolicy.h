@@ -0,0 +1,106 @@
+// LairAIPolicy.h
+// AI Policies (Headless Decision Making)
+// Interface and registry for AI policies that choose commands from a match state.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LairMatchState.h"
+#include "LairRandom.h"
+
+class FLairTranspositionTable;
+
+/**
+ * Per-decision context handed to a policy.
+ */
+struct FLairAIContext
+{
+	/** Player the policy is deciding for */
+	int32 PlayerIndex = 0;
+
+	/** Policy-private random stream (never the match RNG, so policies cannot perturb the game) */
+	FLairRandomStream* Random = nullptr;
+
+	/** Wall-clock deadline (FPlatformTime::Seconds), 0 for unlimited. Ignored when bFixedIterations is set */
+	double DeadlineSeconds = 0.0;
+
+	/** Stop searches on iteration counts only, so a seeded search returns the same command on any machine */
+	bool bFixedIterations = false;
+
+	/** Set by the owner to abandon the search early */
+	const std::atomic<bool>* CancelFlag = nullptr;
+
+	/** Position cache shared by every search thread (optional) */
+	FLairTranspositionTable* TranspositionTable = nullptr;
+
+	/** True once the policy should stop searching and return its best command so far */
+	bool ShouldStop() const
+	{
+		return (CancelFlag && CancelFlag->load(std::memory_order_relaxed))
+			|| (!bFixedIterations && DeadlineSeconds > 0.0 && FPlatformTime::Seconds() >= DeadlineSeconds);
+	}
+};
+
+/**
+ * AI policy: picks one command for the current player of a match state.
+ * Instances are used by a single thread at a time; create one per worker.
+ */
+class LAIR_API ILairAIPolicy
+{
+public:
+	virtual ~ILairAIPolicy() = default;
+
+	/**
+	 * Choose the next command.
+	 * @param State - Current match state (CurrentPlayerIndex == Context.PlayerIndex)
+	 * @param Context - Decision context
+	 * @return A legal command
+	 */
+	virtual FLairCommand ChooseCommand(const FLairMatchState& State, FLairAIContext& Context) = 0;
+
+	/** Policy name as registered */
+	virtual FName GetPolicyName() const = 0;
+};
+
+/**
+ * Registry of AI policy factories by name.
+ * Built-in policies:
+ * - Random: uniform over legal commands
+ * - Greedy: buy miners, mine whenever possible, walk miners toward the nearest mine
+ * - Rollout: parallel Monte Carlo over the legal commands, merging per-slice results in
+ *   a fixed order and caching them in the transposition table
+ */
+class LAIR_API FLairAIPolicyRegistry
+{
+public:
+	typedef TFunction<TUniquePtr<ILairAIPolicy>()> FFactory;
+
+	/** Get the registry (built-in policies are registered on first use) */
+	static FLairAIPolicyRegistry& Get();
+
+	/**
+	 * Register a policy factory (replaces any existing factory with the same name).
+	 * @param PolicyName - Name used to look the policy up
+	 * @param Factory - Creates a new policy instance
+	 */
+	void RegisterPolicy(FName PolicyName, FFactory Factory);
+
+	/**
+	 * Create a policy instance.
+	 * @param PolicyName - Registered policy name
+	 * @return New instance, or null if the name is unknown
+	 */
+	TUniquePtr<ILairAIPolicy> CreatePolicy(FName PolicyName) const;
+
+	/** Get all registered policy names */
+	TArray<FName> GetPolicyNames() const;
+
+private:
+	FLairAIPolicyRegistry();
+
+	/** Factories by name */
+	TMap<FName, FFactory> Factories;
+
+	/** Guards Factories (policies are created from worker threads) */
+	mutable FRWLock FactoriesLock;
+};
@@ -0,0 +1,156 @@
+// LairBenchmark.h
+// Benchmark Cases (Performance Regression Checks)
+// Timed hot-path cases shared by the Lair.Perf automation tests and the benchmark commandlet.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+
+// Forward declarations
+class AActor;
+class ALairGameMode;
+class UBoardSystemComponent;
+class URulesEngineComponent;
+class UTurnManagerComponent;
+class UWorld;
+
+/**
+ * Sample counts and regression margin for a benchmark run.
+ */
+struct FLairBenchmarkSettings
+{
+	/** Square board sizes the board cases run on */
+	TArray<int32> BoardSizes = { 10, 64, 256 };
+
+	/** Samples per case (the median is compared) */
+	int32 NumSamples = 9;
+
+	/** Queries per sample of the board and rules cases */
+	int32 NumQueries = 10000;
+
+	/** Full phase cycles per sample of the turn case */
+	int32 NumCycles = 1000;
+
+	/** Allowed median increase over the baseline (0.2 = 20%) */
+	double Margin = 0.2;
+};
+
+/**
+ * Timing summary of one case.
+ */
+struct FLairBenchmarkResult
+{
+	FString Name;
+	int32 NumSamples = 0;
+	double MedianMs = 0.0;
+	double P95Ms = 0.0;
+	double MinMs = 0.0;
+	/** Baseline median (negative if the baseline has no such case) */
+	double BaselineMedianMs = -1.0;
+	bool bRegressed = false;
+};
+
+/**
+ * Runs the gameplay benchmark cases in a throwaway game world.
+ * Responsibilities:
+ * - Time board initialization, GetTileAt / GetNeighborTiles queries and rules tile checks
+ * - Time full phase cycles through UTurnManagerComponent
+ * - Time a 100-purchase sequence through ALairGameMode::PurchaseUnit
+ * - Compare case medians against a previous report and write a JSON report
+ *
+ * The world is created on construction and destroyed with the benchmark. Hot-path log
+ * categories are capped at Warning meanwhile, since logging would dominate the timings.
+ */
+class LAIR_API FLairBenchmark
+{
+public:
+	explicit FLairBenchmark(const FLairBenchmarkSettings& InSettings);
+	~FLairBenchmark();
+
+	FLairBenchmark(const FLairBenchmark&) = delete;
+	FLairBenchmark& operator=(const FLairBenchmark&) = delete;
+
+	// ========================================================================
+	// Cases
+	// ========================================================================
+
+	/**
+	 * Time board initialization, queries and rules tile checks on one board size.
+	 * @param BoardSize - Tiles along each side
+	 */
+	void RunBoardCases(int32 BoardSize);
+
+	/** Time full phase cycles (every player through every phase) */
+	void RunTurnCases();
+
+	/**
+	 * Time purchases through a game mode playing the default match.
+	 * @return False if the game mode has no unit types (nothing was timed)
+	 */
+	bool RunPurchaseCases();
+
+	// ========================================================================
+	// Results
+	// ========================================================================
+
+	/** Results of every case run so far, in run order */
+	const TArray<FLairBenchmarkResult>& GetResults() const { return Results; }
+
+	/**
+	 * Fill in baseline medians and flag cases slower than the margin allows.
+	 * @param BaselineMedians - Median milliseconds by case name
+	 * @return Number of regressed cases
+	 */
+	int32 CompareToBaseline(const TMap<FString, double>& BaselineMedians);
+
+	/**
+	 * Write the results as a JSON report (readable by LoadBaseline).
+	 * @param FilePath - Output file
+	 * @param BaselinePath - Baseline the results were compared against (recorded only)
+	 * @return True if the file was written
+	 */
+	bool WriteReport(const FString& FilePath, const FString& BaselinePath) const;
+
+	/**
+	 * Summarize the samples of one case.
+	 * @param Name - Case name
+	 * @param SamplesMs - One duration per sample, in milliseconds
+	 * @return Median, p95 (nearest rank) and minimum
+	 */
+	static FLairBenchmarkResult Summarize(const FString& Name, TArray<double> SamplesMs);
+
+	/**
+	 * Read the case medians of a previous report.
+	 * @param FilePath - Report written by WriteReport
+	 * @param OutMedians - Receives median milliseconds by case name
+	 * @return True if the file was read and parsed
+	 */
+	static bool LoadBaseline(const FString& FilePath, TMap<FString, double>& OutMedians);
+
+private:
+	FLairBenchmarkSettings Settings;
+
+	/** Throwaway game world */
+	UWorld* World = nullptr;
+
+	/** Standalone board, rules and turn components live on this actor */
+	AActor* Host = nullptr;
+	URulesEngineComponent* RulesEngine = nullptr;
+	UBoardSystemComponent* Board = nullptr;
+	UTurnManagerComponent* TurnManager = nullptr;
+
+	/** Spawned by the first purchase run */
+	ALairGameMode* GameMode = nullptr;
+
+	/** Query coordinates (fixed seed, so every run times the same queries) */
+	FRandomStream QueryStream;
+
+	/** Log verbosities to restore on destruction */
+	TArray<TPair<FLogCategoryBase*, ELogVerbosity::Type>> SavedVerbosities;
+
+	TArray<FLairBenchmarkResult> Results;
+
+	/** Take NumSamples samples of a case and record its summary */
+	void RunCase(const FString& Name, TFunctionRef<double()> TakeSample);
+};
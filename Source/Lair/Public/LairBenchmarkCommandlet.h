@@ -0,0 +1,34 @@
+// LairBenchmarkCommandlet.h
+// Benchmark Commandlet (Performance Regression Checks)
+// Times board, rules, purchase and turn flow hot paths and compares them against a stored baseline.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "LairBenchmarkCommandlet.generated.h"
+
+/**
+ * Commandlet that runs every FLairBenchmark case in one pass and writes a JSON report.
+ * Responsibilities:
+ * - Run the board cases at each requested size, then the turn and purchase cases
+ * - Write the median, p95 and minimum of every case to a JSON report
+ * - Fail (exit code 1) when a case's median exceeds the baseline report by more than the margin
+ *
+ * Usage:
+ *   UnrealEditor-Cmd Lair.uproject -run=LairBenchmark -nullrhi [-Sizes=10,64,256] [-Samples=9]
+ *     [-Queries=10000] [-Cycles=1000] [-Report=Saved/Benchmark.json] [-Baseline=Benchmark.json] [-Margin=0.2]
+ *
+ * A previous report can be used as the baseline as is. The same cases also run as the
+ * Lair.Perf automation tests (see LairBenchmarkTests.cpp).
+ */
+UCLASS()
+class LAIR_API ULairBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	ULairBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
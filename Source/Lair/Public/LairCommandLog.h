@@ -0,0 +1,99 @@
+// LairCommandLog.h
+// Command Log (Match Action Record)
+// Compact binary record of every command executed in a match.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LairMatchState.h"
+
+/**
+ * Append-only binary log of executed commands.
+ * Responsibilities:
+ * - Record every command applied to a match, in order
+ * - Keep records small: one header byte (type and player) plus varint operands
+ * - Decode records back into commands for replay, lockstep and crash reproduction
+ *
+ * Record layout:
+ *   Header   - low nibble ELairCommandType, high nibble player index
+ *   Purchase - varint UnitType
+ *   Mine     - varint UnitIndex
+ *   Move     - varint UnitIndex, varint TargetTile
+ *
+ * Together with the match seed, the log reproduces the match exactly.
+ */
+class LAIR_API FLairCommandLog
+{
+public:
+	/**
+	 * Clear the log for a new match.
+	 * @param InMatchSeed - Seed the match was started with
+	 */
+	void Reset(uint64 InMatchSeed);
+
+	/**
+	 * Append one command (a few bytes, no allocation in the common case).
+	 * @param Command - Executed command
+	 */
+	void Append(const FLairCommand& Command);
+
+	/**
+	 * Append records encoded by another log (lockstep peers).
+	 * @param Bytes - Whole encoded records
+	 * @return True if every record decoded (nothing is appended otherwise)
+	 */
+	bool AppendEncoded(TConstArrayView<uint8> Bytes);
+
+	/**
+	 * Remove the last record (undo).
+	 * @param RecordOffset - Byte offset the last record starts at (GetNumBytes() before it was appended)
+	 */
+	void RemoveLast(int32 RecordOffset);
+
+	/**
+	 * Decode the record at an offset.
+	 * @param InOutOffset - Byte offset of the record; advanced past it on success
+	 * @param OutCommand - Receives the command
+	 * @return True if a complete record was read
+	 */
+	bool Read(int32& InOutOffset, FLairCommand& OutCommand) const;
+
+	/**
+	 * Replace the log with previously saved data.
+	 * @param InMatchSeed - Seed of the recorded match
+	 * @param InData - Encoded records
+	 * @return True if every record decoded (the log is left empty otherwise)
+	 */
+	bool SetData(uint64 InMatchSeed, TArray<uint8> InData);
+
+	/** Encoded records */
+	const TArray<uint8>& GetData() const { return Data; }
+
+	/** Seed of the recorded match */
+	uint64 GetMatchSeed() const { return MatchSeed; }
+
+	/** Number of commands recorded */
+	int32 Num() const { return NumCommands; }
+
+	/** Size of the encoded records in bytes */
+	int32 GetNumBytes() const { return Data.Num(); }
+
+	/** Append an unsigned LEB128 varint */
+	static void WriteVarint(TArray<uint8>& Out, uint32 Value);
+
+	/**
+	 * Read an unsigned LEB128 varint.
+	 * @return True if a complete varint of at most 5 bytes was read
+	 */
+	static bool ReadVarint(const uint8* Bytes, int32 NumBytes, int32& InOutOffset, uint32& OutValue);
+
+private:
+	/** Encoded records */
+	TArray<uint8> Data;
+
+	/** Match seed */
+	uint64 MatchSeed = 0;
+
+	/** Records in Data */
+	int32 NumCommands = 0;
+};
@@ -52,6 +52,44 @@ enum class ETurnPhase : uint8
 	EndTurn UMETA(DisplayName = "End Turn")
 };
 
+/**
+ * Result category of a mining card (Phase 2+)
+ */
+UENUM(BlueprintType)
+enum class EMiningOutcome : uint8
+{
+	Mineral UMETA(DisplayName = "Mineral"),
+	Treasure UMETA(DisplayName = "Treasure"),
+	Monster UMETA(DisplayName = "Monster"),
+	MinedOut UMETA(DisplayName = "Mined Out"),
+	DigDeeper UMETA(DisplayName = "Dig Deeper")
+};
+
+/**
+ * How a victory condition is evaluated
+ */
+UENUM(BlueprintType)
+enum class EVictoryType : uint8
+{
+	GoldThreshold UMETA(DisplayName = "Gold Threshold"),
+	Elimination UMETA(DisplayName = "Elimination")
+};
+
+/**
+ * Independent random streams owned by the match RNG service.
+ * Each system draws from its own stream so adding rolls in one system
+ * never shifts the sequence seen by another.
+ */
+UENUM(BlueprintType)
+enum class ELairRandomStream : uint8
+{
+	Combat UMETA(DisplayName = "Combat"),
+	Mining UMETA(DisplayName = "Mining"),
+	Mystery UMETA(DisplayName = "Mystery Tiles"),
+	AI UMETA(DisplayName = "AI"),
+	Count UMETA(Hidden)
+};
+
 // ============================================================================
 // STRUCTS
 // ============================================================================
@@ -96,6 +134,10 @@ struct FUnitData : public FTableRowBase
 	/** Number of dice this unit rolls in combat (Phase 2+, default 1) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Unit|Phase2")
 	int32 NumberOfDice = 1;
+
+	/** Can this unit draw mining cards on a mining tile? (Phase 2+) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Unit|Phase2")
+	bool bCanMine = false;
 };
 
 /**
@@ -132,6 +174,53 @@ struct FTileTypeData : public FTableRowBase
 	bool bIsOutpost = false;
 };
 
+/**
+ * Per-tile property bits resolved from FTileTypeData.
+ * The board packs them with the player base index into one byte per tile:
+ * terrain flags in the low nibble, base index + 1 in the high nibble (0 = not a base).
+ */
+namespace ELairTileFlags
+{
+	enum Type : uint8
+	{
+		None = 0,
+		Walkable = 1 << 0,
+		CanMine = 1 << 1,
+		HasGate = 1 << 2,
+		IsOutpost = 1 << 3,
+
+		/** Terrain bits of a packed tile byte */
+		TerrainMask = 0x0F
+	};
+
+	/** Shift of the base index nibble */
+	constexpr uint8 BaseIndexShift = 4;
+
+	/** Terrain flags of a tile type */
+	inline uint8 FromTileTypeData(const FTileTypeData& TileTypeData)
+	{
+		uint8 Flags = None;
+		Flags |= TileTypeData.bWalkable ? Walkable : 0;
+		Flags |= TileTypeData.bCanMine ? CanMine : 0;
+		Flags |= TileTypeData.bHasGate ? HasGate : 0;
+		Flags |= TileTypeData.bIsOutpost ? IsOutpost : 0;
+		return Flags;
+	}
+
+	/** Pack terrain flags and a player base index (-1 if not a base) into one byte */
+	inline uint8 Pack(uint8 TerrainFlags, int32 PlayerBaseIndex)
+	{
+		const uint8 BaseBits = (PlayerBaseIndex >= 0 && PlayerBaseIndex < 15) ? static_cast<uint8>(PlayerBaseIndex + 1) : 0;
+		return static_cast<uint8>((TerrainFlags & TerrainMask) | (BaseBits << BaseIndexShift));
+	}
+
+	/** Player base index of a packed byte (-1 if not a base) */
+	inline int32 GetBaseIndex(uint8 PackedFlags)
+	{
+		return static_cast<int32>(PackedFlags >> BaseIndexShift) - 1;
+	}
+}
+
 /**
  * Board layout row for DT_BoardLayout data table
  * Defines the position and type of each tile on the board
@@ -180,6 +269,62 @@ struct FFactionData : public FTableRowBase
 	TArray<FName> EliteUnitTypes;
 };
 
+/**
+ * Mining card data loaded from DT_MiningCards data table (Phase 2+)
+ * Each row is one distinct card; CopiesInDeck controls how many are shuffled in
+ */
+USTRUCT(BlueprintType)
+struct FMiningCardData : public FTableRowBase
+{
+	GENERATED_BODY()
+
+	/** What happens when this card is drawn */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mining")
+	EMiningOutcome OutcomeType = EMiningOutcome::Mineral;
+
+	/** References other tables (mineral name, monster ID, treasure ID) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mining")
+	FName OutcomeID = NAME_None;
+
+	/** Gold value for minerals */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mining")
+	int32 GoldValue = 0;
+
+	/** Number of copies of this card in the mining deck */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mining")
+	int32 CopiesInDeck = 1;
+};
+
+/**
+ * Victory condition loaded from DT_VictoryConditions data table
+ * Row name is used as the condition ID
+ */
+USTRUCT(BlueprintType)
+struct FVictoryConditionData : public FTableRowBase
+{
+	GENERATED_BODY()
+
+	/** Display name shown in UI */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Victory")
+	FText DisplayName;
+
+	/** Description shown in the victory tracker */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Victory")
+	FText Description;
+
+	/** How this condition is evaluated */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Victory")
+	EVictoryType VictoryType = EVictoryType::GoldThreshold;
+
+	/** Gold needed for GoldThreshold */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Victory")
+	int32 GoldRequired = 0;
+
+	/** Can be toggled per game mode */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Victory")
+	bool bEnabled = true;
+};
+
 // ============================================================================
 // CONSTANTS
 // ============================================================================
@@ -0,0 +1,117 @@
+// LairEventBus.h
+// Event Bus (Coalesced Native Events)
+// Queues game events and delivers them to C++ listeners once per action or frame.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Kinds of game event carried by the bus
+ */
+enum class ELairEventType : uint8
+{
+	PhaseChanged,		// NewValue = ETurnPhase
+	PlayerChanged,		// NewValue = current player index
+	TurnChanged,		// NewValue = turn number
+	GoldChanged,		// PlayerIndex = player, Old/NewValue = gold
+	OwnedUnitsChanged,	// PlayerIndex = player, NewValue = unit count
+	Count
+};
+
+/**
+ * One game event. Events of the same type and player coalesce into one:
+ * the first OldValue and the last NewValue are kept.
+ */
+struct FLairEvent
+{
+	ELairEventType Type = ELairEventType::PhaseChanged;
+	int32 PlayerIndex = INDEX_NONE;
+	int32 OldValue = 0;
+	int32 NewValue = 0;
+};
+
+/** Listener for one event type */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnLairEvent, const FLairEvent& /*Event*/);
+
+/**
+ * Listener role, used to strip presentation work from simulations
+ */
+enum class ELairEventListener : uint8
+{
+	/** Game rules and bookkeeping; always delivered */
+	Gameplay,
+	/** UI, visuals and Blueprint adapters; dropped in simulation mode */
+	Presentation
+};
+
+/**
+ * Typed native event bus with per-flush coalescing.
+ * Responsibilities:
+ * - Queue events posted during an action
+ * - Merge repeated events of the same type and player (e.g. several gold changes in one purchase)
+ * - Deliver once per Flush: gameplay listeners first, then presentation listeners
+ * - In simulation mode, drop events nobody but presentation listens to
+ *
+ * Game thread only. Events posted by listeners during a flush are delivered in the same flush.
+ */
+class LAIR_API FLairEventBus
+{
+public:
+	/**
+	 * Get the delegate for one event type and listener role.
+	 * @param Type - Event type
+	 * @param Listener - Listener role
+	 * @return Delegate to bind to (prefer AddUObject so dead listeners are skipped)
+	 */
+	FOnLairEvent& On(ELairEventType Type, ELairEventListener Listener = ELairEventListener::Gameplay)
+	{
+		return Listeners[static_cast<int32>(Listener)][static_cast<int32>(Type)];
+	}
+
+	/**
+	 * Queue an event, merging it into a pending event of the same type and player.
+	 * @param Event - Event to queue
+	 */
+	void Post(const FLairEvent& Event);
+
+	/** Convenience overload of Post */
+	void Post(ELairEventType Type, int32 PlayerIndex, int32 OldValue, int32 NewValue)
+	{
+		Post(FLairEvent{ Type, PlayerIndex, OldValue, NewValue });
+	}
+
+	/**
+	 * Deliver all pending events.
+	 * Gold and unit count events whose value ended where it started are not delivered.
+	 */
+	void Flush();
+
+	/** Discard pending events without delivering them */
+	void Reset() { Pending.Reset(); }
+
+	/** Number of events waiting for the next flush */
+	int32 GetNumPending() const { return Pending.Num(); }
+
+	/**
+	 * Enable or disable simulation mode (presentation listeners are never called).
+	 * @param bEnabled - True for headless/simulation runs
+	 */
+	void SetSimulationMode(bool bEnabled) { bSimulationMode = bEnabled; }
+
+	/** True if presentation events are being dropped */
+	bool IsSimulationMode() const { return bSimulationMode; }
+
+private:
+	/** Listeners indexed by [role][type] */
+	FOnLairEvent Listeners[2][static_cast<int32>(ELairEventType::Count)];
+
+	/** Queued events in first-posted order */
+	TArray<FLairEvent, TInlineAllocator<16>> Pending;
+
+	/** Drop presentation delivery */
+	bool bSimulationMode = false;
+
+	/** True while Flush is delivering */
+	bool bFlushing = false;
+};
@@ -7,15 +7,30 @@
 #include "CoreMinimal.h"
 #include "GameFramework/GameModeBase.h"
 #include "LairDataStructs.h"
+#include "LairRandom.h"
+#include "LairMatchState.h"
+#include "LairEventBus.h"
+#include "LairCommandLog.h"
+#include "LairUndoStack.h"
+#include "Tasks/Task.h"
 #include "LairGameMode.generated.h"
 
 // Forward declarations
 class UBoardSystemComponent;
 class UTurnManagerComponent;
 class URulesEngineComponent;
+class UCombatOddsComponent;
+class UMiningSystemComponent;
+class UVictoryManagerComponent;
+class ULairAIComponent;
+class ULairLockstepComponent;
 class ATile;
 class AUnit;
 class ALairPlayerState;
+class FLairReplay;
+
+/** Delegate for undo history changes (one broadcast per action, undo or redo) */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnUndoStackChanged, bool, bCanUndo, bool, bCanRedo);
 
 /**
  * Central game mode that owns all systems and manages game state.
@@ -25,6 +40,14 @@ class ALairPlayerState;
  * - Hold references to Data Tables
  * - Start first turn
  * - Coordinate purchases and unit placement
+ * - Snapshot the match for AI planning and execute planned commands
+ * - Own the event bus and flush it after every action and once per frame
+ * - Execute every game action through ExecuteCommand and record it in the command log
+ * - Play back replays, syncing actors only at the seek destination
+ * - Save and load matches (binary, written off the game thread; autosave every turn)
+ * - Undo and redo hotseat actions from per-action deltas
+ * - Publish board, unit and turn state to ALairGameState for network clients
+ * - In lockstep mode, send executed commands and per-turn checksums to peers instead
  */
 UCLASS()
 class LAIR_API ALairGameMode : public AGameModeBase
@@ -36,6 +59,10 @@ public:
 
 	virtual void InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage) override;
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void Tick(float DeltaSeconds) override;
+	virtual void PostLogin(APlayerController* NewPlayer) override;
+	virtual void Logout(AController* Exiting) override;
 
 	// ========================================================================
 	// Component References
@@ -53,6 +80,22 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Systems")
 	URulesEngineComponent* RulesEngine;
 
+	/** Combat odds service for UI hover and AI evaluation */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Systems")
+	UCombatOddsComponent* CombatOdds;
+
+	/** Mining system for the mining deck */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Systems")
+	UMiningSystemComponent* MiningSystem;
+
+	/** Victory manager for incremental victory tracking */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Systems")
+	UVictoryManagerComponent* VictoryManager;
+
+	/** AI planner for computer-controlled players */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Systems")
+	ULairAIComponent* AIPlanner;
+
 	// ========================================================================
 	// Data Tables
 	// ========================================================================
@@ -73,6 +116,14 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Data")
 	UDataTable* BoardLayoutDataTable;
 
+	/** Data table containing mining cards (Phase 2+) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Data")
+	UDataTable* MiningCardsDataTable;
+
+	/** Data table containing victory conditions */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Data")
+	UDataTable* VictoryConditionsDataTable;
+
 	// ========================================================================
 	// Blueprint Classes
 	// ========================================================================
@@ -93,6 +144,30 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Game Config")
 	int32 NumberOfPlayers = 2;
 
+	/** Match RNG seed (0 = pick one at StartGame). Can be overridden with ?Seed=N */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Game Config")
+	int64 MatchSeed = 0;
+
+	/** Drop all presentation events (headless runs). Can be set with ?Simulate=1 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Game Config")
+	bool bSimulationMode = false;
+
+	/** Save the match to AutosaveSlotName at the start of every turn */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Game Config")
+	bool bAutosave = true;
+
+	/** Slot used by autosave */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Game Config")
+	FString AutosaveSlotName = TEXT("Autosave");
+
+	/** Exchange commands and checksums with peers instead of replicating state. Can be set with ?Lockstep=1 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Game Config")
+	bool bLockstepMode = false;
+
+	/** Undo levels kept (oldest are dropped) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Game Config", meta = (ClampMin = "1"))
+	int32 MaxUndoLevels = 256;
+
 	// ========================================================================
 	// Public API
 	// ========================================================================
@@ -104,7 +179,7 @@ public:
 	void StartGame();
 
 	/**
-	 * Purchase a unit for the specified player
+	 * Purchase a unit for the specified player (executed as a Purchase command)
 	 * @param PlayerIndex - The player making the purchase (0 or 1)
 	 * @param UnitTypeID - Row name from DT_Units (e.g., "Footman")
 	 * @return True if purchase succeeded, false if failed
@@ -142,16 +217,354 @@ public:
 	URulesEngineComponent* GetRulesEngine() const { return RulesEngine; }
 
 	/**
-	 * End the current player's turn
+	 * Get the combat odds component
+	 * @return CombatOddsComponent pointer
+	 */
+	UFUNCTION(BlueprintPure, Category = "Game")
+	UCombatOddsComponent* GetCombatOdds() const { return CombatOdds; }
+
+	/**
+	 * Get the mining system component
+	 * @return MiningSystemComponent pointer
+	 */
+	UFUNCTION(BlueprintPure, Category = "Game")
+	UMiningSystemComponent* GetMiningSystem() const { return MiningSystem; }
+
+	/**
+	 * Get the victory manager component
+	 * @return VictoryManagerComponent pointer
+	 */
+	UFUNCTION(BlueprintPure, Category = "Game")
+	UVictoryManagerComponent* GetVictoryManager() const { return VictoryManager; }
+
+	/**
+	 * Get the AI component
+	 * @return LairAIComponent pointer
+	 */
+	UFUNCTION(BlueprintPure, Category = "Game")
+	ULairAIComponent* GetAIPlanner() const { return AIPlanner; }
+
+	/**
+	 * Get the seed the current match was started with
+	 * @return Active match seed
+	 */
+	UFUNCTION(BlueprintPure, Category = "Game")
+	int64 GetActiveMatchSeed() const { return static_cast<int64>(Random.GetMatchSeed()); }
+
+	/**
+	 * Get the match RNG service (dice, deck shuffles, AI)
+	 * @return Random service owned by this match
+	 */
+	FLairRandomService& GetRandom() { return Random; }
+
+	/**
+	 * Get the event bus for native listeners
+	 * @return Event bus owned by this game mode
+	 */
+	FLairEventBus& GetEventBus() { return EventBus; }
+
+	/**
+	 * End the current player's turn (executed as an EndTurn command)
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Game")
 	void EndCurrentTurn();
 
+	/**
+	 * Advance the current player to the next phase (executed as an AdvancePhase command)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Game")
+	void AdvanceCurrentPhase();
+
+	/**
+	 * Check whether any player has met a victory condition.
+	 * Cheap enough to call after every action (only changed players are evaluated).
+	 * @return Winning player index, or -1 if the game continues
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Game")
+	int32 CheckVictoryConditions();
+
+	// ========================================================================
+	// Headless State
+	// ========================================================================
+
+	/**
+	 * Get the immutable rules (unit stats, board layout, deck) compiled at StartGame.
+	 * @return Shared rules, or null before the game starts
+	 */
+	TSharedPtr<const FLairMatchRules> GetMatchRules() const { return MatchRules; }
+
+	/**
+	 * Copy the live match into a headless state (unit indices match GetMatchUnit).
+	 * @param OutState - Receives the snapshot
+	 * @return True if the game is running and the snapshot is valid
+	 */
+	bool CaptureMatchState(FLairMatchState& OutState) const;
+
+	/**
+	 * Validate and execute a command against the live game.
+	 * This is the single entry point for game actions: executed commands are appended to the command log.
+	 * @param Command - Command produced by input, a policy or the headless state
+	 * @return True if the command was legal and executed
+	 */
+	bool ExecuteCommand(const FLairCommand& Command);
+
+	/**
+	 * Diagnose a desync reported by a lockstep peer: log the first field that differs from the host.
+	 * @param Peer - Reporting peer
+	 * @param NumCommands - Commands the peer had applied
+	 * @param StateBytes - Peer state (FLairMatchState::Serialize)
+	 */
+	void HandleLockstepDesync(ULairLockstepComponent* Peer, int32 NumCommands, const TArray<uint8>& StateBytes);
+
+	/**
+	 * Get the record of every command executed this match
+	 * @return Command log (reset at StartGame)
+	 */
+	const FLairCommandLog& GetCommandLog() const { return CommandLog; }
+
+	/**
+	 * Make the live game show a headless state. Units are matched by index and only spawned,
+	 * moved or destroyed where they differ; gold, deck, RNG and turn are restored.
+	 * @param State - State to show (played with rules identical to GetMatchRules)
+	 * @return True if the state was applied
+	 */
+	bool ApplyMatchState(const FLairMatchState& State);
+
+	/**
+	 * Check that a headless state fits this match without changing anything.
+	 * @param State - State to check (same requirements as ApplyMatchState)
+	 * @return True if ApplyMatchState would accept it
+	 */
+	bool CanApplyMatchState(const FLairMatchState& State) const;
+
+	/**
+	 * Get a unit by its match index (the order units were spawned in this match).
+	 * @param UnitIndex - Match unit index
+	 * @return Unit, or null if out of range or destroyed
+	 */
+	AUnit* GetMatchUnit(int32 UnitIndex) const;
+
+	// ========================================================================
+	// Undo / Redo
+	// ========================================================================
+
+	/**
+	 * Revert the last action of a human player.
+	 * Mining draws, AI actions and game over are barriers that clear the history.
+	 * @return True if an action was reverted
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Undo")
+	bool Undo();
+
+	/**
+	 * Re-execute the last undone action.
+	 * @return True if an action was redone
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Undo")
+	bool Redo();
+
+	/**
+	 * Check whether Undo would do anything
+	 * @return True if an action can be reverted
+	 */
+	UFUNCTION(BlueprintPure, Category = "Undo")
+	bool CanUndo() const { return UndoStack.CanUndo(); }
+
+	/**
+	 * Check whether Redo would do anything
+	 * @return True if an undone action can be redone
+	 */
+	UFUNCTION(BlueprintPure, Category = "Undo")
+	bool CanRedo() const { return UndoStack.CanRedo(); }
+
+	/** Broadcast once after every recorded action, undo and redo (UI refresh) */
+	UPROPERTY(BlueprintAssignable, Category = "Undo")
+	FOnUndoStackChanged OnUndoStackChanged;
+
+	// ========================================================================
+	// Save / Load
+	// ========================================================================
+
+	/**
+	 * Save the match to a slot. The state is captured now and written in the background.
+	 * @param SlotName - Slot to write (Saved/SaveGames/<SlotName>.lairsave)
+	 * @return True if the save was captured and queued
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Save")
+	bool SaveGameToSlot(const FString& SlotName);
+
+	/**
+	 * Load a match saved with the same board and unit set.
+	 * Waits for any save still being written.
+	 * @param SlotName - Slot to read
+	 * @return True if the match was restored
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Save")
+	bool LoadGameFromSlot(const FString& SlotName);
+
+	// ========================================================================
+	// Replay
+	// ========================================================================
+
+	/**
+	 * Write the current match (rules, seed and command log) to a replay file
+	 * @param FilePath - Destination file
+	 * @return True if the file was written (false if a rules edit re-keyed the log mid-match)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Replay")
+	bool SaveReplay(const FString& FilePath) const;
+
+	/**
+	 * Load a replay recorded with this match's rules and show its first turn.
+	 * Commands are rejected and AI players stay idle until StopReplay.
+	 * @param FilePath - Replay file
+	 * @return True if the replay was loaded
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Replay")
+	bool LoadReplay(const FString& FilePath);
+
+	/**
+	 * Show the start of a turn of the loaded replay
+	 * @param TurnNumber - Turn to show (clamped to the recording)
+	 * @return True if the board was updated
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Replay")
+	bool SeekReplayToTurn(int32 TurnNumber);
+
+	/**
+	 * Show the loaded replay after a number of commands
+	 * @param CommandIndex - Commands to apply (clamped to the recording)
+	 * @return True if the board was updated
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Replay")
+	bool SeekReplayToCommand(int32 CommandIndex);
+
+	/**
+	 * Leave replay playback and resume play from the position shown
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Replay")
+	void StopReplay();
+
+	/**
+	 * Check whether a replay is being played back
+	 * @return True between LoadReplay and StopReplay
+	 */
+	UFUNCTION(BlueprintPure, Category = "Replay")
+	bool IsReplayActive() const { return ActiveReplay.IsValid(); }
+
+	/**
+	 * Get the last turn of the loaded replay
+	 * @return Last turn, or 0 if no replay is loaded
+	 */
+	UFUNCTION(BlueprintPure, Category = "Replay")
+	int32 GetReplayLastTurn() const;
+
 protected:
 	/** Cached player states */
 	UPROPERTY()
 	TArray<ALairPlayerState*> PlayerStates;
 
+	/** Every unit spawned this match, in spawn order (index = headless unit index) */
+	UPROPERTY()
+	TArray<AUnit*> MatchUnits;
+
+	/** Match RNG, reseeded at StartGame */
+	FLairRandomService Random;
+
+	/** Rules compiled from the rules engine and board at StartGame */
+	TSharedPtr<const FLairMatchRules> MatchRules;
+
+	/** Coalescing event bus shared by all systems */
+	FLairEventBus EventBus;
+
+	/** Every command executed this match, in order */
+	FLairCommandLog CommandLog;
+
+	/** Undo/redo history of human actions */
+	FLairUndoStack UndoStack;
+
+	/** True while Redo re-executes a command */
+	bool bRedoing = false;
+
+	/** Units removed by undo or replay seeks, reused by the next spawn */
+	UPROPERTY()
+	TArray<AUnit*> UnitPool;
+
+	/** Last background save write (writes are chained so they land in order) */
+	UE::Tasks::FTask PendingSaveTask;
+
+	/** Replay being played back (null during normal play) */
+	TSharedPtr<FLairReplay> ActiveReplay;
+
+	/** Lockstep peers (remote player controllers) */
+	TArray<TWeakObjectPtr<ULairLockstepComponent>> LockstepPeers;
+
+	/** Command log bytes already sent to lockstep peers */
+	int32 LockstepSentBytes = 0;
+
+	/** Host state at the last checksum, kept to diagnose desync reports */
+	FLairMatchState LockstepCheckpoint;
+
+	/** Commands executed at the last checksum */
+	int32 LockstepCheckpointCommands = INDEX_NONE;
+
+	/** True while ExecuteCommand runs (commands issued from listeners are rejected) */
+	bool bExecutingCommand = false;
+
+	/** Buy a unit (dense rules table ID) and place it at the player's base */
+	bool ExecutePurchase(int32 PlayerIndex, uint8 UnitTypeId);
+
 	/** Spawn a unit at the player's base */
-	AUnit* SpawnUnitAtBase(int32 PlayerIndex, FName UnitTypeID);
+	AUnit* SpawnUnitAtBase(int32 PlayerIndex, uint8 UnitTypeId);
+
+	/** Spawn (or take from the pool) a unit into a free sub-slot of a tile */
+	AUnit* SpawnUnit(int32 PlayerIndex, uint8 UnitTypeId, ATile* Tile, int32 SubSlotIndex);
+
+	/** Return a match unit to the pool, keeping its index as an empty slot */
+	void ReleaseMatchUnit(int32 UnitIndex);
+
+	/** Publish board, units and turn state to the replicated game state (networked games only) */
+	void SyncNetGameState(bool bBoardLayoutChanged = false);
+
+	/** Start (or restart) the match on every lockstep peer */
+	void StartLockstepPeers();
+
+	/** Send newly executed records to peers, and a checksum when the turn passed on */
+	void BroadcastLockstep(bool bTurnPassed);
+
+	/** Capture the state an action may change, before it runs */
+	void BeginUndoRecord(const FLairCommand& Command, FLairUndoRecord& OutRecord) const;
+
+	/** Capture the result of an action and push it (or clear the history at a barrier) */
+	void FinishUndoRecord(FLairUndoRecord& Record);
+
+	/** Compile MatchRules from the live systems */
+	void BuildMatchRules();
+
+	/** Refresh the incoming player's units and hand AI players to the planner */
+	void HandlePlayerChanged(const FLairEvent& Event);
+
+	/** Schedule an autosave for the new turn */
+	void HandleTurnChanged(const FLairEvent& Event);
+
+	/** Save to the autosave slot */
+	void Autosave();
+
+	/** Tile type ID per tile index */
+	TArray<FName> GatherTileTypes() const;
+
+	/** Snapshot the match and start planning the current AI player's turn */
+	void StartAITurn();
+
+	/** Execute an AI turn planned in the background */
+	void HandleAITurnPlanned(int32 PlayerIndex, const TArray<FLairCommand>& Commands);
+
+	/** Push edited data table rows to live tiles and units in one pass, then re-key the match on the new rules */
+	void HandleRulesDataChanged(const TArray<uint8>& ChangedUnitTypes, const TArray<uint8>& ChangedTileTypes);
+
+	/** Move a unit to an adjacent tile */
+	bool ExecuteMove(int32 PlayerIndex, int32 UnitIndex, int32 TargetTileIndex);
+
+	/** Draw a mining card for a unit */
+	bool ExecuteMine(int32 PlayerIndex, int32 UnitIndex);
 };
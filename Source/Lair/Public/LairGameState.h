@@ -0,0 +1,435 @@
+// LairGameState.h
+// Game State (Network Replication)
+// Replicates board, unit and turn state to clients in compact delta containers.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/GameStateBase.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "LairDataStructs.h"
+#include "LairGameState.generated.h"
+
+// Forward declarations
+class ALairGameState;
+struct FLairMatchState;
+struct FLairNetTileArray;
+struct FLairNetUnitArray;
+struct FLairNetTerrainArray;
+
+// ============================================================================
+// Replicated terrain
+// ============================================================================
+
+/**
+ * Terrain of one fixed-size block of tiles, run-length encoded.
+ * Chunks keep every entry small on any board size, and a terrain change resends
+ * only the chunks it touched.
+ */
+USTRUCT()
+struct FLairNetTerrainChunk : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	/** Tiles per chunk (the last chunk may be shorter) */
+	static constexpr int32 TILES_PER_CHUNK = 1024;
+
+	/** Chunk number (first tile = ChunkIndex * TILES_PER_CHUNK) */
+	UPROPERTY()
+	uint16 ChunkIndex = 0;
+
+	/** Tiles in each run */
+	UPROPERTY()
+	TArray<uint16> RunLengths;
+
+	/** Palette index of each run */
+	UPROPERTY()
+	TArray<uint8> RunTypes;
+
+	bool operator==(const FLairNetTerrainChunk& Other) const
+	{
+		return ChunkIndex == Other.ChunkIndex && RunLengths == Other.RunLengths && RunTypes == Other.RunTypes;
+	}
+
+	/** Packed wire format: varint chunk index, run count and run lengths, one byte per run type */
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+
+	void PostReplicatedAdd(const FLairNetTerrainArray& InArraySerializer);
+	void PostReplicatedChange(const FLairNetTerrainArray& InArraySerializer);
+};
+
+template<>
+struct TStructOpsTypeTraits<FLairNetTerrainChunk> : public TStructOpsTypeTraitsBase2<FLairNetTerrainChunk>
+{
+	enum { WithNetSerializer = true };
+};
+
+/**
+ * Terrain chunks, delta-replicated (only dirty chunks are sent)
+ */
+USTRUCT()
+struct FLairNetTerrainArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FLairNetTerrainChunk> Items;
+
+	/** Game state notified of client-side changes */
+	UPROPERTY(NotReplicated)
+	TObjectPtr<ALairGameState> Owner = nullptr;
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FLairNetTerrainChunk, FLairNetTerrainArray>(Items, DeltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FLairNetTerrainArray> : public TStructOpsTypeTraitsBase2<FLairNetTerrainArray>
+{
+	enum { WithNetDeltaSerializer = true };
+};
+
+// ============================================================================
+// Replicated board
+// ============================================================================
+
+/**
+ * Occupancy of one tile as seen by clients.
+ * Only occupied tiles have an entry; an empty tile is an absent entry.
+ */
+USTRUCT()
+struct FLairNetTile : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	/** Grid coordinate */
+	UPROPERTY()
+	FIntPoint Coord = FIntPoint::ZeroValue;
+
+	/** Bit per occupied sub-slot */
+	UPROPERTY()
+	uint8 OccupiedMask = 0;
+
+	/** Player whose units stand here (-1 if empty) */
+	UPROPERTY()
+	int8 OccupantOwner = INDEX_NONE;
+
+	bool operator==(const FLairNetTile& Other) const
+	{
+		return Coord == Other.Coord && OccupiedMask == Other.OccupiedMask && OccupantOwner == Other.OccupantOwner;
+	}
+
+	/** Packed wire format: varint coordinates, 4-bit sub-slot mask, 2-bit owner */
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+
+	void PostReplicatedAdd(const FLairNetTileArray& InArraySerializer);
+	void PostReplicatedChange(const FLairNetTileArray& InArraySerializer);
+	void PreReplicatedRemove(const FLairNetTileArray& InArraySerializer);
+};
+
+template<>
+struct TStructOpsTypeTraits<FLairNetTile> : public TStructOpsTypeTraitsBase2<FLairNetTile>
+{
+	enum { WithNetSerializer = true };
+};
+
+/**
+ * Occupied tiles, delta-replicated (only dirty entries are sent)
+ */
+USTRUCT()
+struct FLairNetTileArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FLairNetTile> Items;
+
+	/** Game state notified of client-side changes */
+	UPROPERTY(NotReplicated)
+	TObjectPtr<ALairGameState> Owner = nullptr;
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FLairNetTile, FLairNetTileArray>(Items, DeltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FLairNetTileArray> : public TStructOpsTypeTraitsBase2<FLairNetTileArray>
+{
+	enum { WithNetDeltaSerializer = true };
+};
+
+// ============================================================================
+// Replicated units
+// ============================================================================
+
+/**
+ * One match unit as seen by clients
+ */
+USTRUCT()
+struct FLairNetUnit : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	/** Match unit index (stable for the whole match) */
+	UPROPERTY()
+	uint16 UnitIndex = 0;
+
+	/** Dense unit type index (FLairMatchRules::UnitTypeNames) */
+	UPROPERTY()
+	uint8 TypeIndex = 0;
+
+	/** Owning player (-1 for an empty unit slot) */
+	UPROPERTY()
+	int8 OwnerIndex = INDEX_NONE;
+
+	UPROPERTY()
+	uint8 CurrentHP = 0;
+
+	UPROPERTY()
+	uint8 RemainingMovement = 0;
+
+	/** Tile the unit stands on */
+	UPROPERTY()
+	FIntPoint Coord = FIntPoint::ZeroValue;
+
+	UPROPERTY()
+	uint8 SubSlotIndex = 0;
+
+	UPROPERTY()
+	bool bHasMined = false;
+
+	bool operator==(const FLairNetUnit& Other) const
+	{
+		return UnitIndex == Other.UnitIndex && TypeIndex == Other.TypeIndex && OwnerIndex == Other.OwnerIndex
+			&& CurrentHP == Other.CurrentHP && RemainingMovement == Other.RemainingMovement && Coord == Other.Coord
+			&& SubSlotIndex == Other.SubSlotIndex && bHasMined == Other.bHasMined;
+	}
+
+	/** Packed wire format: varint index and coordinates, 2-bit owner and sub-slot, 1-bit mined flag */
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+
+	void PostReplicatedAdd(const FLairNetUnitArray& InArraySerializer);
+	void PostReplicatedChange(const FLairNetUnitArray& InArraySerializer);
+	void PreReplicatedRemove(const FLairNetUnitArray& InArraySerializer);
+};
+
+template<>
+struct TStructOpsTypeTraits<FLairNetUnit> : public TStructOpsTypeTraitsBase2<FLairNetUnit>
+{
+	enum { WithNetSerializer = true };
+};
+
+/**
+ * Match units, delta-replicated (only dirty entries are sent)
+ */
+USTRUCT()
+struct FLairNetUnitArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FLairNetUnit> Items;
+
+	/** Game state notified of client-side changes */
+	UPROPERTY(NotReplicated)
+	TObjectPtr<ALairGameState> Owner = nullptr;
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FLairNetUnit, FLairNetUnitArray>(Items, DeltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FLairNetUnitArray> : public TStructOpsTypeTraitsBase2<FLairNetUnitArray>
+{
+	enum { WithNetDeltaSerializer = true };
+};
+
+// ============================================================================
+// Replicated turn state
+// ============================================================================
+
+/**
+ * Turn, phase and gold, replicated as one property
+ */
+USTRUCT(BlueprintType)
+struct FLairNetTurnState
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Turn")
+	ETurnPhase Phase = ETurnPhase::Purchase;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Turn")
+	int32 CurrentPlayerIndex = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Turn")
+	int32 TurnNumber = 1;
+
+	/** Winner, or INDEX_NONE */
+	UPROPERTY(BlueprintReadOnly, Category = "Turn")
+	int32 WinnerIndex = INDEX_NONE;
+
+	/** Gold per player */
+	UPROPERTY(BlueprintReadOnly, Category = "Turn")
+	TArray<int32> Gold;
+
+	bool operator==(const FLairNetTurnState& Other) const
+	{
+		return Phase == Other.Phase && CurrentPlayerIndex == Other.CurrentPlayerIndex && TurnNumber == Other.TurnNumber
+			&& WinnerIndex == Other.WinnerIndex && Gold == Other.Gold;
+	}
+};
+
+/** Native client-side notifications */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnNetTileChangedNative, const FLairNetTile& /*Tile*/);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnNetUnitChangedNative, const FLairNetUnit& /*Unit*/);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnNetUnitRemovedNative, int32 /*UnitIndex*/);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnNetTurnStateChangedNative, const FLairNetTurnState& /*TurnState*/);
+
+/**
+ * Game state replicated to clients for online play.
+ * Responsibilities:
+ * - Mirror the authoritative match (board, units, turn and gold) from the game mode
+ * - Send only what changed: entries are marked dirty only when their values differ
+ * - Keep entries small: packed coordinates, 4-bit sub-slot masks, 2-bit owners,
+ *   run-length encoded terrain in 1024-tile chunks
+ * - Warn when the state changes of one turn exceed TURN_WIRE_BUDGET_BYTES
+ * - Notify client-side presentation of added, changed and removed entries
+ *
+ * The game state is the only replicated board actor: tiles and units stay local
+ * actors, so relevancy and priority are evaluated once instead of per tile.
+ */
+UCLASS()
+class LAIR_API ALairGameState : public AGameStateBase
+{
+	GENERATED_BODY()
+
+public:
+	ALairGameState();
+
+	/** Payload one turn's state changes should stay under (excludes per-entry fast array headers) */
+	static constexpr int32 TURN_WIRE_BUDGET_BYTES = 4 * 1024;
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	// ========================================================================
+	// Server API
+	// ========================================================================
+
+	/**
+	 * Publish the board layout (call when the board is built or its terrain changes).
+	 * @param InBoardSize - Board dimensions
+	 * @param TileTypes - Tile type per tile (index = Y * BoardSize.X + X)
+	 */
+	void SetBoardLayout(FIntPoint InBoardSize, const TArray<FName>& TileTypes);
+
+	/**
+	 * Publish the match state, marking only changed entries dirty.
+	 * @param State - Authoritative state captured by the game mode
+	 */
+	void SyncMatchState(const FLairMatchState& State);
+
+	// ========================================================================
+	// Queries
+	// ========================================================================
+
+	/** Board dimensions */
+	UFUNCTION(BlueprintPure, Category = "Board")
+	FIntPoint GetBoardSize() const { return BoardSize; }
+
+	/**
+	 * Get the tile type at a coordinate.
+	 * @param Coord - Grid coordinate
+	 * @return Tile type ID, or NAME_None if out of bounds
+	 */
+	UFUNCTION(BlueprintPure, Category = "Board")
+	FName GetTileType(FIntPoint Coord) const;
+
+	/** Current turn, phase and gold */
+	UFUNCTION(BlueprintPure, Category = "Turn")
+	const FLairNetTurnState& GetTurnState() const { return TurnState; }
+
+	/** Occupied tiles */
+	const TArray<FLairNetTile>& GetNetTiles() const { return NetTiles.Items; }
+
+	/** Match units */
+	const TArray<FLairNetUnit>& GetNetUnits() const { return NetUnits.Items; }
+
+	/**
+	 * Find a unit by match unit index.
+	 * @return The unit, or nullptr if not replicated (yet)
+	 */
+	const FLairNetUnit* FindNetUnit(int32 UnitIndex) const;
+
+	// ========================================================================
+	// Events
+	// ========================================================================
+
+	/** Client: board size or terrain changed */
+	FSimpleMulticastDelegate OnNetBoardLayoutChangedNative;
+
+	/** Client: a tile's occupancy changed (an emptied tile arrives with a zero mask) */
+	FOnNetTileChangedNative OnNetTileChangedNative;
+
+	/** Client: a unit was added or changed */
+	FOnNetUnitChangedNative OnNetUnitChangedNative;
+
+	/** Client: a unit slot was removed (undo, state restore) */
+	FOnNetUnitRemovedNative OnNetUnitRemovedNative;
+
+	/** Client: turn, phase or gold changed */
+	FOnNetTurnStateChangedNative OnNetTurnStateChangedNative;
+
+protected:
+	/** Board dimensions */
+	UPROPERTY(ReplicatedUsing = OnRep_BoardLayout)
+	FIntPoint BoardSize = FIntPoint::ZeroValue;
+
+	/** Distinct tile types on the board */
+	UPROPERTY(ReplicatedUsing = OnRep_BoardLayout)
+	TArray<FName> TileTypePalette;
+
+	/** Palette indices in run-length encoded chunks (only changed chunks are resent) */
+	UPROPERTY(Replicated)
+	FLairNetTerrainArray TerrainChunks;
+
+	/** Palette index per tile (set on the server, decoded from TerrainChunks on clients) */
+	TArray<uint8> TileTypeIndices;
+
+	/** Occupied tiles */
+	UPROPERTY(Replicated)
+	FLairNetTileArray NetTiles;
+
+	/** Match units */
+	UPROPERTY(Replicated)
+	FLairNetUnitArray NetUnits;
+
+	/** Turn, phase and gold */
+	UPROPERTY(ReplicatedUsing = OnRep_TurnState)
+	FLairNetTurnState TurnState;
+
+	UFUNCTION()
+	void OnRep_BoardLayout();
+
+	UFUNCTION()
+	void OnRep_TurnState();
+
+	/** Client: decode a received terrain chunk into TileTypeIndices */
+	void ApplyTerrainChunk(const FLairNetTerrainChunk& Chunk);
+	friend struct FLairNetTerrainChunk;
+
+	/** Server: tile index -> NetTiles entry, rebuilt each sync */
+	TArray<int32> TileToEntry;
+
+	/** Server: turn the wire estimate below belongs to */
+	int32 WireBudgetTurn = INDEX_NONE;
+
+	/** Server: packed payload bits marked dirty during WireBudgetTurn */
+	int64 TurnWireBits = 0;
+};
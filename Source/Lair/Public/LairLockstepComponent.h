@@ -0,0 +1,173 @@
+// LairLockstepComponent.h
+// Lockstep Component (Command Exchange)
+// Exchanges commands and per-turn checksums between the host and one lockstep peer.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "LairMatchState.h"
+#include "LairCommandLog.h"
+#include "LairLockstepComponent.generated.h"
+
+class ALairGameMode;
+
+/** Native delegate for a command applied to the peer's local simulation */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnLockstepCommandAppliedNative, const FLairCommand& /*Command*/);
+
+/** Native delegate for a detected desync (first differing field, when known) */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnLockstepDesyncNative, int32 /*TurnNumber*/, const FString& /*Difference*/);
+
+/**
+ * Per-connection lockstep channel, owned by the player controller.
+ * Responsibilities:
+ * - Client: send the local player's commands to the host (a few bytes each)
+ * - Host: start peers from a keyframe of the current state, sent in chunks
+ * - Host: execute submitted commands and fan the executed records out to every peer
+ * - Client: apply the records to a local headless simulation in the same order
+ * - Compare a checksum of the full state at every turn hand-over and report desyncs
+ * - Ship the desynced state to the host, which logs the first differing field
+ *
+ * After the start keyframe only commands cross the wire; board, unit and turn state are never replicated.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class LAIR_API ULairLockstepComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	ULairLockstepComponent();
+
+	// ========================================================================
+	// Client API
+	// ========================================================================
+
+	/**
+	 * Send a command to the host. Nothing changes locally until the host echoes it back.
+	 * @param Command - Command for this peer's player
+	 * @return True if the command was sent
+	 */
+	bool SubmitCommand(const FLairCommand& Command);
+
+	/** True once the host has started the match on this peer */
+	bool IsMatchStarted() const { return LocalState.Rules.IsValid(); }
+
+	/** Player this peer controls (INDEX_NONE for spectators) */
+	int32 GetPlayerIndex() const { return PlayerIndex; }
+
+	/** Local simulation, advanced only by host-confirmed commands */
+	const FLairMatchState& GetLocalState() const { return LocalState; }
+
+	// ========================================================================
+	// Host API
+	// ========================================================================
+
+	/**
+	 * Assign the player this peer controls.
+	 * @param InPlayerIndex - Player index, or INDEX_NONE for spectators
+	 */
+	void SetPlayerIndex(int32 InPlayerIndex) { PlayerIndex = InPlayerIndex; }
+
+	/** Largest start payload piece sent in one RPC */
+	static constexpr int32 START_CHUNK_BYTES = 16 * 1024;
+
+	/**
+	 * Start the match on the peer from a keyframe, so it never replays history recorded
+	 * against a different board (loaded saves, hot reloads).
+	 * @param Keyframe - Host state to start from (its rules are sent along)
+	 * @param KeyframeCommands - Commands executed before the keyframe
+	 * @param Seed - Match seed
+	 */
+	void StartPeer(const FLairMatchState& Keyframe, int32 KeyframeCommands, uint64 Seed);
+
+	/**
+	 * Forward executed records to the peer.
+	 * @param Records - Encoded records, in execution order
+	 */
+	void SendRecords(const TArray<uint8>& Records);
+
+	/**
+	 * Ask the peer to verify its state at a turn hand-over.
+	 * @param NumCommands - Commands executed up to this point
+	 * @param TurnNumber - Turn number after the hand-over
+	 * @param Checksum - Host's FLairMatchState::ComputeChecksum
+	 */
+	void SendChecksum(int32 NumCommands, int32 TurnNumber, uint64 Checksum);
+
+	// ========================================================================
+	// Events
+	// ========================================================================
+
+	/** Client: a host-confirmed command was applied locally */
+	FOnLockstepCommandAppliedNative OnCommandAppliedNative;
+
+	/** Client and host: a desync was detected */
+	FOnLockstepDesyncNative OnDesyncNative;
+
+protected:
+	// ========================================================================
+	// RPCs
+	// ========================================================================
+
+	UFUNCTION(Client, Reliable)
+	void ClientBeginMatch(int32 InPlayerIndex, uint64 Seed, int32 InKeyframeCommands, int32 PayloadSize);
+
+	UFUNCTION(Client, Reliable)
+	void ClientReceiveMatchChunk(const TArray<uint8>& Chunk);
+
+	UFUNCTION(Client, Reliable)
+	void ClientApplyRecords(const TArray<uint8>& Records);
+
+	UFUNCTION(Client, Reliable)
+	void ClientVerifyChecksum(int32 NumCommands, int32 TurnNumber, uint64 Checksum);
+
+	UFUNCTION(Server, Reliable)
+	void ServerSubmitCommand(const TArray<uint8>& Record);
+
+	UFUNCTION(Server, Reliable)
+	void ServerReportDesync(int32 NumCommands, const TArray<uint8>& StateBytes);
+
+	// ========================================================================
+	// State
+	// ========================================================================
+
+	/** Player this peer controls */
+	int32 PlayerIndex = INDEX_NONE;
+
+	/** Client: rules received from the host */
+	TSharedPtr<FLairMatchRules> LocalRules;
+
+	/** Client: headless state advanced by confirmed commands */
+	FLairMatchState LocalState;
+
+	/** Client: commands executed before the keyframe the match started from */
+	int32 KeyframeCommands = 0;
+
+	/** Client: confirmed records since the keyframe */
+	FLairCommandLog LocalLog;
+
+	/** Client: seed and seat of the match being received */
+	uint64 PendingSeed = 0;
+	int32 PendingPlayerIndex = INDEX_NONE;
+
+	/** Client: start payload (rules, then keyframe state) received so far */
+	TArray<uint8> PendingPayload;
+
+	/** Client: expected start payload size (INDEX_NONE when nothing is pending) */
+	int32 PendingPayloadSize = INDEX_NONE;
+
+	/** Client: byte offset of the first record not yet applied */
+	int32 ApplyOffset = 0;
+
+	/** Client: set after the first desync (reported once) */
+	bool bDesynced = false;
+
+	/** Apply confirmed records from ApplyOffset on */
+	void ApplyPendingRecords();
+
+	/** Start the local simulation once the whole start payload has arrived */
+	void FinishMatchStart();
+
+	/** Host game mode (server only) */
+	ALairGameMode* GetHostGameMode() const;
+};
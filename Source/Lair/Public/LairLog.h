@@ -0,0 +1,36 @@
+// LairLog.h
+// Log Categories (Per Subsystem)
+// Declares the LAIR log categories and their compile-time verbosity ceilings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Ceiling for categories logged from hot paths (per action, per unit, per tile).
+ * Test and Shipping builds compile out everything below Warning, so those calls
+ * neither format strings nor evaluate their arguments.
+ */
+#if UE_BUILD_SHIPPING || UE_BUILD_TEST
+#define LAIR_HOT_PATH_LOG_CEILING Warning
+#else
+#define LAIR_HOT_PATH_LOG_CEILING All
+#endif
+
+/** Module lifetime, save/load, replays, networking, AI and commandlets */
+LAIR_API DECLARE_LOG_CATEGORY_EXTERN(LogLair, Log, All);
+
+/** Board layout, tiles, unit placement and movement */
+LAIR_API DECLARE_LOG_CATEGORY_EXTERN(LogLairBoard, Log, LAIR_HOT_PATH_LOG_CEILING);
+
+/** Turn order, phases and victory */
+LAIR_API DECLARE_LOG_CATEGORY_EXTERN(LogLairTurn, Log, LAIR_HOT_PATH_LOG_CEILING);
+
+/** Rules data, validation and combat odds */
+LAIR_API DECLARE_LOG_CATEGORY_EXTERN(LogLairRules, Log, LAIR_HOT_PATH_LOG_CEILING);
+
+/** Gold, purchases and mining */
+LAIR_API DECLARE_LOG_CATEGORY_EXTERN(LogLairEconomy, Log, LAIR_HOT_PATH_LOG_CEILING);
+
+/** Player input and selection */
+LAIR_API DECLARE_LOG_CATEGORY_EXTERN(LogLairInput, Log, LAIR_HOT_PATH_LOG_CEILING);
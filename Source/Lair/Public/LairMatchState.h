@@ -0,0 +1,338 @@
+// LairMatchState.h
+// Headless Match State (Simulation Core)
+// Actor-free game state and rules used by AI search, tournaments and tools.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LairDataStructs.h"
+#include "LairRandom.h"
+#include "MiningSystemComponent.h"
+
+// ============================================================================
+// Static data
+// ============================================================================
+
+/**
+ * Unit stats needed by the simulation, packed as plain data
+ */
+struct FLairUnitTypeStats
+{
+	int32 Cost = 0;
+	uint8 MovementPoints = 0;
+	uint8 HitPoints = 1;
+	uint8 SubSlotSize = 1;
+	uint8 bCanMine = 0;
+};
+
+/**
+ * Immutable rules and board layout shared by every state of a match.
+ * Built once, then referenced (never copied) by states and snapshots.
+ */
+struct LAIR_API FLairMatchRules
+{
+	/** Largest board the simulation accepts (1024x1024; tile indices are stored as uint32) */
+	static constexpr int32 MAX_TILES = 1024 * 1024;
+
+	/** Unit type names, indexed by dense unit type index */
+	TArray<FName> UnitTypeNames;
+
+	/** Unit stats, indexed by dense unit type index */
+	TArray<FLairUnitTypeStats> UnitTypes;
+
+	/** Board dimensions */
+	FIntPoint BoardSize = FIntPoint::ZeroValue;
+
+	/** ELairTileFlags per tile (index = Y * BoardSize.X + X) */
+	TArray<uint8> TileFlags;
+
+	/** Base tile index per player */
+	TArray<int32> BaseTiles;
+
+	/** Steps to the nearest walkable mining tile per tile (MAX_uint16 if unreachable) */
+	TArray<uint16> MineDistance;
+
+	/** Mining card definitions */
+	TSharedPtr<const TArray<FMiningCardData>> CardTable;
+
+	/** Gold each player starts with */
+	int32 StartingGold = LairConstants::STARTING_GOLD;
+
+	/** Gold needed to win (0 disables) */
+	int32 GoldVictoryThreshold = 3000;
+
+	/** Game ends in a draw after this many turns (0 = unlimited) */
+	int32 MaxTurns = 0;
+
+	/** Number of players */
+	int32 NumPlayers = LairConstants::MAX_PLAYERS;
+
+	/**
+	 * Build a square board with bases in opposite corners and a mining band on the
+	 * anti-diagonal, so both bases are the same distance from the mines.
+	 * @param Size - Board width and height
+	 * @return New rules with the default Phase 1 unit set
+	 */
+	static TSharedRef<FLairMatchRules> MakeDefault(int32 Size);
+
+	/** Fill the default Phase 1 unit set (Miner, Wagon, Footman) */
+	void AddDefaultUnitTypes();
+
+	/** Compute derived data (MineDistance) after the board is filled in */
+	void FinalizeBoard();
+
+	/**
+	 * Save or load the rules (derived data is rebuilt on load).
+	 * @param Ar - Archive to serialize with
+	 */
+	void Serialize(FArchive& Ar);
+
+	/** Hash of everything that affects play (used to check a recording matches these rules) */
+	uint64 ComputeFingerprint() const;
+
+	/** Find a unit type index by name (INDEX_NONE if unknown) */
+	int32 FindUnitType(FName UnitTypeID) const { return UnitTypeNames.IndexOfByKey(UnitTypeID); }
+
+	/** Convert a coordinate to a tile index (INDEX_NONE if out of bounds) */
+	int32 GetTileIndex(FIntPoint Coord) const
+	{
+		return (Coord.X >= 0 && Coord.X < BoardSize.X && Coord.Y >= 0 && Coord.Y < BoardSize.Y)
+			? Coord.Y * BoardSize.X + Coord.X : INDEX_NONE;
+	}
+
+	/** Convert a tile index to a coordinate */
+	FIntPoint GetTileCoord(int32 TileIndex) const
+	{
+		return FIntPoint(TileIndex % BoardSize.X, TileIndex / BoardSize.X);
+	}
+
+	/** Number of tiles */
+	int32 GetNumTiles() const { return BoardSize.X * BoardSize.Y; }
+};
+
+// ============================================================================
+// Commands
+// ============================================================================
+
+/**
+ * Kinds of game action
+ */
+enum class ELairCommandType : uint8
+{
+	None,
+	Purchase,
+	Mine,
+	Move,
+	AdvancePhase,
+	EndTurn
+};
+
+/**
+ * One game action, as chosen by a player or AI.
+ */
+struct FLairCommand
+{
+	/** Action kind */
+	ELairCommandType Type = ELairCommandType::None;
+
+	/** Acting player */
+	int8 PlayerIndex = 0;
+
+	/** Dense unit type index (Purchase) */
+	uint8 UnitType = 0;
+
+	/** Unit index in the match state (Mine, Move) */
+	uint16 UnitIndex = 0;
+
+	/** Destination tile index (Move) */
+	uint32 TargetTile = 0;
+
+	static FLairCommand MakePurchase(int32 Player, int32 InUnitType)
+	{
+		FLairCommand Command;
+		Command.Type = ELairCommandType::Purchase;
+		Command.PlayerIndex = static_cast<int8>(Player);
+		Command.UnitType = static_cast<uint8>(InUnitType);
+		return Command;
+	}
+
+	static FLairCommand MakeMine(int32 Player, int32 InUnitIndex)
+	{
+		FLairCommand Command;
+		Command.Type = ELairCommandType::Mine;
+		Command.PlayerIndex = static_cast<int8>(Player);
+		Command.UnitIndex = static_cast<uint16>(InUnitIndex);
+		return Command;
+	}
+
+	static FLairCommand MakeMove(int32 Player, int32 InUnitIndex, int32 InTargetTile)
+	{
+		FLairCommand Command;
+		Command.Type = ELairCommandType::Move;
+		Command.PlayerIndex = static_cast<int8>(Player);
+		Command.UnitIndex = static_cast<uint16>(InUnitIndex);
+		Command.TargetTile = static_cast<uint32>(InTargetTile);
+		return Command;
+	}
+
+	static FLairCommand MakeSimple(ELairCommandType InType, int32 Player)
+	{
+		FLairCommand Command;
+		Command.Type = InType;
+		Command.PlayerIndex = static_cast<int8>(Player);
+		return Command;
+	}
+
+	bool operator==(const FLairCommand& Other) const
+	{
+		return Type == Other.Type && PlayerIndex == Other.PlayerIndex && UnitType == Other.UnitType
+			&& UnitIndex == Other.UnitIndex && TargetTile == Other.TargetTile;
+	}
+};
+
+// ============================================================================
+// Dynamic state
+// ============================================================================
+
+/**
+ * One unit in the headless state (12 bytes, no padding, so states hash byte-wise)
+ */
+struct FLairSimUnit
+{
+	uint32 TileIndex = 0;
+	uint8 TypeIndex = 0;
+	int8 OwnerIndex = 0;
+	uint8 CurrentHP = 1;
+	uint8 RemainingMovement = 0;
+	uint8 SubSlotIndex = 0;
+	uint8 bHasMined = 0;
+
+	/** Fills the tail so no byte is left uninitialized (always zero) */
+	uint16 Reserved = 0;
+};
+static_assert(sizeof(FLairSimUnit) == 12, "FLairSimUnit must stay padding-free; states are hashed byte-wise");
+
+/**
+ * Per-tile occupancy in the headless state
+ */
+struct FLairSimTile
+{
+	/** Bit per occupied sub-slot */
+	uint8 OccupiedMask = 0;
+
+	/** Player whose units stand here (-1 if empty) */
+	int8 OccupantOwner = -1;
+};
+
+/**
+ * Complete dynamic state of a match, independent of actors and the world.
+ * Copyable: a copy is a snapshot that can be searched or rolled forward freely.
+ *
+ * Ruleset mirrors the actor game:
+ * - Purchase: buy units into a free sub-slot at the player's base
+ * - Mining: each mining-capable unit on a mining tile may draw one card; minerals pay out immediately
+ * - MovementCombat: step to a neighbouring tile (1 orthogonal, 2 diagonal) onto walkable tiles
+ *   without enemy units and with room in the sub-slots
+ * - A player wins on reaching GoldVictoryThreshold; MaxTurns ends the match in a draw
+ */
+struct LAIR_API FLairMatchState
+{
+	/** Shared immutable rules */
+	TSharedPtr<const FLairMatchRules> Rules;
+
+	/** Per-tile occupancy */
+	TArray<FLairSimTile> Tiles;
+
+	/** All units (indices are stable for the whole match) */
+	TArray<FLairSimUnit> Units;
+
+	/** Gold per player */
+	TArray<int32, TInlineAllocator<LairConstants::MAX_PLAYERS>> Gold;
+
+	/** Current phase */
+	ETurnPhase Phase = ETurnPhase::Purchase;
+
+	/** Player whose turn it is */
+	int32 CurrentPlayerIndex = 0;
+
+	/** Turn number (starts at 1) */
+	int32 TurnNumber = 1;
+
+	/** Winner, or INDEX_NONE */
+	int32 WinnerIndex = INDEX_NONE;
+
+	/** True once the match has ended (win or draw) */
+	bool bGameOver = false;
+
+	/** Match RNG */
+	FLairRandomService Random;
+
+	/** Mining deck */
+	FMiningDeck MiningDeck;
+
+	/**
+	 * Reset to the start of a match.
+	 * @param InRules - Shared rules and board
+	 * @param Seed - Match seed
+	 */
+	void Initialize(TSharedPtr<const FLairMatchRules> InRules, uint64 Seed);
+
+	/**
+	 * Append every legal command for the current player.
+	 * @param OutCommands - Receives commands (not cleared)
+	 */
+	void GetLegalCommands(TArray<FLairCommand>& OutCommands) const;
+
+	/** Check a command against the rules without applying it */
+	bool IsCommandLegal(const FLairCommand& Command) const;
+
+	/**
+	 * Validate and apply a command.
+	 * @return True if the command was legal and applied
+	 */
+	bool ApplyCommand(const FLairCommand& Command);
+
+	/** Hash of the position (for transposition tables; ignores RNG and deck order) */
+	uint64 ComputeHash() const;
+
+	/**
+	 * Hash of everything the rules depend on, including the gameplay RNG streams and deck order
+	 * (lockstep desync checks). The AI stream is excluded: only the host plans AI turns.
+	 */
+	uint64 ComputeChecksum() const;
+
+	/**
+	 * Save or load the dynamic state (Rules must already be set when loading).
+	 * @param Ar - Archive to serialize with
+	 */
+	void Serialize(FArchive& Ar);
+
+	/**
+	 * Describe the first field that differs from another state (desync diagnostics).
+	 * @param Other - State to compare against
+	 * @return Field path and both values, or an empty string if the checksummed state is equal
+	 */
+	FString DescribeFirstDifference(const FLairMatchState& Other) const;
+
+	/** Number of units owned by a player */
+	int32 CountUnits(int32 PlayerIndex) const;
+
+	/** Find the sub-slot a unit of the given size would take (mirrors ATile::FindAvailableSubSlot) */
+	static int32 FindFreeSubSlot(uint8 OccupiedMask, int32 SubSlotSize);
+
+	/** Sub-slot bits a unit of the given size occupies when placed at a slot */
+	static uint8 GetSubSlotBits(int32 SubSlotIndex, int32 SubSlotSize)
+	{
+		return static_cast<uint8>((SubSlotSize == 2 ? 0x3 : 0x1) << SubSlotIndex);
+	}
+
+private:
+	/** Move to the next player's Purchase phase */
+	void AdvancePlayer();
+
+	/** Check the victory threshold and turn limit */
+	void UpdateGameOver();
+
+	/** Movement cost between adjacent tiles (-1 if not adjacent) */
+	int32 GetStepCost(int32 FromTile, int32 ToTile) const;
+};
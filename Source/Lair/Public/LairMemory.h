@@ -0,0 +1,33 @@
+// LairMemory.h
+// Memory Tags (Low-Level Memory Tracker)
+// Declares the LLM tags that break Lair allocations down by subsystem.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+
+// Run with -llm (and -llmcsv for headless reports); every tag below is a child of Lair.
+// Scope allocations with LLM_SCOPE_BYTAG(Lair_Board) and so on; scopes are per thread,
+// so work handed to task threads must open its own scope.
+
+/** Match setup and anything not covered by a subsystem tag */
+LLM_DECLARE_TAG_API(Lair, LAIR_API);
+
+/** Board grid, per-tile flags and layout loading */
+LLM_DECLARE_TAG_API(Lair_Board, LAIR_API);
+
+/** Tile actors, their components and materials */
+LLM_DECLARE_TAG_API(Lair_Tiles, LAIR_API);
+
+/** Unit actors, their components and materials */
+LLM_DECLARE_TAG_API(Lair_Units, LAIR_API);
+
+/** Compiled rules tables and match rules */
+LLM_DECLARE_TAG_API(Lair_Rules, LAIR_API);
+
+/** AI planning jobs and transposition tables */
+LLM_DECLARE_TAG_API(Lair_AI, LAIR_API);
+
+/** Command logs, replays and their keyframes */
+LLM_DECLARE_TAG_API(Lair_Replay, LAIR_API);
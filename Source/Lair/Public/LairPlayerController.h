@@ -13,6 +13,8 @@
 class ATile;
 class AUnit;
 class ALairGameMode;
+class ULairLockstepComponent;
+struct FLairCommand;
 
 /** Delegate for tile selection */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnTileSelected, ATile*, SelectedTile);
@@ -26,7 +28,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnUnitSelected, AUnit*, SelectedUni
  * - Detect mouse clicks on tiles
  * - Detect UI button clicks
  * - Convert input to game actions
- * - Communicate with GameMode to execute actions
+ * - Communicate with GameMode to execute actions (or the host, as a lockstep peer)
  * - Enable mouse cursor
  */
 UCLASS()
@@ -103,6 +105,18 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Actions")
 	void OnAdvancePhaseClicked();
 
+	/**
+	 * Take back the last action (Ctrl+Z).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Actions")
+	void OnUndoClicked();
+
+	/**
+	 * Repeat the last undone action (Ctrl+Y).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Actions")
+	void OnRedoClicked();
+
 	// ========================================================================
 	// Queries
 	// ========================================================================
@@ -123,17 +137,30 @@ public:
 
 	/**
 	 * Get the player index this controller represents.
-	 * For hotseat mode, returns the current player from TurnManager.
+	 * For hotseat mode, returns the current player from TurnManager; lockstep peers return their seat.
 	 * @return Player index
 	 */
 	UFUNCTION(BlueprintPure, Category = "Player")
 	int32 GetLocalPlayerIndex() const;
 
+	/** Lockstep channel to the host (idle outside lockstep games) */
+	ULairLockstepComponent* GetLockstep() const { return Lockstep; }
+
 protected:
-	/** Cached game mode reference */
+	/** Cached game mode reference (null on network clients) */
 	UPROPERTY()
 	ALairGameMode* GameModeRef;
 
+	/** Lockstep channel to the host */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Network")
+	ULairLockstepComponent* Lockstep;
+
+	/**
+	 * Send a command to the host as a lockstep peer.
+	 * @return True if this controller is a started lockstep peer and the command was sent
+	 */
+	bool SubmitToHost(const FLairCommand& Command);
+
 	/** Select a tile */
 	void SelectTile(ATile* Tile);
 
@@ -7,6 +7,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/PlayerState.h"
 #include "LairDataStructs.h"
+#include "LairEventBus.h"
 #include "LairPlayerState.generated.h"
 
 // Forward declaration
@@ -15,6 +16,12 @@ class AUnit;
 /** Delegate for gold changes */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnGoldChanged, int32, OldGold, int32, NewGold);
 
+/** Native gold change notification for C++ systems (includes the source player) */
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnPlayerGoldChangedNative, ALairPlayerState* /*PlayerState*/, int32 /*OldGold*/, int32 /*NewGold*/);
+
+/** Native owned-unit change notification for C++ systems */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnOwnedUnitsChangedNative, ALairPlayerState* /*PlayerState*/, int32 /*NumOwnedUnits*/);
+
 /**
  * Per-player state for LAIR game.
  * Responsibilities:
@@ -22,6 +29,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnGoldChanged, int32, OldGold, int
  * - Track player faction
  * - Track units owned by player
  * - Expose gold modification functions
+ * - Post gold and unit changes (event bus when set, delegates otherwise)
  */
 UCLASS()
 class LAIR_API ALairPlayerState : public APlayerState
@@ -51,6 +59,12 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Player")
 	FOnGoldChanged OnGoldChanged;
 
+	/** Broadcast to C++ listeners when gold amount changes */
+	FOnPlayerGoldChangedNative OnGoldChangedNative;
+
+	/** Broadcast to C++ listeners when a unit is added or removed */
+	FOnOwnedUnitsChangedNative OnOwnedUnitsChangedNative;
+
 	// ========================================================================
 	// Gold Management API
 	// ========================================================================
@@ -120,6 +134,13 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Player")
 	TArray<AUnit*> GetOwnedUnits() const { return OwnedUnits; }
 
+	/**
+	 * Get the number of units owned by this player.
+	 * @return Owned unit count
+	 */
+	UFUNCTION(BlueprintPure, Category = "Player")
+	int32 GetNumOwnedUnits() const { return OwnedUnits.Num(); }
+
 	/**
 	 * Add a unit to this player's ownership.
 	 * @param Unit - Unit to add
@@ -146,6 +167,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Player")
 	void InitializePlayer(int32 InPlayerIndex, int32 StartingGold);
 
+	/**
+	 * Route change events through an event bus. Several changes within one action then
+	 * reach listeners as a single coalesced event; OnGoldChanged becomes a presentation
+	 * listener and the native delegates become gameplay listeners.
+	 * @param InEventBus - Bus owned by the game mode (null to broadcast immediately)
+	 */
+	void SetEventBus(FLairEventBus* InEventBus);
+
 protected:
 	/** Current gold amount */
 	UPROPERTY(BlueprintReadOnly, Category = "Player")
@@ -154,4 +183,19 @@ protected:
 	/** Units owned by this player */
 	UPROPERTY()
 	TArray<AUnit*> OwnedUnits;
+
+	/** Event bus (not owned, may be null) */
+	FLairEventBus* EventBus = nullptr;
+
+	/** Post or broadcast a gold change */
+	void NotifyGoldChanged(int32 OldGold);
+
+	/** Post or broadcast an owned unit count change */
+	void NotifyOwnedUnitsChanged(int32 OldNumOwnedUnits);
+
+	/** Bus gameplay listener: forward this player's events to the native delegates */
+	void ForwardGameplayEvent(const FLairEvent& Event);
+
+	/** Bus presentation listener: forward this player's gold events to OnGoldChanged */
+	void ForwardPresentationEvent(const FLairEvent& Event);
 };
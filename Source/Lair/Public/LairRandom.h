@@ -0,0 +1,191 @@
+// LairRandom.h
+// Match RNG Service (Deterministic Random Streams)
+// Seeded per match so dice, deck shuffles and AI choices are reproducible.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LairDataStructs.h"
+
+/**
+ * One xoshiro256** random stream.
+ * Not thread-safe: each stream is owned by exactly one consumer.
+ * Copyable, so AI snapshots can roll forward without touching the live match.
+ */
+struct LAIR_API FLairRandomStream
+{
+	/** Generator state (never all zero once seeded) */
+	uint64 State[4] = { 0, 0, 0, 0 };
+
+	/**
+	 * Seed the stream from a single 64-bit value (expanded with SplitMix64).
+	 * @param Seed - Any value, including zero
+	 */
+	void Seed(uint64 Seed);
+
+	/**
+	 * Advance the stream by 2^128 draws.
+	 * Used to derive non-overlapping sibling streams from one seed.
+	 */
+	void Jump();
+
+	/** True once seeded; an all-zero state only ever produces zeros */
+	bool IsSeeded() const { return (State[0] | State[1] | State[2] | State[3]) != 0; }
+
+	/** Next raw 64-bit value */
+	FORCEINLINE uint64 Next()
+	{
+		const uint64 Result = Rotl(State[1] * 5, 7) * 9;
+		const uint64 T = State[1] << 17;
+
+		State[2] ^= State[0];
+		State[3] ^= State[1];
+		State[1] ^= State[2];
+		State[0] ^= State[3];
+		State[2] ^= T;
+		State[3] = Rotl(State[3], 45);
+
+		return Result;
+	}
+
+	/** Next raw 32-bit value */
+	FORCEINLINE uint32 NextUInt32()
+	{
+		return static_cast<uint32>(Next() >> 32);
+	}
+
+	/**
+	 * Unbiased integer in [0, Bound).
+	 * @param Bound - Exclusive upper bound (must be > 0)
+	 */
+	uint32 NextBounded(uint32 Bound);
+
+	/**
+	 * Unbiased integer in [Min, Max].
+	 * @param Min - Inclusive lower bound
+	 * @param Max - Inclusive upper bound
+	 */
+	int32 RandRange(int32 Min, int32 Max);
+
+	/** Uniform float in [0, 1) */
+	FORCEINLINE float FRand()
+	{
+		return static_cast<float>(Next() >> 40) * (1.0f / 16777216.0f);
+	}
+
+	/** Roll one d6 (1-6) */
+	uint8 RollDie();
+
+	/**
+	 * Fill a buffer with d6 rolls (1-6).
+	 * Consumes one 64-bit draw per eight dice.
+	 * @param OutDice - Buffer to fill
+	 */
+	void FillDice(TArrayView<uint8> OutDice);
+
+	/**
+	 * In-place Fisher-Yates shuffle.
+	 * @param Items - Items to shuffle
+	 */
+	template <typename T>
+	void Shuffle(TArrayView<T> Items)
+	{
+		for (int32 i = Items.Num() - 1; i > 0; --i)
+		{
+			const int32 j = static_cast<int32>(NextBounded(static_cast<uint32>(i + 1)));
+			if (i != j)
+			{
+				Swap(Items[i], Items[j]);
+			}
+		}
+	}
+
+	bool operator==(const FLairRandomStream& Other) const
+	{
+		return FMemory::Memcmp(State, Other.State, sizeof(State)) == 0;
+	}
+
+	friend FArchive& operator<<(FArchive& Ar, FLairRandomStream& Stream)
+	{
+		for (uint64& Word : Stream.State)
+		{
+			Ar << Word;
+		}
+
+		// A zero state would stall NextBounded forever; treat it as corrupt data
+		if (Ar.IsLoading() && !Stream.IsSeeded())
+		{
+			Ar.SetError();
+		}
+		return Ar;
+	}
+
+private:
+	static FORCEINLINE uint64 Rotl(uint64 X, int32 K)
+	{
+		return (X << K) | (X >> (64 - K));
+	}
+};
+
+/**
+ * Match-owned random number service.
+ * Holds one independent stream per ELairRandomStream, all derived from a single match seed,
+ * so an entire match is reproducible from that seed regardless of which systems roll first.
+ */
+class LAIR_API FLairRandomService
+{
+public:
+	FLairRandomService();
+
+	/**
+	 * Reseed every stream from a match seed.
+	 * @param InMatchSeed - Seed recorded with the match
+	 */
+	void Initialize(uint64 InMatchSeed);
+
+	/** Seed this service was initialized with */
+	uint64 GetMatchSeed() const { return MatchSeed; }
+
+	/** Get a named stream */
+	FLairRandomStream& GetStream(ELairRandomStream Stream)
+	{
+		check(Stream < ELairRandomStream::Count);
+		return Streams[static_cast<int32>(Stream)];
+	}
+
+	/** Get a named stream (read-only) */
+	const FLairRandomStream& GetStream(ELairRandomStream Stream) const
+	{
+		check(Stream < ELairRandomStream::Count);
+		return Streams[static_cast<int32>(Stream)];
+	}
+
+	/**
+	 * Fill a buffer with combat dice (1-6) from the Combat stream.
+	 * @param OutDice - Buffer to fill
+	 */
+	void FillDice(TArrayView<uint8> OutDice)
+	{
+		GetStream(ELairRandomStream::Combat).FillDice(OutDice);
+	}
+
+	/** Make a seed from the clock for matches that did not request one */
+	static uint64 MakeRandomSeed();
+
+	friend FArchive& operator<<(FArchive& Ar, FLairRandomService& Service)
+	{
+		Ar << Service.MatchSeed;
+		for (FLairRandomStream& Stream : Service.Streams)
+		{
+			Ar << Stream;
+		}
+		return Ar;
+	}
+
+private:
+	/** Seed recorded with the match */
+	uint64 MatchSeed = 0;
+
+	/** One stream per ELairRandomStream */
+	FLairRandomStream Streams[static_cast<int32>(ELairRandomStream::Count)];
+};
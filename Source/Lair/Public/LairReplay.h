@@ -0,0 +1,115 @@
+// LairReplay.h
+// Replay (Headless Playback and Seeking)
+// Rebuilds a recorded match from its command log and seeks to any turn through keyframes.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LairMatchState.h"
+#include "LairCommandLog.h"
+
+/**
+ * A recorded match that can be scrubbed without actors.
+ * Responsibilities:
+ * - Save and load replay files (header, rules, seed and command log)
+ * - Re-simulate the whole match once on load, keeping a keyframe every few turns
+ * - Seek to any turn or command: copy the nearest earlier keyframe, then apply the
+ *   remaining commands to the headless state
+ *
+ * Seeking never touches the world; the caller syncs actors once at the destination.
+ */
+class LAIR_API FLairReplay
+{
+public:
+	/** Turns between keyframes (a seek replays at most this many turns of commands) */
+	static constexpr int32 DEFAULT_KEYFRAME_INTERVAL = 8;
+
+	/**
+	 * Build from a command log, validating every command.
+	 * @param InRules - Rules the match was played with
+	 * @param InLog - Recorded commands and seed
+	 * @param KeyframeInterval - Turns between keyframes
+	 * @return True if every command applied (a replay that diverges is cut at the first bad command)
+	 */
+	bool Build(TSharedPtr<const FLairMatchRules> InRules, const FLairCommandLog& InLog, int32 KeyframeInterval = DEFAULT_KEYFRAME_INTERVAL);
+
+	/**
+	 * Compute the state at the start of a turn (player 0, Purchase phase).
+	 * @param TurnNumber - Turn to seek to (clamped to the recorded range)
+	 * @param OutState - Receives the state
+	 * @param OutCommandIndex - Optional; receives the index of the next command to apply
+	 * @return True if the replay is valid
+	 */
+	bool SeekToTurn(int32 TurnNumber, FLairMatchState& OutState, int32* OutCommandIndex = nullptr) const;
+
+	/**
+	 * Compute the state after a number of commands.
+	 * @param CommandIndex - Commands to apply (clamped to the recorded range)
+	 * @param OutState - Receives the state
+	 * @return True if the replay is valid
+	 */
+	bool SeekToCommand(int32 CommandIndex, FLairMatchState& OutState) const;
+
+	/**
+	 * Write a replay file.
+	 * @param FilePath - Destination file
+	 * @param Rules - Rules the match was played with
+	 * @param Log - Recorded commands and seed
+	 * @return True if the file was written
+	 */
+	static bool SaveToFile(const FString& FilePath, const FLairMatchRules& Rules, const FLairCommandLog& Log);
+
+	/**
+	 * Read a replay file and build it.
+	 * @param FilePath - Replay file
+	 * @return True if the file was read and every command applied
+	 */
+	bool LoadFromFile(const FString& FilePath);
+
+	/** True once built */
+	bool IsValid() const { return Rules.IsValid() && Keyframes.Num() > 0; }
+
+	/** Rules the match was played with */
+	const TSharedPtr<const FLairMatchRules>& GetRules() const { return Rules; }
+
+	/** Recorded commands and seed */
+	const FLairCommandLog& GetCommandLog() const { return Log; }
+
+	/** Decoded commands */
+	const TArray<FLairCommand>& GetCommands() const { return Commands; }
+
+	/** Number of commands recorded */
+	int32 GetNumCommands() const { return Commands.Num(); }
+
+	/** Last turn reached by the recording */
+	int32 GetLastTurn() const { return TurnStarts.Num(); }
+
+	/** Index of the first command of a turn (turns start at 1) */
+	int32 GetTurnStartCommand(int32 TurnNumber) const
+	{
+		return TurnStarts[FMath::Clamp(TurnNumber, 1, TurnStarts.Num()) - 1];
+	}
+
+private:
+	/** State before a command */
+	struct FKeyframe
+	{
+		int32 CommandIndex = 0;
+		FLairMatchState State;
+	};
+
+	/** Rules the match was played with */
+	TSharedPtr<const FLairMatchRules> Rules;
+
+	/** Recorded commands and seed */
+	FLairCommandLog Log;
+
+	/** Commands decoded once so seeking never parses varints */
+	TArray<FLairCommand> Commands;
+
+	/** First command index of each turn (index 0 = turn 1) */
+	TArray<int32> TurnStarts;
+
+	/** Keyframes in command order (the first is the initial state) */
+	TArray<FKeyframe> Keyframes;
+};
@@ -0,0 +1,68 @@
+// LairSaveGame.h
+// Save Game (Compact Binary Match Saves)
+// Serializes only the dynamic match state, written to disk off the game thread.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LairMatchState.h"
+#include "LairCommandLog.h"
+
+/**
+ * Binary save format for a match in progress.
+ * Responsibilities:
+ * - Write a versioned header, then only what changes during play: tile type palette
+ *   indices, sub-slot occupancy, units by type, gold, turn state, RNG and deck order
+ * - Include the command log so replays and desync checks still work after a load
+ * - Reject files from another version, board or unit set instead of half-loading them
+ *
+ * Static data (unit stats, tile properties, card definitions) is never saved; it comes
+ * from the data tables through the match rules on load. A 10x10 match with a few dozen
+ * units saves in well under a kilobyte plus the command log.
+ */
+class LAIR_API FLairSaveGame
+{
+public:
+	/** "LSAV" */
+	static constexpr uint32 MAGIC = 0x5641534C;
+
+	/** Bump when the layout changes (older versions are refused) */
+	static constexpr uint16 VERSION = 2;
+
+	/**
+	 * Serialize a match.
+	 * @param State - Match state (from ALairGameMode::CaptureMatchState)
+	 * @param TileTypes - Tile type ID per tile index
+	 * @param Log - Command log of the match
+	 * @param OutBytes - Receives the save data
+	 */
+	static void Save(const FLairMatchState& State, const TArray<FName>& TileTypes, const FLairCommandLog& Log, TArray<uint8>& OutBytes);
+
+	/**
+	 * Deserialize a match.
+	 * @param Bytes - Save data
+	 * @param Rules - Rules of the running match (unit types are resolved by name against them)
+	 * @param OutState - Receives the match state
+	 * @param OutTileTypes - Receives the tile type ID per tile index
+	 * @param OutLog - Receives the command log
+	 * @return True if the data is a valid save for these rules
+	 */
+	static bool Load(const TArray<uint8>& Bytes, const TSharedPtr<const FLairMatchRules>& Rules,
+		FLairMatchState& OutState, TArray<FName>& OutTileTypes, FLairCommandLog& OutLog);
+
+	/**
+	 * Write save data to disk through a temporary file, so a crash mid-write never
+	 * leaves a truncated save. Safe to call from any thread.
+	 * @param FilePath - Destination file
+	 * @param Bytes - Save data
+	 * @return True if the file was written
+	 */
+	static bool WriteFile(const FString& FilePath, const TArray<uint8>& Bytes);
+
+	/**
+	 * Get the file used for a save slot.
+	 * @param SlotName - Slot name
+	 * @return Path under Saved/SaveGames
+	 */
+	static FString GetSlotPath(const FString& SlotName);
+};
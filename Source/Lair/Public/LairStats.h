@@ -0,0 +1,35 @@
+// LairStats.h
+// Stat Counters (stat lair)
+// Declares the STATGROUP_Lair cycle, memory and live actor counters.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+/** Runtime readout for test servers: "stat lair" in the console (cycle stats also show call counts) */
+DECLARE_STATS_GROUP(TEXT("Lair"), STATGROUP_Lair, STATCAT_Advanced);
+
+// Board queries
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Board GetTileAt"), STAT_LairGetTileAt, STATGROUP_Lair, LAIR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Board GetNeighborTiles"), STAT_LairGetNeighborTiles, STATGROUP_Lair, LAIR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Board GetMovementCost"), STAT_LairGetMovementCost, STATGROUP_Lair, LAIR_API);
+
+// Rules and economy
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Rules Check"), STAT_LairRulesCheck, STATGROUP_Lair, LAIR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Rules ValidateBatch"), STAT_LairRulesValidateBatch, STATGROUP_Lair, LAIR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Purchase"), STAT_LairPurchase, STATGROUP_Lair, LAIR_API);
+
+// Presentation
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Tile UpdateVisuals"), STAT_LairTileVisuals, STATGROUP_Lair, LAIR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Unit UpdateVisuals"), STAT_LairUnitVisuals, STATGROUP_Lair, LAIR_API);
+
+// Live actors
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Live Tiles"), STAT_LairLiveTiles, STATGROUP_Lair, LAIR_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Live Units"), STAT_LairLiveUnits, STATGROUP_Lair, LAIR_API);
+
+// Memory footprint
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Tile Memory"), STAT_LairTileMemory, STATGROUP_Lair, LAIR_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Unit Memory"), STAT_LairUnitMemory, STATGROUP_Lair, LAIR_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Board Memory"), STAT_LairBoardMemory, STATGROUP_Lair, LAIR_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Rules Cache Memory"), STAT_LairRulesMemory, STATGROUP_Lair, LAIR_API);
@@ -0,0 +1,86 @@
+// LairTournamentCommandlet.h
+// Tournament Commandlet (AI Self-Play)
+// Runs headless round-robin matches between AI policies and reports ratings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "LairTournamentCommandlet.generated.h"
+
+struct FLairMatchRules;
+class FLairCommandLog;
+class ILairAIPolicy;
+
+/**
+ * Commandlet that plays AI policies against each other on the headless match state.
+ * Responsibilities:
+ * - Schedule a round-robin of every policy pair, alternating who plays as player 0
+ * - Play matches in parallel across all worker threads (no world, no actors)
+ * - Derive every match from a fixed tournament seed so runs are reproducible
+ * - Report Elo ratings with 95% confidence intervals and throughput
+ * - Optionally write a replay file per match for review
+ *
+ * Usage:
+ *   UnrealEditor-Cmd Lair.uproject -run=LairTournament -Policies=Greedy,Random -Rounds=200
+ *     [-Seed=1] [-BoardSize=10] [-MaxTurns=200] [-MaxCommands=100000] [-Report=Saved/Tournament.json]
+ *     [-ReplayDir=Saved/Replays]
+ *
+ * -MaxTurns=0 plays without a turn limit; -MaxCommands still stops a match whose policies never finish it.
+ */
+UCLASS()
+class LAIR_API ULairTournamentCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	ULairTournamentCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+	/** Outcome of one scheduled match */
+	struct FMatchResult
+	{
+		int32 PolicyA = 0;
+		int32 PolicyB = 0;
+		/** 1 = A won, 0 = B won, 0.5 = draw */
+		float ScoreA = 0.5f;
+		int32 Turns = 0;
+		int32 Commands = 0;
+	};
+
+	/** Rating estimate for one policy */
+	struct FPolicyRating
+	{
+		FName PolicyName;
+		double Elo = 1500.0;
+		double ConfidenceInterval = 0.0;
+		int32 Wins = 0;
+		int32 Losses = 0;
+		int32 Draws = 0;
+	};
+
+	/**
+	 * Play one match to completion.
+	 * @param Rules - Shared rules
+	 * @param Seed - Match seed
+	 * @param Player0 - Policy for player 0
+	 * @param Player1 - Policy for player 1
+	 * @param MaxCommands - Commands after which the match is stopped as a draw
+	 * @param OutTurns - Turns played
+	 * @param OutCommands - Commands applied
+	 * @param OutLog - Optional; receives every applied command for a replay
+	 * @return Winning player index, or INDEX_NONE for a draw
+	 */
+	static int32 PlayMatch(const TSharedPtr<const FLairMatchRules>& Rules, uint64 Seed,
+		ILairAIPolicy& Player0, ILairAIPolicy& Player1, int32 MaxCommands, int32& OutTurns, int32& OutCommands,
+		FLairCommandLog* OutLog = nullptr);
+
+	/**
+	 * Fit Bradley-Terry strengths to the results and convert them to Elo (mean 1500).
+	 * @param PolicyNames - Policies in index order
+	 * @param Results - Match results
+	 * @return Ratings in index order
+	 */
+	static TArray<FPolicyRating> ComputeRatings(const TArray<FName>& PolicyNames, const TArray<FMatchResult>& Results);
+};
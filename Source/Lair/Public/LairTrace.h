@@ -0,0 +1,38 @@
+// LairTrace.h
+// Trace Channel (Unreal Insights)
+// Declares the Lair trace channel and the game events logged on it.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+/**
+ * Game events (phase changes, purchases, spawns) as Lair.GameEvent trace events.
+ * Enable with -trace=default,lair (the cpu channel carries the Lair CPU scopes).
+ */
+UE_TRACE_CHANNEL_EXTERN(LairChannel, LAIR_API);
+
+/**
+ * Writes Lair trace events. Use LAIR_TRACE_MARKER rather than calling this directly,
+ * so labels are only formatted while the channel is enabled.
+ */
+struct LAIR_API FLairTrace
+{
+	/**
+	 * Log a Lair.GameEvent (cycle timestamp and label) on LairChannel.
+	 * @param Label - Event description
+	 */
+	static void OutputGameEvent(const FString& Label);
+};
+
+/** Game event with a formatted label; the label is only built while the Lair channel is enabled */
+#define LAIR_TRACE_MARKER(Format, ...) \
+	do \
+	{ \
+		if (UE_TRACE_CHANNELEXPR_IS_ENABLED(LairChannel)) \
+		{ \
+			FLairTrace::OutputGameEvent(FString::Printf(Format, ##__VA_ARGS__)); \
+		} \
+	} while (0)
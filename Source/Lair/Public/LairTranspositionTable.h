@@ -0,0 +1,138 @@
+// LairTranspositionTable.h
+// Transposition Table (Shared AI Search Cache)
+// Fixed-size, lock-free position cache shared by all AI search threads.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * One cached search result.
+ */
+struct FLairTTEntry
+{
+	/** Mean value from the searching player's point of view, in [-1, 1] */
+	float Value = 0.0f;
+
+	/** Visits (saturates at 65535) */
+	uint16 Visits = 0;
+
+	/** Index of the best command in the position's legal command list */
+	uint16 BestAction = 0;
+
+	/** Remaining search depth the value was computed with */
+	uint8 Depth = 0;
+};
+
+/**
+ * Lock-free transposition table keyed by 64-bit position hash.
+ *
+ * Each slot stores two 64-bit words: the packed entry and (key XOR entry). Writers
+ * store both words without locking; readers accept a slot only if the XOR checks
+ * out, so a torn read caused by a concurrent write is reported as a miss instead of
+ * returning the wrong position's data (Hyatt & Mann lockless hashing).
+ *
+ * Slots are grouped in 64-byte buckets of four. A store replaces, in order: the
+ * same key, an empty slot, then the slot from the oldest search generation with
+ * the least depth and visits.
+ *
+ * Hit-rate counters are sharded per thread so probes never contend on a shared line.
+ */
+class LAIR_API FLairTranspositionTable
+{
+public:
+	FLairTranspositionTable() = default;
+	~FLairTranspositionTable();
+
+	FLairTranspositionTable(const FLairTranspositionTable&) = delete;
+	FLairTranspositionTable& operator=(const FLairTranspositionTable&) = delete;
+
+	/**
+	 * Allocate the table (discarding its contents). Not thread-safe.
+	 * @param SizeInMegabytes - Memory budget (rounded down to a power of two bucket count)
+	 */
+	void Resize(int32 SizeInMegabytes);
+
+	/** Clear all entries and counters. Not thread-safe. */
+	void Clear();
+
+	/** Start a new search generation so older entries are replaced first */
+	void NewSearch() { Generation.fetch_add(1, std::memory_order_relaxed); }
+
+	/**
+	 * Look up a position.
+	 * @param Key - Position hash
+	 * @param OutEntry - Receives the entry on a hit
+	 * @return True on a verified hit
+	 */
+	bool Probe(uint64 Key, FLairTTEntry& OutEntry) const;
+
+	/**
+	 * Store a position.
+	 * @param Key - Position hash
+	 * @param Entry - Data to store
+	 */
+	void Store(uint64 Key, const FLairTTEntry& Entry);
+
+	/**
+	 * Add one rollout result to a position's running mean (a lost race drops one sample).
+	 * @param Key - Position hash
+	 * @param Value - Result in [-1, 1]
+	 * @param Depth - Search depth of the sample
+	 */
+	void AddSample(uint64 Key, float Value, uint8 Depth);
+
+	/** Number of slots */
+	int32 GetNumEntries() const { return NumBuckets * EntriesPerBucket; }
+
+	/** Probes since the last Clear */
+	uint64 GetNumProbes() const;
+
+	/** Verified hits since the last Clear */
+	uint64 GetNumHits() const;
+
+	/** Hits / probes (0 if nothing was probed) */
+	double GetHitRate() const;
+
+private:
+	static constexpr int32 EntriesPerBucket = 4;
+	static constexpr int32 NumCounterShards = 64;
+
+	struct FSlot
+	{
+		std::atomic<uint64> KeyXorData { 0 };
+		std::atomic<uint64> Data { 0 };
+	};
+
+	struct alignas(64) FBucket
+	{
+		FSlot Slots[EntriesPerBucket];
+	};
+
+	struct alignas(64) FCounterShard
+	{
+		std::atomic<uint64> Probes { 0 };
+		std::atomic<uint64> Hits { 0 };
+	};
+
+	/** Pack an entry with the current generation */
+	uint64 Pack(const FLairTTEntry& Entry) const;
+
+	/** Unpack an entry */
+	static void Unpack(uint64 Data, FLairTTEntry& OutEntry);
+
+	/** Generation stored in packed data */
+	static uint8 GetGeneration(uint64 Data) { return static_cast<uint8>(Data >> 56); }
+
+	/** Bucket for a key */
+	FBucket& GetBucket(uint64 Key) const { return Buckets[Key & (NumBuckets - 1)]; }
+
+	/** Counter shard for the calling thread */
+	FCounterShard& GetCounterShard() const { return CounterShards[FPlatformTLS::GetCurrentThreadId() % NumCounterShards]; }
+
+	FBucket* Buckets = nullptr;
+	int32 NumBuckets = 0;
+	std::atomic<uint8> Generation { 0 };
+	mutable FCounterShard CounterShards[NumCounterShards];
+};
@@ -0,0 +1,119 @@
+// LairUndoStack.h
+// Undo Stack (Per-Action Deltas)
+// Bounded undo/redo history of the changes each game action made.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LairDataStructs.h"
+#include "LairMatchState.h"
+
+/**
+ * Per-turn unit fields, restored when a phase or turn hand-over is undone
+ * (the incoming player's units are refreshed when the turn starts)
+ */
+struct FLairUndoUnitState
+{
+	uint16 UnitIndex = 0;
+	uint8 RemainingMovement = 0;
+	uint8 bHasMined = 0;
+};
+
+/**
+ * What one action changed, enough to apply its inverse.
+ */
+struct FLairUndoRecord
+{
+	/** Action that was executed (re-executed on redo) */
+	FLairCommand Command;
+
+	/** Command log size before the action */
+	int32 LogOffset = 0;
+
+	/** Gold per player before and after the action */
+	int32 GoldBefore[LairConstants::MAX_PLAYERS] = {};
+	int32 GoldAfter[LairConstants::MAX_PLAYERS] = {};
+
+	/** Turn state before the action */
+	ETurnPhase PhaseBefore = ETurnPhase::Purchase;
+	int32 PlayerBefore = 0;
+	int32 TurnBefore = 1;
+
+	/** Unit spawned (Purchase) or moved (Move) */
+	int32 UnitIndex = INDEX_NONE;
+
+	/** Where the unit stood before a move, or where a purchase placed it */
+	int32 TileIndex = INDEX_NONE;
+	int32 SubSlotIndex = 0;
+
+	/** Movement before a move */
+	int32 MovementBefore = 0;
+
+	/** Acting player's units before a phase or turn change */
+	TArray<FLairUndoUnitState> TurnUnits;
+};
+
+/**
+ * Fixed-capacity undo/redo history.
+ * Responsibilities:
+ * - Keep the newest records up to a capacity, dropping the oldest (memory is bounded)
+ * - Keep undone records for redo until a new action is recorded
+ *
+ * Records live in a ring buffer; undo and redo only move a cursor.
+ */
+class LAIR_API FLairUndoStack
+{
+public:
+	/**
+	 * Set the number of levels kept (clears the history).
+	 * @param InCapacity - Maximum undo levels
+	 */
+	void SetCapacity(int32 InCapacity);
+
+	/** Drop all history */
+	void Reset() { Start = 0; Cursor = 0; Count = 0; }
+
+	/**
+	 * Record an executed action.
+	 * @param Record - What the action changed
+	 * @param bFromRedo - True if the action is the next redo record being replayed (later redo records are kept)
+	 */
+	void Push(FLairUndoRecord&& Record, bool bFromRedo = false);
+
+	/**
+	 * Step back over the newest undoable record.
+	 * @return The record to revert
+	 */
+	const FLairUndoRecord& Undo();
+
+	/** Get the record the next redo will re-execute */
+	const FLairUndoRecord& PeekRedo() const { return Records[GetSlot(Cursor)]; }
+
+	/** Drop all redo records */
+	void ClearRedo() { Count = Cursor; }
+
+	/** True if there is something to undo */
+	bool CanUndo() const { return Cursor > 0; }
+
+	/** True if there is something to redo */
+	bool CanRedo() const { return Cursor < Count; }
+
+	/** Number of undo levels available */
+	int32 GetNumUndo() const { return Cursor; }
+
+private:
+	/** Ring buffer of records */
+	TArray<FLairUndoRecord> Records;
+
+	/** Slot of the oldest record */
+	int32 Start = 0;
+
+	/** Records before the cursor can be undone */
+	int32 Cursor = 0;
+
+	/** Records held (after the cursor: redo) */
+	int32 Count = 0;
+
+	/** Ring slot of a logical position */
+	int32 GetSlot(int32 Position) const { return (Start + Position) % Records.Num(); }
+};
@@ -0,0 +1,67 @@
+// LairValidateDataCommandlet.h
+// Data Validation Commandlet (Content Checks)
+// Loads every Lair data table and board layout, validates them in parallel and writes a JSON report.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "LairDataStructs.h"
+#include "LairValidateDataCommandlet.generated.h"
+
+/**
+ * Commandlet that catches bad data rows before they reach a match.
+ * Responsibilities:
+ * - Find every data table under the content path and sort them by row struct
+ * - Check unit rows (costs, hit points, dice faces, sub-slot sizes a base tile can hold)
+ * - Check board layouts in parallel: unknown tile types, duplicate or missing coordinates,
+ *   missing or duplicate player bases, bases on unwalkable tiles, and bases that cannot
+ *   reach each other over walkable tiles
+ * - Write a machine-readable report and fail (exit code 1) on any error
+ *
+ * Usage:
+ *   UnrealEditor-Cmd Lair.uproject -run=LairValidateData [-Path=/Game] [-Report=Saved/DataValidation.json]
+ *     [-WarningsAsErrors]
+ */
+UCLASS()
+class LAIR_API ULairValidateDataCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	ULairValidateDataCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+	/** One finding */
+	struct FIssue
+	{
+		/** Asset path of the table */
+		FString Asset;
+		/** Offending row (NAME_None for table-wide issues) */
+		FName Row;
+		bool bError = true;
+		FString Message;
+	};
+
+	/**
+	 * Check the rows of a unit table.
+	 * @param Asset - Table path (for the report)
+	 * @param RowNames - Row names
+	 * @param Rows - Rows, parallel to RowNames
+	 * @param OutIssues - Receives findings
+	 */
+	static void ValidateUnits(const FString& Asset, const TArray<FName>& RowNames, const TArray<const FUnitData*>& Rows,
+		TArray<FIssue>& OutIssues);
+
+	/**
+	 * Check one board layout against the known tile types.
+	 * @param Asset - Layout path (for the report)
+	 * @param RowNames - Row names
+	 * @param Rows - Rows, parallel to RowNames
+	 * @param TileTypeFlags - ELairTileFlags per known tile type
+	 * @param OutIssues - Receives findings
+	 */
+	static void ValidateLayout(const FString& Asset, const TArray<FName>& RowNames, const TArray<const FBoardLayoutRow*>& Rows,
+		const TMap<FName, uint8>& TileTypeFlags, TArray<FIssue>& OutIssues);
+};
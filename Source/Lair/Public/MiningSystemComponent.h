@@ -0,0 +1,173 @@
+// MiningSystemComponent.h
+// Mining System Component (Mining Deck)
+// Draws mining cards for miners and manages the shared mining deck.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "LairDataStructs.h"
+#include "LairRandom.h"
+#include "MiningSystemComponent.generated.h"
+
+// Forward declarations
+class AUnit;
+class ATile;
+
+/**
+ * Result of a single mining draw
+ */
+USTRUCT(BlueprintType)
+struct FMiningResult
+{
+	GENERATED_BODY()
+
+	/** Outcome category of the drawn card */
+	UPROPERTY(BlueprintReadOnly, Category = "Mining")
+	EMiningOutcome OutcomeType = EMiningOutcome::MinedOut;
+
+	/** Mineral, treasure or monster ID from the card */
+	UPROPERTY(BlueprintReadOnly, Category = "Mining")
+	FName OutcomeID = NAME_None;
+
+	/** Gold value for minerals */
+	UPROPERTY(BlueprintReadOnly, Category = "Mining")
+	int32 GoldValue = 0;
+
+	/** True if a monster was spawned (monsters are not implemented yet) */
+	UPROPERTY(BlueprintReadOnly, Category = "Mining")
+	bool bSpawnedMonster = false;
+};
+
+/**
+ * Mining deck state: a permutation of compact card indices into a shared, immutable card table.
+ * Draws are O(1); the deck is reshuffled in place (Fisher-Yates) only when it runs out.
+ * Copying a deck copies only the order and position (no heap allocation for decks up to
+ * 128 cards), which makes it a cheap snapshot for AI search.
+ */
+struct LAIR_API FMiningDeck
+{
+	/** Card definitions shared by every copy of this deck */
+	TSharedPtr<const TArray<FMiningCardData>> CardTable;
+
+	/** Deck order as indices into CardTable */
+	TArray<uint16, TInlineAllocator<128>> Order;
+
+	/** Position of the next card to draw */
+	int32 CurrentCardIndex = 0;
+
+	/**
+	 * Build the deck from a card table and shuffle it.
+	 * @param InCardTable - Distinct cards (CopiesInDeck of each are added)
+	 * @param Stream - Random stream used for the shuffle
+	 */
+	void Initialize(TSharedPtr<const TArray<FMiningCardData>> InCardTable, FLairRandomStream& Stream);
+
+	/**
+	 * Draw the next card index, reshuffling first if the deck is exhausted.
+	 * @param Stream - Random stream used if a reshuffle is needed
+	 * @return Index into CardTable, or INDEX_NONE if the deck has no cards
+	 */
+	int32 DrawIndex(FLairRandomStream& Stream);
+
+	/** Reshuffle all cards in place and reset the draw position */
+	void Reshuffle(FLairRandomStream& Stream);
+
+	/** Get a card definition by index */
+	const FMiningCardData& GetCard(int32 CardIndex) const { return (*CardTable)[CardIndex]; }
+
+	/** Cards left before the next reshuffle */
+	int32 GetRemainingCards() const { return Order.Num() - CurrentCardIndex; }
+
+	/** Total cards in the deck */
+	int32 Num() const { return Order.Num(); }
+};
+
+/**
+ * Component that manages the mining deck (Phase 2+).
+ * Responsibilities:
+ * - Build the card table from DT_MiningCards (or defaults)
+ * - Draw cards for miners in O(1)
+ * - Reshuffle in place when the deck runs out
+ * - Expose deck snapshots for AI search
+ *
+ * Rule validation (is the miner on a mining tile, has it mined this turn) is the caller's job.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class LAIR_API UMiningSystemComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UMiningSystemComponent();
+
+	/**
+	 * Initialize the deck from the mining cards data table.
+	 * @param InMiningCardsTable - DT_MiningCards (null for default deck)
+	 * @param InRandomStream - Match RNG mining stream (owned by the game mode)
+	 */
+	void Initialize(UDataTable* InMiningCardsTable, FLairRandomStream* InRandomStream);
+
+	/**
+	 * Draw a mining card for a miner and resolve its outcome.
+	 * @param Miner - Unit doing the mining
+	 * @param MiningTile - Tile being mined
+	 * @return Mining result
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Mining")
+	FMiningResult DrawMiningCard(AUnit* Miner, ATile* MiningTile);
+
+	/**
+	 * Draw the next card without resolving it (hot path for simulation).
+	 * @return Card definition (valid until the card table is rebuilt)
+	 */
+	const FMiningCardData* DrawCard();
+
+	/**
+	 * Reshuffle the full deck.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Mining")
+	void ShuffleMiningDeck();
+
+	/**
+	 * Get cards left before the next reshuffle.
+	 * @return Remaining card count
+	 */
+	UFUNCTION(BlueprintPure, Category = "Mining")
+	int32 GetRemainingCards() const { return Deck.GetRemainingCards(); }
+
+	/** Get the live deck state (copy it to take a snapshot) */
+	const FMiningDeck& GetDeck() const { return Deck; }
+
+	/** Restore a previously captured deck state */
+	void RestoreDeck(const FMiningDeck& Snapshot);
+
+	/** Get the shared immutable card table */
+	TSharedPtr<const TArray<FMiningCardData>> GetCardTable() const { return Deck.CardTable; }
+
+	/** Build the default card table used when no data table is assigned */
+	static TSharedPtr<const TArray<FMiningCardData>> MakeDefaultCardTable();
+
+protected:
+	/** Mining cards data table */
+	UPROPERTY()
+	UDataTable* MiningCardsDataTable;
+
+	/** Live deck */
+	FMiningDeck Deck;
+
+	/** Match RNG mining stream (not owned) */
+	FLairRandomStream* RandomStream;
+
+	/** Stream used when no match stream was provided */
+	FLairRandomStream LocalStream;
+
+	/** Build the immutable card table from the data table or defaults */
+	TSharedPtr<const TArray<FMiningCardData>> BuildCardTable() const;
+
+	/** Get the stream to draw from */
+	FLairRandomStream& GetStream() { return RandomStream ? *RandomStream : LocalStream; }
+
+	/** Fill a result from a drawn card */
+	void ResolveMiningOutcome(const FMiningCardData& CardData, AUnit* Miner, ATile* Tile, FMiningResult& OutResult) const;
+};
@@ -7,11 +7,117 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "LairDataStructs.h"
+#include "LairMatchState.h"
 #include "RulesEngineComponent.generated.h"
 
 // Forward declarations
 class ATile;
 class AUnit;
+class UBoardSystemComponent;
+
+/**
+ * One candidate action for URulesEngineComponent::ValidateBatch
+ */
+struct FLairRulesCandidate
+{
+	/** Unit type to buy or place (dense rules table ID) */
+	uint8 UnitTypeId = FLairRulesTable::INVALID_ID;
+
+	/** Also require the player to afford the unit */
+	bool bPurchase = false;
+
+	/** Tile that must hold the unit (nullptr skips the space check) */
+	const ATile* Tile = nullptr;
+
+	FLairRulesCandidate() = default;
+	FLairRulesCandidate(uint8 InUnitTypeId, bool bInPurchase, const ATile* InTile)
+		: UnitTypeId(InUnitTypeId), bPurchase(bInPurchase), Tile(InTile)
+	{
+	}
+};
+
+/** Native delegate for data table edits folded into the rules table (IDs of the changed types) */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnRulesDataChangedNative, const TArray<uint8>& /*ChangedUnitTypes*/, const TArray<uint8>& /*ChangedTileTypes*/);
+
+/**
+ * Rules data compiled from the data tables once per load.
+ * Types get dense uint8 IDs (table row order); hot fields live in contiguous POD arrays
+ * indexed by ID, so validation reads a few bytes instead of hashing a name and copying a row.
+ */
+struct LAIR_API FLairRulesTable
+{
+	/** ID returned for unknown type names */
+	static constexpr uint8 INVALID_ID = MAX_uint8;
+
+	/** Unit type names, indexed by unit type ID */
+	TArray<FName> UnitTypeNames;
+
+	/** Hot unit fields (cost, movement, HP, size, can-mine), indexed by unit type ID */
+	TArray<FLairUnitTypeStats> UnitStats;
+
+	/** Combat hit faces (bit N = face N+1 hits), indexed by unit type ID */
+	TArray<uint8> UnitHitFaceMasks;
+
+	/** Full unit rows (display names, dice), indexed by unit type ID; heap-stable, units point at them */
+	TIndirectArray<FUnitData> UnitRows;
+
+	/** Tile type names, indexed by tile type ID */
+	TArray<FName> TileTypeNames;
+
+	/** ELairTileFlags, indexed by tile type ID */
+	TArray<uint8> TileFlags;
+
+	/** Full tile rows (display names, colors), indexed by tile type ID; heap-stable, tiles point at them */
+	TIndirectArray<FTileTypeData> TileRows;
+
+	/** Name -> ID lookups */
+	TMap<FName, uint8> UnitTypeIds;
+	TMap<FName, uint8> TileTypeIds;
+
+	/** Drop all compiled data */
+	void Reset();
+
+	/** Add a unit type (ignored past 255 types) */
+	void AddUnitType(FName UnitTypeID, const FUnitData& Row);
+
+	/** Add a tile type (ignored past 255 types) */
+	void AddTileType(FName TileTypeID, const FTileTypeData& Row);
+
+	/**
+	 * Overwrite a unit type in place (its ID and row address stay the same).
+	 * @return True if the row differed
+	 */
+	bool UpdateUnitType(uint8 UnitTypeId, const FUnitData& Row);
+
+	/**
+	 * Overwrite a tile type in place (its ID and row address stay the same).
+	 * @return True if the row differed
+	 */
+	bool UpdateTileType(uint8 TileTypeId, const FTileTypeData& Row);
+
+	/** Find a unit type ID by name (INVALID_ID if unknown) */
+	uint8 FindUnitType(FName UnitTypeID) const
+	{
+		const uint8* Id = UnitTypeIds.Find(UnitTypeID);
+		return Id ? *Id : INVALID_ID;
+	}
+
+	/** Find a tile type ID by name (INVALID_ID if unknown) */
+	uint8 FindTileType(FName TileTypeID) const
+	{
+		const uint8* Id = TileTypeIds.Find(TileTypeID);
+		return Id ? *Id : INVALID_ID;
+	}
+
+	/** Number of unit types */
+	int32 NumUnitTypes() const { return UnitTypeNames.Num(); }
+
+	/** Number of tile types */
+	int32 NumTileTypes() const { return TileTypeNames.Num(); }
+
+	/** Heap memory held by the compiled data (for stat lair) */
+	SIZE_T GetAllocatedSize() const;
+};
 
 /**
  * Component that validates game actions according to rules.
@@ -20,7 +126,8 @@ class AUnit;
  * - Validate unit placement (sub-slot availability)
  * - Validate movement (Phase 2+)
  * - Validate actions based on current phase
- * - Load and cache unit data from Data Tables
+ * - Compile unit and tile data from Data Tables into a dense rules table
+ * - Fold data table edits into the rules table row by row (editor hot-reload, queued while a match runs)
  */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class LAIR_API URulesEngineComponent : public UActorComponent
@@ -30,6 +137,8 @@ class LAIR_API URulesEngineComponent : public UActorComponent
 public:
 	URulesEngineComponent();
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	// ========================================================================
 	// Initialization
 	// ========================================================================
@@ -42,6 +151,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Rules")
 	void Initialize(UDataTable* InUnitsTable, UDataTable* InTileTypesTable);
 
+	/** Set the board whose per-tile flags answer tile queries */
+	void SetBoardSystem(UBoardSystemComponent* InBoardSystem) { BoardSystem = InBoardSystem; }
+
 	// ========================================================================
 	// Stable API - DO NOT MODIFY SIGNATURES
 	// ========================================================================
@@ -83,7 +195,7 @@ public:
 	 * @return Unit data struct (empty if not found)
 	 */
 	UFUNCTION(BlueprintPure, Category = "Rules")
-	FUnitData GetUnitData(FName UnitTypeID) const;
+	const FUnitData& GetUnitData(FName UnitTypeID) const;
 
 	/**
 	 * Get tile type data from data table.
@@ -91,7 +203,7 @@ public:
 	 * @return Tile type data struct (empty if not found)
 	 */
 	UFUNCTION(BlueprintPure, Category = "Rules")
-	FTileTypeData GetTileTypeData(FName TileTypeID) const;
+	const FTileTypeData& GetTileTypeData(FName TileTypeID) const;
 
 	/**
 	 * Check if a tile is walkable.
@@ -103,11 +215,98 @@ public:
 
 	/**
 	 * Get all available unit types from data table.
-	 * @return Array of unit type IDs
+	 * @return Array of unit type IDs, in dense ID order
 	 */
 	UFUNCTION(BlueprintPure, Category = "Rules")
 	TArray<FName> GetAllUnitTypes() const;
 
+	// ========================================================================
+	// Compiled Rules (dense IDs)
+	// ========================================================================
+
+	/** Compiled rules table (rebuilt by CacheDataFromTables) */
+	const FLairRulesTable& GetRulesTable() const { return RulesTable; }
+
+	/** Find a unit type ID by name (FLairRulesTable::INVALID_ID if unknown) */
+	uint8 FindUnitTypeId(FName UnitTypeID) const { return RulesTable.FindUnitType(UnitTypeID); }
+
+	/** Find a tile type ID by name (FLairRulesTable::INVALID_ID if unknown) */
+	uint8 FindTileTypeId(FName TileTypeID) const { return RulesTable.FindTileType(TileTypeID); }
+
+	/**
+	 * Check if player can afford a unit type (ID-based CanAffordUnit).
+	 * @param PlayerGold - Current gold amount
+	 * @param UnitTypeId - Dense unit type ID
+	 * @return True if player has enough gold
+	 */
+	bool CanAffordUnitType(int32 PlayerGold, uint8 UnitTypeId) const;
+
+	/**
+	 * Validate many candidate actions at once (UI button states, AI move filtering).
+	 * Gold is read once and each tile's free sub-slots are gathered once per run of
+	 * candidates on that tile; only failures are logged (never in shipping builds).
+	 * @param PlayerGold - Gold of the acting player
+	 * @param Candidates - Actions to check
+	 * @param OutResults - Bit i set if candidate i passes (resized to Candidates.Num())
+	 * @return Number of candidates that pass
+	 */
+	int32 ValidateBatch(int32 PlayerGold, TConstArrayView<FLairRulesCandidate> Candidates, TBitArray<>& OutResults) const;
+
+	/**
+	 * Check which unit types a player could buy right now (for greying out purchase buttons).
+	 * @param PlayerGold - Current gold amount
+	 * @param SpawnTile - The player's base tile
+	 * @return One entry per unit type, in GetAllUnitTypes order
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Rules")
+	TArray<bool> GetPurchasableUnitTypes(int32 PlayerGold, ATile* SpawnTile) const;
+
+	/** Check that a unit type ID exists */
+	bool IsValidUnitTypeId(uint8 UnitTypeId) const { return RulesTable.UnitStats.IsValidIndex(UnitTypeId); }
+
+	/** Hot stats of a unit type (UnitTypeId must be valid) */
+	const FLairUnitTypeStats& GetUnitStats(uint8 UnitTypeId) const { return RulesTable.UnitStats[UnitTypeId]; }
+
+	/** Full row of a unit type (UnitTypeId must be valid) */
+	const FUnitData& GetUnitDataById(uint8 UnitTypeId) const { return RulesTable.UnitRows[UnitTypeId]; }
+
+	/** Name of a unit type (UnitTypeId must be valid) */
+	FName GetUnitTypeName(uint8 UnitTypeId) const { return RulesTable.UnitTypeNames[UnitTypeId]; }
+
+	/** ELairTileFlags of a tile type (None if the ID is unknown) */
+	uint8 GetTileTypeFlags(uint8 TileTypeId) const
+	{
+		return RulesTable.TileFlags.IsValidIndex(TileTypeId) ? RulesTable.TileFlags[TileTypeId] : static_cast<uint8>(ELairTileFlags::None);
+	}
+
+	/** Shared row of a tile type (nullptr if the ID is unknown) */
+	const FTileTypeData* FindTileTypeRow(uint8 TileTypeId) const
+	{
+		return RulesTable.TileRows.IsValidIndex(TileTypeId) ? &RulesTable.TileRows[TileTypeId] : nullptr;
+	}
+
+	// ========================================================================
+	// Hot Reload
+	// ========================================================================
+
+	/**
+	 * Re-read both data tables and update only the rows that differ.
+	 * Runs automatically when a table changes in the editor. IDs never move: new rows are
+	 * appended and removed rows keep their last data, since live units may still use them.
+	 * While edits are deferred the refresh is queued instead.
+	 */
+	void RefreshFromTables();
+
+	/**
+	 * Hold table edits back while the shown match cannot take new rules (a replay plays back
+	 * the rules it was recorded under). Releasing applies anything queued meanwhile.
+	 * @param bDefer - True to queue edits, false to apply them (and any queued ones)
+	 */
+	void SetDeferTableEdits(bool bDefer);
+
+	/** Rows changed by RefreshFromTables (one broadcast per refresh) */
+	FOnRulesDataChangedNative OnRulesDataChangedNative;
+
 protected:
 	/** Cached units data table */
 	UPROPERTY()
@@ -117,14 +316,32 @@ protected:
 	UPROPERTY()
 	UDataTable* TileTypesDataTable;
 
-	/** Cached unit data for quick lookup */
+	/** Board owning the per-tile flags */
 	UPROPERTY()
-	TMap<FName, FUnitData> CachedUnitData;
+	UBoardSystemComponent* BoardSystem = nullptr;
 
-	/** Cached tile type data for quick lookup */
-	UPROPERTY()
-	TMap<FName, FTileTypeData> CachedTileTypeData;
+	/** Unit and tile data compiled from the tables */
+	FLairRulesTable RulesTable;
 
-	/** Cache all data from tables */
+	/** Compile all data from tables */
 	void CacheDataFromTables();
+
+	/** Queue table edits instead of applying them */
+	bool bDeferTableEdits = false;
+
+	/** A table changed while edits were deferred */
+	bool bTableEditsPending = false;
+
+	/** Fold the current table rows into the rules table */
+	void ApplyTableEdits();
+
+	/** Data table change subscriptions */
+	FDelegateHandle UnitsTableChangedHandle;
+	FDelegateHandle TileTypesTableChangedHandle;
+
+	/** Subscribe to change notifications of the current tables (editor only) */
+	void BindTableChangeNotifications();
+
+	/** Drop the change subscriptions */
+	void UnbindTableChangeNotifications();
 };
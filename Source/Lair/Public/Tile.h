@@ -29,6 +29,7 @@ public:
 	ATile();
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	// ========================================================================
 	// Properties
@@ -138,10 +139,9 @@ public:
 	/**
 	 * Set tile type data (called by BoardSystem during spawn).
 	 * Used for DebugColor and other tile type properties.
-	 * @param InTileTypeData - Tile type data from data table
+	 * @param InTileTypeData - Shared data table row (not copied; must outlive the tile), or nullptr for defaults
 	 */
-	UFUNCTION(BlueprintCallable, Category = "Tile")
-	void SetTileTypeData(const FTileTypeData& InTileTypeData);
+	void SetTileTypeData(const FTileTypeData* InTileTypeData);
 
 	/**
 	 * Find an available sub-slot for a unit of the given size.
@@ -151,6 +151,26 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Tile")
 	int32 FindAvailableSubSlot(int32 SubSlotSize) const;
 
+	/**
+	 * Get the empty sub-slots as a bitmask.
+	 * @return Bit N set if sub-slot N is empty
+	 */
+	uint8 GetFreeSubSlotMask() const;
+
+	/**
+	 * Check if a unit fits a set of empty sub-slots (same rules as CanPlaceUnit).
+	 * @param FreeMask - Bit N set if sub-slot N is empty (see GetFreeSubSlotMask)
+	 * @param SubSlotSize - Size of the unit (1 for normal, 2 for wagons)
+	 * @return True if the unit fits
+	 */
+	static bool CanFitSubSlots(uint8 FreeMask, int32 SubSlotSize);
+
+	/**
+	 * Get the tile type data this tile was spawned with (shared by every tile of this type).
+	 * @return Tile type data (walkable, mining, gate, outpost flags)
+	 */
+	const FTileTypeData& GetTileTypeData() const;
+
 protected:
 	/** Units occupying each sub-slot (index 0-3) */
 	UPROPERTY()
@@ -160,8 +180,8 @@ protected:
 	UPROPERTY()
 	UMaterialInstanceDynamic* DynamicMaterial;
 
-	/** Cached tile type data for visuals (DebugColor, etc.) */
-	FTileTypeData CachedTileTypeData;
+	/** Shared tile type record for visuals (DebugColor, etc.), not owned */
+	const FTileTypeData* TileTypeData = nullptr;
 
 	/** Update visual representation */
 	void UpdateVisuals();
@@ -7,6 +7,7 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "LairDataStructs.h"
+#include "LairEventBus.h"
 #include "TurnManagerComponent.generated.h"
 
 /** Delegate for phase changes */
@@ -24,7 +25,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnTurnChanged, int32, NewTurnNumber
  * - Track current turn phase
  * - Track current player index
  * - Advance phases and players
- * - Broadcast phase/player change events
+ * - Post phase/player/turn change events (event bus when set, delegates otherwise)
  * - Count total turns
  */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
@@ -97,6 +98,22 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Turn")
 	int32 GetTotalPlayers() const { return TotalPlayers; }
 
+	/**
+	 * Jump straight to a turn, player and phase (loading and replay seeking).
+	 * Posts phase, player and turn events as if the game had played there.
+	 * @param InPlayerIndex - Current player
+	 * @param InPhase - Current phase
+	 * @param InTurnNumber - Turn number
+	 */
+	void RestoreTurnState(int32 InPlayerIndex, ETurnPhase InPhase, int32 InTurnNumber);
+
+	/**
+	 * Route change events through an event bus. The Blueprint delegates below
+	 * become presentation listeners on the bus and fire once per flush.
+	 * @param InEventBus - Bus owned by the game mode (null to broadcast immediately)
+	 */
+	void SetEventBus(FLairEventBus* InEventBus);
+
 	// ========================================================================
 	// Events
 	// ========================================================================
@@ -135,4 +152,10 @@ protected:
 
 	/** Advance to the next player */
 	void AdvancePlayer();
+
+	/** Event bus (not owned, may be null) */
+	FLairEventBus* EventBus = nullptr;
+
+	/** Forward a bus event to the Blueprint delegates */
+	void ForwardEventToDelegates(const FLairEvent& Event);
 };
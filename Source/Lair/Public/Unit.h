@@ -16,7 +16,7 @@ class ATile;
  * Represents a game piece (unit) on the board.
  * Responsibilities:
  * - Represent game pieces (Miner, Footman, Wagon)
- * - Load stats from Data Table
+ * - Reference shared, immutable type data (one record per unit type)
  * - Track current tile and sub-slot position
  * - Visual mesh representation
  */
@@ -29,6 +29,7 @@ public:
 	AUnit();
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	// ========================================================================
 	// Properties
@@ -38,10 +39,6 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Unit")
 	FName UnitTypeID;
 
-	/** Cached unit data from data table */
-	UPROPERTY(BlueprintReadOnly, Category = "Unit")
-	FUnitData CachedUnitData;
-
 	/** Owner player index (0 or 1) */
 	UPROPERTY(BlueprintReadWrite, Category = "Unit")
 	int32 OwnerPlayerIndex = 0;
@@ -62,6 +59,10 @@ public:
 	UPROPERTY(BlueprintReadWrite, Category = "Unit")
 	int32 CurrentHP = 1;
 
+	/** Has this unit drawn a mining card this turn? (Phase 2+) */
+	UPROPERTY(BlueprintReadWrite, Category = "Unit|Phase2")
+	bool bHasMinedThisTurn = false;
+
 	// ========================================================================
 	// Visual Components
 	// ========================================================================
@@ -124,7 +125,27 @@ public:
 	 * @return Sub-slot size (1 for normal, 2 for wagons)
 	 */
 	UFUNCTION(BlueprintPure, Category = "Unit")
-	int32 GetSubSlotSize() const { return CachedUnitData.SubSlotSize; }
+	int32 GetSubSlotSize() const { return GetUnitTypeData().SubSlotSize; }
+
+	/**
+	 * Initialize unit from a shared type record (no per-unit copy).
+	 * @param InUnitTypeID - Row name from DT_Units
+	 * @param InTypeData - Shared record; must outlive the unit (e.g. a rules table row)
+	 */
+	void InitializeFromTypeData(FName InUnitTypeID, const FUnitData* InTypeData);
+
+	/**
+	 * Get the unit's type data (shared by every unit of this type).
+	 * @return Type data (defaults if the unit is not initialized)
+	 */
+	UFUNCTION(BlueprintPure, Category = "Unit")
+	const FUnitData& GetUnitTypeData() const;
+
+	/**
+	 * Re-apply what the unit derives from its type record (size, visuals) after the record was edited.
+	 * HP and remaining movement are per-instance state and pick up new maximums at the next reset.
+	 */
+	void RefreshTypeData();
 
 	/**
 	 * Set selection highlight.
@@ -145,6 +166,12 @@ protected:
 	UPROPERTY()
 	UMaterialInstanceDynamic* DynamicMaterial;
 
+	/** Shared type record (not owned) */
+	const FUnitData* TypeData = nullptr;
+
+	/** Private copy, only for units initialized from a loose struct (InitializeFromDataTable) */
+	TUniquePtr<FUnitData> OwnedTypeData;
+
 	/** Update visual representation */
 	void UpdateVisuals();
 };
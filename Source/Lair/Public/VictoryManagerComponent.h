@@ -0,0 +1,171 @@
+// VictoryManagerComponent.h
+// Victory Manager Component (Incremental Victory Tracking)
+// Keeps running per-player counters and evaluates victory conditions against them.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "LairDataStructs.h"
+#include "VictoryManagerComponent.generated.h"
+
+// Forward declarations
+class ALairPlayerState;
+
+/** Delegate for a player meeting a victory condition */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnPlayerWon, int32, WinnerIndex, FName, ConditionID);
+
+/**
+ * Running totals for one player, updated from state-change events.
+ */
+USTRUCT(BlueprintType)
+struct FPlayerVictoryCounters
+{
+	GENERATED_BODY()
+
+	/** Current gold */
+	UPROPERTY(BlueprintReadOnly, Category = "Victory")
+	int32 Gold = 0;
+
+	/** Units currently owned */
+	UPROPERTY(BlueprintReadOnly, Category = "Victory")
+	int32 Units = 0;
+
+	/** Most units ever owned (a player with no units yet is not eliminated) */
+	UPROPERTY(BlueprintReadOnly, Category = "Victory")
+	int32 PeakUnits = 0;
+
+	/** Player had units and lost them all */
+	bool IsEliminated() const { return PeakUnits > 0 && Units == 0; }
+};
+
+/**
+ * Component that tracks victory conditions incrementally.
+ * Responsibilities:
+ * - Compile DT_VictoryConditions once into a flat condition list
+ * - Maintain per-player counters from gold and owned unit events
+ * - Evaluate a player in O(number of conditions), only when their counters changed
+ * - Broadcast the winner once
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class LAIR_API UVictoryManagerComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UVictoryManagerComponent();
+
+	// ========================================================================
+	// Initialization
+	// ========================================================================
+
+	/**
+	 * Compile victory conditions and reset all counters.
+	 * @param InVictoryConditionsTable - DT_VictoryConditions (null for defaults)
+	 * @param NumPlayers - Number of players in the match
+	 */
+	void Initialize(UDataTable* InVictoryConditionsTable, int32 NumPlayers);
+
+	/**
+	 * Start tracking a player state: seeds counters and binds its change events.
+	 * @param PlayerState - Player to track
+	 */
+	void RegisterPlayerState(ALairPlayerState* PlayerState);
+
+	// ========================================================================
+	// Queries
+	// ========================================================================
+
+	/**
+	 * Check whether a player currently meets any enabled victory condition.
+	 * @param PlayerIndex - Player to check
+	 * @return True if the player has won
+	 */
+	UFUNCTION(BlueprintPure, Category = "Victory")
+	bool HasPlayerWon(int32 PlayerIndex) const;
+
+	/**
+	 * Evaluate players whose counters changed since the last check.
+	 * Broadcasts OnPlayerWon the first time a winner is found.
+	 * @return Winning player index, or -1 if nobody has won
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Victory")
+	int32 CheckVictoryConditions();
+
+	/**
+	 * Get the winner of this match.
+	 * @return Winning player index, or -1 while the match is running
+	 */
+	UFUNCTION(BlueprintPure, Category = "Victory")
+	int32 GetWinnerIndex() const { return WinnerIndex; }
+
+	/**
+	 * Get the running counters for a player.
+	 * @param PlayerIndex - Player to query
+	 * @return Counters (zeroed if index is invalid)
+	 */
+	UFUNCTION(BlueprintPure, Category = "Victory")
+	FPlayerVictoryCounters GetPlayerCounters(int32 PlayerIndex) const;
+
+	/**
+	 * Get the threshold of the first enabled condition of a type.
+	 * @param Type - Victory type to look up
+	 * @return Gold threshold, or 0 if no such condition is enabled
+	 */
+	int32 GetConditionThreshold(EVictoryType Type) const;
+
+	// ========================================================================
+	// Events
+	// ========================================================================
+
+	/** Broadcast once when a player meets a victory condition */
+	UPROPERTY(BlueprintAssignable, Category = "Victory")
+	FOnPlayerWon OnPlayerWon;
+
+protected:
+	/** Victory conditions data table */
+	UPROPERTY()
+	UDataTable* VictoryConditionsDataTable;
+
+	/** Per-player running counters */
+	UPROPERTY()
+	TArray<FPlayerVictoryCounters> Counters;
+
+	/** Enabled condition compiled to the fields evaluation needs */
+	struct FCompiledCondition
+	{
+		FName ConditionID;
+		EVictoryType Type = EVictoryType::GoldThreshold;
+		int32 Threshold = 0;
+	};
+
+	/** Enabled conditions */
+	TArray<FCompiledCondition> Conditions;
+
+	/** Number of players currently eliminated */
+	int32 NumEliminated;
+
+	/** Bit per player whose counters changed since the last check */
+	uint32 DirtyPlayerMask;
+
+	/** Winner once decided */
+	int32 WinnerIndex;
+
+	/** Compile conditions from the data table or defaults */
+	void CompileConditions();
+
+	/** Find the first condition a player meets */
+	int32 FindMetCondition(int32 PlayerIndex) const;
+
+	/** Apply a unit count change, keeping elimination bookkeeping in sync */
+	void SetUnitCount(int32 PlayerIndex, int32 NewUnitCount);
+
+	/** Mark a player for re-evaluation */
+	void MarkDirty(int32 PlayerIndex) { DirtyPlayerMask |= (1u << PlayerIndex); }
+
+	/** Gold change handler */
+	void HandleGoldChanged(ALairPlayerState* PlayerState, int32 OldGold, int32 NewGold);
+
+	/** Owned unit change handler */
+	void HandleOwnedUnitsChanged(ALairPlayerState* PlayerState, int32 NumOwnedUnits);
+};